@@ -14,16 +14,37 @@ NC='\033[0m' # No Color
 
 # Configuration
 CXX=${CXX:-g++}
-CXXFLAGS="-std=c++17 -I. -Wall -Wextra -Werror -O2"
+CXXFLAGS="-std=c++17 -I. -Wall -Wextra -Werror -O2 -pthread"
 TARGET="holyc_test"
 BUILD_DIR="build"
 
 # Tests (name|space-separated-sources)
 TESTS=(
     "int|src/types/unsigned_int.cpp src/types/signed_int.cpp src/tests/test_int.cpp"
-    "error|src/tests/test_error.cpp"
+    "error|src/lib/error.cpp src/lib/error_types.cpp src/tests/test_error.cpp"
     "float|src/types/float.cpp src/tests/test_float.cpp"
     "union|src/types/union_type.cpp src/tests/test_union.cpp"
+    "tiered|src/lib/error.cpp src/lib/error_types.cpp src/runtime/bytecode.cpp src/runtime/tiered.cpp src/tests/test_tiered.cpp"
+    "fold|src/lib/error.cpp src/lib/error_types.cpp src/runtime/bytecode.cpp src/runtime/tiered.cpp src/compiler/const_fold.cpp src/tests/test_fold.cpp"
+    "parallel|src/lib/error.cpp src/lib/error_types.cpp src/runtime/bytecode.cpp src/runtime/tiered.cpp src/compiler/const_fold.cpp src/compiler/thread_pool.cpp src/compiler/compile_cache.cpp src/compiler/compile_unit.cpp src/tests/test_parallel.cpp"
+    "cache|src/lib/error.cpp src/lib/error_types.cpp src/runtime/bytecode.cpp src/runtime/tiered.cpp src/compiler/const_fold.cpp src/compiler/thread_pool.cpp src/compiler/compile_cache.cpp src/compiler/compile_unit.cpp src/tests/test_cache.cpp"
+    "typetable|src/types/type_table.cpp src/tests/test_type_table.cpp"
+    "symbols|src/lib/error.cpp src/lib/error_types.cpp src/types/type_table.cpp src/compiler/symbol_table.cpp src/tests/test_symbols.cpp"
+    "sinks|src/lib/error.cpp src/lib/error_types.cpp src/lib/diagnostic_sink.cpp src/tests/test_sinks.cpp"
+    "speculation|src/lib/error.cpp src/lib/error_types.cpp src/tests/test_speculation.cpp"
+    "checking|src/lib/error.cpp src/lib/error_types.cpp src/types/checking.cpp src/types/unsigned_int.cpp src/types/signed_int.cpp src/tests/test_checking.cpp"
+    "layout|src/types/type_table.cpp src/tests/test_layout.cpp"
+    "pool|src/runtime/value_pool.cpp src/tests/test_pool.cpp"
+    "gc|src/runtime/value_pool.cpp src/runtime/gc.cpp src/tests/test_gc.cpp"
+    "bits|src/types/unsigned_int.cpp src/types/signed_int.cpp src/types/bits.cpp src/tests/test_bits.cpp"
+    "sort|src/types/float.cpp src/types/sort.cpp src/compiler/thread_pool.cpp src/tests/test_sort.cpp"
+    "hash|src/types/bits.cpp src/lib/hash.cpp src/tests/test_hash.cpp"
+    "hashmap|src/types/bits.cpp src/lib/hash.cpp src/tests/test_hash_map.cpp"
+    "half|src/types/float.cpp src/types/bits.cpp src/types/half.cpp src/tests/test_half.cpp"
+    "reduce|src/types/float.cpp src/types/bits.cpp src/types/reduce.cpp src/tests/test_reduce.cpp"
+    "fixed|src/types/float.cpp src/types/bits.cpp src/types/reduce.cpp src/types/fixed.cpp src/tests/test_fixed.cpp"
+    "array|src/types/float.cpp src/types/bits.cpp src/types/reduce.cpp src/types/fixed.cpp src/tests/test_array.cpp"
+    "promotion|src/tests/test_promotion.cpp"
 )
 
 ARG="$1"
@@ -0,0 +1,430 @@
+#include "compile_cache.hpp"
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#ifdef _WIN32
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+
+namespace fs = std::filesystem;
+
+namespace holycpp {
+
+namespace {
+
+constexpr char MAGIC[4] = {'H', 'C', 'C', '\0'};
+
+// Numbers this process's temporary files; with the pid it makes every
+// writer's name unique, across threads and processes sharing a directory
+std::atomic<uint64_t> tempCounter{0};
+
+enum class DiagnosticKind : uint8_t {
+    PLAIN,
+    CONTEXTUAL,
+    INTERNAL
+};
+
+// ==================== Serialization ====================
+// Fixed little-endian layout so cache directories can be shared between
+// machines; the same bytes feed the content hash.
+class Writer {
+public:
+    std::string bytes;
+
+    void u8(uint8_t v) { bytes.push_back(static_cast<char>(v)); }
+
+    void u32(uint32_t v) {
+        for (int i = 0; i < 4; ++i) {
+            u8(static_cast<uint8_t>(v >> (8 * i)));
+        }
+    }
+
+    void u64(uint64_t v) {
+        for (int i = 0; i < 8; ++i) {
+            u8(static_cast<uint8_t>(v >> (8 * i)));
+        }
+    }
+
+    void i32(int32_t v) { u32(static_cast<uint32_t>(v)); }
+
+    void str(const std::string& s) {
+        u32(static_cast<uint32_t>(s.size()));
+        bytes.append(s);
+    }
+
+    void location(const SourceLocation& loc) {
+        str(loc.filename);
+        i32(loc.line);
+        i32(loc.column);
+        i32(loc.length);
+    }
+
+    void function(const Function& fn) {
+        str(fn.name);
+        i32(fn.numParams);
+        i32(fn.numRegs);
+        u32(static_cast<uint32_t>(fn.code.size()));
+        for (const Instruction& ins : fn.code) {
+            u8(static_cast<uint8_t>(ins.op));
+            u8(ins.dst);
+            u8(ins.a);
+            u8(ins.b);
+            i32(ins.imm);
+        }
+        u32(static_cast<uint32_t>(fn.constants.size()));
+        for (const Reg& constant : fn.constants) {
+            u64(static_cast<uint64_t>(constant.i));
+        }
+        location(fn.location);
+    }
+
+    // The key leaves out the function's line and column, so edits above
+    // it do not invalidate it; only the file takes part
+    void functionKey(const Function& fn) {
+        Function placed = fn;
+        placed.location.line = 0;
+        placed.location.column = 0;
+        function(placed);
+    }
+
+    // Locations in the function's file are stored relative to its start
+    // (the column too when on its first line), so a replayed entry lands
+    // wherever the function is now
+    void relativeLocation(const SourceLocation& loc, const SourceLocation& origin) {
+        const bool sameFile = loc.filename == origin.filename;
+        const bool sameLine = sameFile && loc.line == origin.line;
+        u8(sameLine ? 2 : sameFile ? 1 : 0);
+        str(loc.filename);
+        i32(sameFile ? loc.line - origin.line : loc.line);
+        i32(sameLine ? loc.column - origin.column : loc.column);
+        i32(loc.length);
+    }
+};
+
+// Every read is bounds-checked; a short or malformed file throws
+// std::runtime_error and the entry is treated as a miss.
+class Reader {
+public:
+    explicit Reader(const std::string& data) : bytes(data) {}
+
+    uint8_t u8() {
+        need(1);
+        return static_cast<uint8_t>(bytes[pos++]);
+    }
+
+    uint32_t u32() {
+        uint32_t v = 0;
+        for (int i = 0; i < 4; ++i) {
+            v |= static_cast<uint32_t>(u8()) << (8 * i);
+        }
+        return v;
+    }
+
+    uint64_t u64() {
+        uint64_t v = 0;
+        for (int i = 0; i < 8; ++i) {
+            v |= static_cast<uint64_t>(u8()) << (8 * i);
+        }
+        return v;
+    }
+
+    int32_t i32() { return static_cast<int32_t>(u32()); }
+
+    std::string str() {
+        const uint32_t size = u32();
+        need(size);
+        std::string s = bytes.substr(pos, size);
+        pos += size;
+        return s;
+    }
+
+    SourceLocation location() {
+        SourceLocation loc;
+        loc.filename = str();
+        loc.line = i32();
+        loc.column = i32();
+        loc.length = i32();
+        return loc;
+    }
+
+    SourceLocation relativeLocation(const SourceLocation& origin) {
+        const uint8_t mode = u8();
+        if (mode > 2) {
+            throw std::runtime_error("bad location mode in cache entry");
+        }
+        SourceLocation loc = location();
+        if (mode >= 1) {
+            loc.line += origin.line;
+        }
+        if (mode == 2) {
+            loc.column += origin.column;
+        }
+        return loc;
+    }
+
+    Function function() {
+        Function fn;
+        fn.name = str();
+        fn.numParams = i32();
+        fn.numRegs = i32();
+        const uint32_t codeSize = u32();
+        need(static_cast<size_t>(codeSize) * 8);
+        fn.code.reserve(codeSize);
+        for (uint32_t i = 0; i < codeSize; ++i) {
+            const uint8_t op = u8();
+            if (op > static_cast<uint8_t>(OpCode::RETURN)) {
+                throw std::runtime_error("unknown opcode in cache entry");
+            }
+            const uint8_t dst = u8();
+            const uint8_t a = u8();
+            const uint8_t b = u8();
+            fn.code.push_back(Instruction::make(static_cast<OpCode>(op), dst, a, b, i32()));
+        }
+        const uint32_t constantCount = u32();
+        need(static_cast<size_t>(constantCount) * 8);
+        fn.constants.reserve(constantCount);
+        for (uint32_t i = 0; i < constantCount; ++i) {
+            fn.constants.push_back(Reg::ofInt(static_cast<int64_t>(u64())));
+        }
+        fn.location = location();
+        return fn;
+    }
+
+    bool atEnd() const { return pos == bytes.size(); }
+
+private:
+    const std::string& bytes;
+    size_t pos = 0;
+
+    void need(size_t n) const {
+        if (bytes.size() - pos < n) {
+            throw std::runtime_error("truncated cache entry");
+        }
+    }
+};
+
+uint64_t fnv1a(const std::string& bytes) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (unsigned char c : bytes) {
+        hash ^= c;
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+void writeDiagnostic(Writer& out, const CompilerError& error, const SourceLocation& origin) {
+    DiagnosticKind kind = DiagnosticKind::PLAIN;
+    const ContextualError* contextual = dynamic_cast<const ContextualError*>(&error);
+    if (contextual) {
+        kind = DiagnosticKind::CONTEXTUAL;
+    } else if (dynamic_cast<const InternalError*>(&error)) {
+        kind = DiagnosticKind::INTERNAL;
+    }
+
+    out.u8(static_cast<uint8_t>(kind));
+    out.u8(static_cast<uint8_t>(error.getSeverity()));
+    out.str(error.getErrorCode());
+    out.str(error.getMessage());
+    out.relativeLocation(error.getLocation(), origin);
+
+    if (contextual) {
+        const auto& context = contextual->getContext();
+        out.u32(static_cast<uint32_t>(context.size()));
+        for (const auto& line : context) {
+            out.str(line);
+        }
+    }
+}
+
+std::unique_ptr<CompilerError> readDiagnostic(Reader& in, const SourceLocation& origin) {
+    const uint8_t kind = in.u8();
+    const uint8_t severityValue = in.u8();
+    if (severityValue > static_cast<uint8_t>(ErrorSeverity::FATAL)) {
+        throw std::runtime_error("bad severity in cache entry");
+    }
+    ErrorSeverity severity = static_cast<ErrorSeverity>(severityValue);
+    std::string code = in.str();
+    std::string message = in.str();
+    SourceLocation loc = in.relativeLocation(origin);
+
+    // Codes must still exist in the registry; a renumbered code makes the
+    // entry stale rather than replaying a diagnostic nobody can look up
+    if (!code.empty() && code != "ICE") {
+        const auto* info = ErrorCodeRegistry::get().find(code);
+        if (!info) {
+            throw std::runtime_error("unregistered error code " + code + " in cache entry");
+        }
+        severity = info->severity;
+    }
+
+    switch (static_cast<DiagnosticKind>(kind)) {
+        case DiagnosticKind::PLAIN:
+            return std::make_unique<CompilerError>(severity, message, loc, code);
+        case DiagnosticKind::CONTEXTUAL: {
+            auto error = std::make_unique<ContextualError>(severity, message, loc, code);
+            const uint32_t count = in.u32();
+            for (uint32_t i = 0; i < count; ++i) {
+                error->pushContext(in.str());
+            }
+            return error;
+        }
+        case DiagnosticKind::INTERNAL:
+            return std::make_unique<InternalError>(message, loc, code);
+        default:
+            throw std::runtime_error("bad diagnostic kind in cache entry");
+    }
+}
+
+} // namespace
+
+std::string CacheKey::toString() const {
+    char buffer[17];
+    std::snprintf(buffer, sizeof(buffer), "%016llx", static_cast<unsigned long long>(hash));
+    return buffer;
+}
+
+CompileCache::CompileCache(const std::string& directory) : dir(directory) {
+    std::error_code ec;
+    fs::create_directories(dir, ec);
+    if (ec || !fs::is_directory(dir)) {
+        throw std::runtime_error("Cannot create compile cache directory '" + dir + "'");
+    }
+}
+
+CacheKey CompileCache::keyFor(const Function& fn, uint64_t dependencyHash, uint32_t optionBits) {
+    Writer out;
+    out.u32(FORMAT_VERSION);
+    out.u64(dependencyHash);
+    out.u32(optionBits);
+    out.functionKey(fn);
+    CacheKey key;
+    key.hash = fnv1a(out.bytes);
+    key.content = std::move(out.bytes);
+    return key;
+}
+
+std::string CompileCache::pathFor(const CacheKey& key) const {
+    return (fs::path(dir) / (key.toString() + ".hcc")).string();
+}
+
+bool CompileCache::lookup(const CacheKey& key, const SourceLocation& origin, CacheEntry& entry) {
+    std::ifstream file(pathFor(key), std::ios::binary);
+    if (!file) {
+        misses.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    try {
+        Reader in(data);
+        for (char c : MAGIC) {
+            if (in.u8() != static_cast<uint8_t>(c)) {
+                throw std::runtime_error("bad magic");
+            }
+        }
+        if (in.u32() != FORMAT_VERSION || in.u64() != key.hash || in.str() != key.content) {
+            throw std::runtime_error("stale cache entry");
+        }
+
+        CacheEntry loaded;
+        loaded.function = in.function();
+        loaded.function.location = origin;
+        loaded.stats.instructionsBefore = in.u64();
+        loaded.stats.instructionsAfter = in.u64();
+        loaded.stats.foldedOps = in.u64();
+        loaded.stats.resolvedBranches = in.u64();
+        loaded.stats.removedDead = in.u64();
+
+        const uint32_t count = in.u32();
+        for (uint32_t i = 0; i < count; ++i) {
+            loaded.diagnostics.push_back(readDiagnostic(in, origin));
+        }
+        if (!in.atEnd()) {
+            throw std::runtime_error("trailing bytes in cache entry");
+        }
+
+        std::string reason;
+        if (!verifyFunction(loaded.function, reason)) {
+            throw std::runtime_error("cached bytecode fails verification: " + reason);
+        }
+
+        entry = std::move(loaded);
+    } catch (const std::runtime_error&) {
+        rejected.fetch_add(1, std::memory_order_relaxed);
+        misses.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    hits.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+void CompileCache::store(const CacheKey& key, const Function& fn, const FoldStats& stats,
+                         const std::vector<std::unique_ptr<CompilerError>>& diagnostics) {
+    Writer out;
+    for (char c : MAGIC) {
+        out.u8(static_cast<uint8_t>(c));
+    }
+    out.u32(FORMAT_VERSION);
+    out.u64(key.hash);
+    out.str(key.content);
+    out.function(fn);
+    out.u64(stats.instructionsBefore);
+    out.u64(stats.instructionsAfter);
+    out.u64(stats.foldedOps);
+    out.u64(stats.resolvedBranches);
+    out.u64(stats.removedDead);
+    out.u32(static_cast<uint32_t>(diagnostics.size()));
+    for (const auto& diagnostic : diagnostics) {
+        writeDiagnostic(out, *diagnostic, fn.location);
+    }
+
+    // Unique temporary per writer (pid and per-process counter), then an
+    // atomic rename into place
+    std::ostringstream tmpName;
+    tmpName << pathFor(key) << ".tmp." << getpid() << "."
+            << tempCounter.fetch_add(1, std::memory_order_relaxed);
+    const std::string tmp = tmpName.str();
+    std::ofstream file(tmp, std::ios::binary | std::ios::trunc);
+    file.write(out.bytes.data(), static_cast<std::streamsize>(out.bytes.size()));
+    file.close();   // Flushes; a failed flush leaves the stream bad
+    std::error_code ec;
+    if (!file) {
+        fs::remove(tmp, ec);
+        return;   // A cache that cannot be written only costs speed
+    }
+    fs::rename(tmp, pathFor(key), ec);
+    if (ec) {
+        fs::remove(tmp, ec);
+        return;
+    }
+    stores.fetch_add(1, std::memory_order_relaxed);
+}
+
+size_t CompileCache::clear() {
+    size_t removed = 0;
+    std::error_code ec;
+    for (const auto& item : fs::directory_iterator(dir, ec)) {
+        if (item.path().extension() == ".hcc" && fs::remove(item.path(), ec)) {
+            ++removed;
+        }
+    }
+    return removed;
+}
+
+CacheStats CompileCache::stats() const {
+    CacheStats result;
+    result.hits = hits.load(std::memory_order_relaxed);
+    result.misses = misses.load(std::memory_order_relaxed);
+    result.stores = stores.load(std::memory_order_relaxed);
+    result.rejected = rejected.load(std::memory_order_relaxed);
+    return result;
+}
+
+} // namespace holycpp
@@ -0,0 +1,85 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "const_fold.hpp"
+#include "../lib/error.hpp"
+#include "../lib/error_types.hpp"
+#include "../runtime/bytecode.hpp"
+
+namespace holycpp {
+
+// ==================== Incremental Compile Cache ====================
+// Persistent, content-addressed store of per-function compile results.
+// The key hashes everything the pipeline reads: the function's bytecode,
+// constants, signature and source file, the pipeline options and a
+// caller-supplied dependency hash (headers, globals, compiler version).
+// The function's line and column are left out, so moving it within its
+// file still hits. An entry holds the optimized bytecode, its fold
+// statistics and every diagnostic the compile produced, with locations
+// relative to the function's start, so a hit skips verification and
+// folding entirely and replays the same warnings and errors at the
+// function's current position.
+//
+// Entries live in one file per key and are written via rename, so
+// concurrent compile tasks and interrupted builds never see partial files.
+// Unreadable, truncated or stale entries, and entries whose stored key
+// bytes differ from the lookup's (a hash collision), are treated as misses.
+
+struct CacheKey {
+    uint64_t hash = 0;
+    std::string content;   // The hashed bytes; entries store them so a hash collision is a miss
+
+    std::string toString() const;   // 16 hex digits, used as the file name
+    bool operator==(const CacheKey& other) const { return hash == other.hash; }
+    bool operator!=(const CacheKey& other) const { return hash != other.hash; }
+};
+
+struct CacheEntry {
+    Function function;                                   // After folding
+    FoldStats stats;
+    std::vector<std::unique_ptr<CompilerError>> diagnostics;
+};
+
+struct CacheStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t stores = 0;
+    uint64_t rejected = 0;   // Corrupt or stale entries found on disk
+};
+
+class CompileCache {
+public:
+    // Bumped whenever the entry layout or the pipeline's output changes
+    static constexpr uint32_t FORMAT_VERSION = 3;
+
+    // Creates the directory if needed; throws std::runtime_error if it cannot
+    explicit CompileCache(const std::string& directory);
+
+    static CacheKey keyFor(const Function& fn, uint64_t dependencyHash, uint32_t optionBits);
+
+    // Safe to call concurrently, including for the same key. origin is the
+    // function's current location; replayed diagnostics are shifted to it.
+    bool lookup(const CacheKey& key, const SourceLocation& origin, CacheEntry& entry);
+    void store(const CacheKey& key, const Function& fn, const FoldStats& stats,
+               const std::vector<std::unique_ptr<CompilerError>>& diagnostics);
+
+    // Removes every entry; returns how many were deleted
+    size_t clear();
+
+    const std::string& directory() const { return dir; }
+    CacheStats stats() const;
+
+private:
+    std::string dir;
+    std::atomic<uint64_t> hits{0};
+    std::atomic<uint64_t> misses{0};
+    std::atomic<uint64_t> stores{0};
+    std::atomic<uint64_t> rejected{0};
+
+    std::string pathFor(const CacheKey& key) const;
+};
+
+} // namespace holycpp
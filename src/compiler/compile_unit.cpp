@@ -0,0 +1,109 @@
+#include "compile_unit.hpp"
+#include <chrono>
+
+namespace holycpp {
+
+namespace {
+
+void addFunctionContext(ContextualError& error, const Function& fn) {
+    error.pushContext("In function '" + fn.name + "'");
+}
+
+} // namespace
+
+CompiledFunction compileFunction(Function& fn, const CompileOptions& options,
+                                 std::vector<std::unique_ptr<CompilerError>>& diagnostics) {
+    CompiledFunction result;
+    const size_t firstDiagnostic = diagnostics.size();
+
+    CacheKey key;
+    if (options.cache) {
+        key = CompileCache::keyFor(fn, options.dependencyHash, options.foldConstants ? 1u : 0u);
+        CacheEntry entry;
+        if (options.cache->lookup(key, fn.location, entry)) {
+            fn = std::move(entry.function);
+            result.stats = entry.stats;
+            result.fromCache = true;
+            for (auto& diagnostic : entry.diagnostics) {
+                diagnostics.push_back(std::move(diagnostic));
+            }
+        }
+    }
+
+    if (!result.fromCache) {
+        std::string reason;
+        if (!verifyFunction(fn, reason)) {
+            auto error = std::make_unique<CodeGenError>(CodeGenError::Code::INVALID_IR, fn.location, reason);
+            addFunctionContext(*error, fn);
+            diagnostics.push_back(std::move(error));
+            result.ok = false;
+            return result;
+        }
+
+        std::vector<std::unique_ptr<CompilerError>> folded;
+        if (options.foldConstants) {
+            result.stats = foldConstants(fn, folded);
+        } else {
+            result.stats.instructionsBefore = result.stats.instructionsAfter = fn.code.size();
+        }
+        if (options.cache) {
+            options.cache->store(key, fn, result.stats, folded);
+        }
+        for (auto& diagnostic : folded) {
+            diagnostics.push_back(std::move(diagnostic));
+        }
+    }
+
+    if (options.generateCode) {
+        // ThreadedBackend keeps no state between compiles
+        ThreadedBackend backend;
+        CompileResult compiled = backend.compile(fn);
+        if (compiled.code) {
+            result.code = std::move(compiled.code);
+        } else {
+            auto error = std::make_unique<CodeGenError>(compiled.failure, fn.location, compiled.detail);
+            addFunctionContext(*error, fn);
+            diagnostics.push_back(std::move(error));
+        }
+    }
+
+    for (size_t i = firstDiagnostic; i < diagnostics.size(); ++i) {
+        if (diagnostics[i]->isError() || diagnostics[i]->isFatal()) {
+            result.ok = false;
+        }
+    }
+    return result;
+}
+
+UnitResult compileUnit(std::vector<Function>& functions, WorkStealingPool& pool,
+                       const CompileOptions& options) {
+    auto start = std::chrono::steady_clock::now();
+
+    UnitResult result;
+    result.functions.resize(functions.size());
+    std::vector<std::vector<std::unique_ptr<CompilerError>>> diagnostics(functions.size());
+
+    pool.parallelFor(functions.size(), [&](size_t i) {
+        result.functions[i] = compileFunction(functions[i], options, diagnostics[i]);
+    });
+
+    // Deterministic merge: function order, then emission order within a task
+    ErrorManager& manager = ErrorManager::get();
+    for (size_t i = 0; i < functions.size(); ++i) {
+        for (auto& diagnostic : diagnostics[i]) {
+            manager.report(std::move(diagnostic));
+        }
+        if (!result.functions[i].ok) {
+            ++result.failed;
+        }
+        if (result.functions[i].fromCache) {
+            ++result.cacheHits;
+        }
+    }
+
+    result.nanos = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start).count());
+    return result;
+}
+
+} // namespace holycpp
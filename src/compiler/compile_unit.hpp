@@ -0,0 +1,62 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "compile_cache.hpp"
+#include "const_fold.hpp"
+#include "thread_pool.hpp"
+#include "../lib/error.hpp"
+#include "../lib/error_types.hpp"
+#include "../runtime/bytecode.hpp"
+#include "../runtime/tiered.hpp"
+
+namespace holycpp {
+
+// ==================== Translation Unit Compilation ====================
+struct CompileOptions {
+    bool foldConstants = true;
+    bool generateCode = true;     // Run the ThreadedBackend after checking
+
+    // Optional incremental cache. dependencyHash covers inputs outside the
+    // function itself (headers, globals, compiler version); changing it
+    // invalidates every entry.
+    CompileCache* cache = nullptr;
+    uint64_t dependencyHash = 0;
+};
+
+// Output for one function, in the same slot as its input
+struct CompiledFunction {
+    std::unique_ptr<CompiledCode> code;     // null when codegen failed or was skipped
+    FoldStats stats;
+    bool ok = true;                         // No ERROR or FATAL diagnostics
+    bool fromCache = false;                 // Checking and folding were skipped
+};
+
+struct UnitResult {
+    std::vector<CompiledFunction> functions;
+    size_t failed = 0;
+    size_t cacheHits = 0;
+    uint64_t nanos = 0;
+};
+
+// Checks, folds and code-generates every function of a translation unit,
+// one pool task per function. Functions are independent, so each task
+// collects its own diagnostics and never touches the ErrorManager; the
+// lists are merged afterwards in function order, which makes the reported
+// output identical to a serial build whatever the thread count.
+//
+// Per-function pipeline:
+//   cache hit             -> cached bytecode, cached diagnostics replayed
+//   verification failure  -> C005 (CodeGenError::INVALID_IR), not cached
+//   folding diagnostics   -> as reported by foldConstants(), then cached
+//   backend failure       -> CodeGenError with the backend's code
+// Codegen always runs: translating verified bytecode to threaded code is
+// cheaper than reading it back, and its handlers are process-local.
+UnitResult compileUnit(std::vector<Function>& functions, WorkStealingPool& pool,
+                       const CompileOptions& options = {});
+
+// Single-function pipeline used by compileUnit; safe to call concurrently
+CompiledFunction compileFunction(Function& fn, const CompileOptions& options,
+                                 std::vector<std::unique_ptr<CompilerError>>& diagnostics);
+
+} // namespace holycpp
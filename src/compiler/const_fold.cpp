@@ -0,0 +1,497 @@
+#include "const_fold.hpp"
+#include <bitset>
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+
+namespace holycpp {
+
+const char* constTypeName(ConstType type) {
+    switch (type) {
+        case ConstType::U8: return "U8";
+        case ConstType::U16: return "U16";
+        case ConstType::U32: return "U32";
+        case ConstType::U64: return "U64";
+        case ConstType::I8: return "I8";
+        case ConstType::I16: return "I16";
+        case ConstType::I32: return "I32";
+        case ConstType::I64: return "I64";
+        case ConstType::F32: return "F32";
+        case ConstType::F64: return "F64";
+        default: return "?";
+    }
+}
+
+const char* constOpName(ConstOp op) {
+    switch (op) {
+        case ConstOp::ADD: return "+";
+        case ConstOp::SUB: return "-";
+        case ConstOp::MUL: return "*";
+        case ConstOp::DIV: return "/";
+        case ConstOp::MOD: return "%";
+        case ConstOp::AND: return "&";
+        case ConstOp::OR: return "|";
+        case ConstOp::XOR: return "^";
+        case ConstOp::SHL: return "<<";
+        case ConstOp::SHR: return ">>";
+        default: return "?";
+    }
+}
+
+namespace {
+
+// Calls f with a default-constructed value of the HolyC type behind `type`
+template<typename F>
+bool withConstType(ConstType type, F&& f) {
+    switch (type) {
+        case ConstType::U8: return f(U8());
+        case ConstType::U16: return f(U16());
+        case ConstType::U32: return f(U32());
+        case ConstType::U64: return f(U64());
+        case ConstType::I8: return f(I8());
+        case ConstType::I16: return f(I16());
+        case ConstType::I32: return f(I32());
+        case ConstType::I64: return f(I64());
+        case ConstType::F32: return f(F32());
+        case ConstType::F64: return f(F64());
+        default: return false;
+    }
+}
+
+template<typename T>
+T applyOp(ConstOp op, const T& lhs, const T& rhs) {
+    if constexpr (is_float_holyc_v<T>) {
+        switch (op) {
+            case ConstOp::ADD: return lhs + rhs;
+            case ConstOp::SUB: return lhs - rhs;
+            case ConstOp::MUL: return lhs * rhs;
+            case ConstOp::DIV: return lhs / rhs;
+            case ConstOp::MOD: return lhs % rhs;
+            default:
+                throw std::invalid_argument("operator not defined for floating-point operands");
+        }
+    } else {
+        using storage = typename T::storage_type;
+        if constexpr (is_signed_holyc_v<T>) {
+            // + - * wrap in two's complement; computed unsigned to avoid UB
+            switch (op) {
+                case ConstOp::ADD: return T(static_cast<storage>((lhs.as_unsigned() + rhs.as_unsigned()).raw()));
+                case ConstOp::SUB: return T(static_cast<storage>((lhs.as_unsigned() - rhs.as_unsigned()).raw()));
+                case ConstOp::MUL: return T(static_cast<storage>((lhs.as_unsigned() * rhs.as_unsigned()).raw()));
+                default:
+                    break;
+            }
+        }
+        switch (op) {
+            case ConstOp::ADD: return lhs + rhs;
+            case ConstOp::SUB: return lhs - rhs;
+            case ConstOp::MUL: return lhs * rhs;
+            case ConstOp::DIV: return lhs / rhs;
+            case ConstOp::MOD: return lhs % rhs;
+            case ConstOp::AND: return lhs & rhs;
+            case ConstOp::OR: return lhs | rhs;
+            case ConstOp::XOR: return lhs ^ rhs;
+            case ConstOp::SHL: return lhs << rhs;
+            case ConstOp::SHR: return lhs >> rhs;
+            default:
+                throw std::invalid_argument("unknown operator");
+        }
+    }
+}
+
+// Converts through the raw value so the target's converting constructor
+// applies exactly the bounds checks it applies at runtime.
+template<typename Target, typename Source>
+Target convertValue(const Source& source) {
+    if constexpr (is_float_holyc_v<Target>) {
+        return Target(source.raw());
+    } else if constexpr (is_float_holyc_v<Source>) {
+        // Truncates toward zero; NaN fails both comparisons
+        const double v = std::trunc(static_cast<double>(source.raw()));
+        if (!(v >= static_cast<double>(Target::MIN) && v < static_cast<double>(Target::MAX) + 1.0)) {
+            throw std::out_of_range("Floating-point value out of range for integer type");
+        }
+        return Target(static_cast<typename Target::storage_type>(v));
+    } else {
+        return Target(source.raw());
+    }
+}
+
+std::unique_ptr<ContextualError> diagnoseDomain(const SourceLocation& loc, const char* type,
+                                                const char* what) {
+    return std::make_unique<TypeError>(TypeError::Code::DIVISION_BY_ZERO, loc,
+                                       DiagArg::literal(type), DiagArg(), DiagArg::text(what));
+}
+
+std::unique_ptr<ContextualError> diagnoseConstExpr(const SourceLocation& loc, const char* what) {
+    return std::make_unique<SemanticError>(SemanticError::Code::INVALID_CONST_EXPR, loc, DiagArg::text(what));
+}
+
+// Runs an evaluation, turning the HolyC type exceptions into diagnostics
+template<typename Fn>
+bool guarded(Fn&& fn, const char* type, const SourceLocation& loc,
+             std::vector<std::unique_ptr<CompilerError>>& diagnostics,
+             const std::string* function = nullptr, const size_t* pc = nullptr) {
+    std::unique_ptr<ContextualError> diag;
+    try {
+        fn();
+        return true;
+    } catch (const std::domain_error& e) {
+        diag = diagnoseDomain(loc, type, e.what());
+    } catch (const std::out_of_range& e) {
+        diag = diagnoseConstExpr(loc, e.what());
+    } catch (const std::overflow_error& e) {
+        diag = diagnoseConstExpr(loc, e.what());
+    } catch (const std::underflow_error& e) {
+        diag = diagnoseConstExpr(loc, e.what());
+    } catch (const std::invalid_argument& e) {
+        diag = std::make_unique<TypeError>(TypeError::Code::INVALID_OPERAND_TYPES, loc,
+                                           DiagArg::literal(type), DiagArg(), DiagArg::text(e.what()));
+    }
+    // Frames are only built once a diagnostic actually exists
+    if (function) {
+        diag->pushContext("In function '" + *function + "'");
+    }
+    if (pc) {
+        diag->pushContext("At bytecode pc " + std::to_string(*pc));
+    }
+    diagnostics.push_back(std::move(diag));
+    return false;
+}
+
+} // namespace
+
+std::string ConstValue::toString() const {
+    std::stringstream ss;
+    withConstType(type, [&](auto tag) {
+        using T = decltype(tag);
+        ss << constTypeName(type) << " ";
+        if constexpr (sizeof(typename T::storage_type) == 1) {
+            ss << static_cast<int>(this->template as<T>().raw());
+        } else {
+            ss << this->template as<T>().raw();
+        }
+        return true;
+    });
+    return ss.str();
+}
+
+// ==================== Constant Folder ====================
+bool ConstantFolder::fold(ConstOp op, const ConstValue& lhs, const ConstValue& rhs,
+                          ConstValue& result, const SourceLocation& loc) {
+    if (lhs.type != rhs.type) {
+        diagnostics.push_back(std::make_unique<TypeError>(
+            TypeError::Code::INVALID_OPERAND_TYPES, loc,
+            DiagArg::literal(constTypeName(lhs.type)), DiagArg::literal(constTypeName(rhs.type)),
+            DiagArg::text(std::string("operator ") + constOpName(op))));
+        return false;
+    }
+
+    return withConstType(lhs.type, [&](auto tag) {
+        using T = decltype(tag);
+        return guarded([&] {
+            result = ConstValue::of(applyOp<T>(op, lhs.as<T>(), rhs.as<T>()));
+        }, constTypeName(lhs.type), loc, diagnostics);
+    });
+}
+
+bool ConstantFolder::convert(const ConstValue& value, ConstType target,
+                             ConstValue& result, const SourceLocation& loc) {
+    return withConstType(value.type, [&](auto sourceTag) {
+        using S = decltype(sourceTag);
+        return withConstType(target, [&](auto targetTag) {
+            using T = decltype(targetTag);
+            try {
+                result = ConstValue::of(convertValue<T>(value.as<S>()));
+                return true;
+            } catch (const std::out_of_range& e) {
+                diagnostics.push_back(std::make_unique<TypeError>(
+                    TypeError::Code::INVALID_CONVERSION, loc,
+                    DiagArg::literal(constTypeName(value.type)), DiagArg::literal(constTypeName(target)),
+                    DiagArg::text(value.toString() + ": " + e.what())));
+                return false;
+            }
+        });
+    });
+}
+
+void ConstantFolder::flush() {
+    for (auto& diag : diagnostics) {
+        ErrorManager::get().report(std::move(diag));
+    }
+    diagnostics.clear();
+}
+
+// ==================== Bytecode Folding Pass ====================
+namespace {
+
+using RegSet = std::bitset<256>;
+
+bool mayThrow(OpCode op) {
+    return op == OpCode::DIV_I64 || op == OpCode::MOD_I64 || op == OpCode::SHL_I64 ||
+           op == OpCode::SHR_I64 || op == OpCode::DIV_F64 || op == OpCode::F64_TO_I64;
+}
+
+bool isFloatOp(OpCode op) {
+    return (op >= OpCode::ADD_F64 && op <= OpCode::DIV_F64) ||
+           op == OpCode::LT_F64 || op == OpCode::LE_F64 || op == OpCode::F64_TO_I64;
+}
+
+// Next live instruction at or after pc (removed ones fall through)
+size_t skipRemoved(const std::vector<bool>& removed, size_t pc) {
+    while (pc < removed.size() && removed[pc]) ++pc;
+    return pc;
+}
+
+void successors(const Function& fn, const std::vector<bool>& removed, size_t pc,
+                size_t out[2], int& count) {
+    count = 0;
+    const Instruction& ins = fn.code[pc];
+    const size_t n = fn.code.size();
+    if (removed[pc]) {
+        if (pc + 1 < n) out[count++] = pc + 1;
+        return;
+    }
+    switch (ins.op) {
+        case OpCode::RETURN:
+            break;
+        case OpCode::JUMP:
+            out[count++] = ins.imm;
+            break;
+        case OpCode::JUMP_IF:
+        case OpCode::JUMP_IF_NOT:
+            out[count++] = ins.imm;
+            if (pc + 1 < n) out[count++] = pc + 1;
+            break;
+        default:
+            if (pc + 1 < n) out[count++] = pc + 1;
+            break;
+    }
+}
+
+RegSet usesOf(const Instruction& ins) {
+    RegSet uses;
+    if (isUnaryOp(ins.op) || ins.op == OpCode::JUMP_IF || ins.op == OpCode::JUMP_IF_NOT ||
+        ins.op == OpCode::RETURN) {
+        uses.set(ins.a);
+    } else if (isBinaryOp(ins.op)) {
+        uses.set(ins.a);
+        uses.set(ins.b);
+    }
+    return uses;
+}
+
+// One round of unreachable/dead/no-op removal; returns instructions removed
+size_t removeDeadCode(const Function& fn, std::vector<bool>& removed) {
+    const size_t n = fn.code.size();
+    size_t count = 0;
+    size_t succ[2];
+    int succCount = 0;
+
+    // Unreachable code
+    std::vector<bool> reachable(n, false);
+    std::vector<size_t> work{0};
+    reachable[0] = true;
+    while (!work.empty()) {
+        size_t pc = work.back();
+        work.pop_back();
+        successors(fn, removed, pc, succ, succCount);
+        for (int s = 0; s < succCount; ++s) {
+            if (!reachable[succ[s]]) {
+                reachable[succ[s]] = true;
+                work.push_back(succ[s]);
+            }
+        }
+    }
+    for (size_t pc = 0; pc < n; ++pc) {
+        if (!reachable[pc] && !removed[pc]) {
+            removed[pc] = true;
+            ++count;
+        }
+    }
+
+    // Jumps to the next live instruction
+    for (size_t pc = 0; pc < n; ++pc) {
+        const Instruction& ins = fn.code[pc];
+        if (!removed[pc] && ins.op == OpCode::JUMP &&
+            skipRemoved(removed, ins.imm) == skipRemoved(removed, pc + 1)) {
+            removed[pc] = true;
+            ++count;
+        }
+    }
+
+    // Liveness, then drop side-effect-free writes nobody reads
+    std::vector<RegSet> liveIn(n), liveOut(n);
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (size_t i = n; i-- > 0; ) {
+            RegSet out;
+            successors(fn, removed, i, succ, succCount);
+            for (int s = 0; s < succCount; ++s) {
+                out |= liveIn[succ[s]];
+            }
+            RegSet in = out;
+            if (!removed[i]) {
+                const Instruction& ins = fn.code[i];
+                if (writesDst(ins.op)) in.reset(ins.dst);
+                in |= usesOf(ins);
+            }
+            if (in != liveIn[i] || out != liveOut[i]) {
+                liveIn[i] = in;
+                liveOut[i] = out;
+                changed = true;
+            }
+        }
+    }
+    for (size_t pc = 0; pc < n; ++pc) {
+        const Instruction& ins = fn.code[pc];
+        if (removed[pc] || !writesDst(ins.op) || mayThrow(ins.op)) continue;
+        const bool selfMove = ins.op == OpCode::MOVE && ins.dst == ins.a;
+        if (selfMove || !liveOut[pc].test(ins.dst)) {
+            removed[pc] = true;
+            ++count;
+        }
+    }
+
+    return count;
+}
+
+} // namespace
+
+FoldStats foldConstants(Function& fn,
+                        std::vector<std::unique_ptr<CompilerError>>& diagnostics) {
+    std::string reason;
+    if (!verifyFunction(fn, reason)) {
+        throw std::invalid_argument("Invalid bytecode in '" + fn.name + "': " + reason);
+    }
+
+    FoldStats stats;
+    stats.instructionsBefore = fn.code.size();
+    const size_t n = fn.code.size();
+
+    // Basic-block leaders: known register values are only carried inside a block
+    std::vector<bool> leader(n, false);
+    bool entryIsTarget = false;
+    leader[0] = true;
+    for (size_t pc = 0; pc < n; ++pc) {
+        const Instruction& ins = fn.code[pc];
+        if (isBranch(ins.op)) {
+            leader[ins.imm] = true;
+            if (ins.imm == 0) entryIsTarget = true;
+        }
+        if ((isBranch(ins.op) || ins.op == OpCode::RETURN) && pc + 1 < n) {
+            leader[pc + 1] = true;
+        }
+    }
+
+    std::vector<bool> removed(n, false);
+    RegSet known;
+    Reg values[256];
+
+    auto makeConstant = [&](Instruction& ins, Reg value) {
+        ins = Instruction::make(OpCode::LOAD_CONST, ins.dst, 0, 0, fn.addConstant(value));
+        known.set(ins.dst);
+        values[ins.dst] = value;
+    };
+
+    for (size_t pc = 0; pc < n; ++pc) {
+        if (leader[pc]) {
+            known.reset();
+            if (pc == 0 && !entryIsTarget) {
+                // Non-parameter registers start zeroed
+                for (int r = fn.numParams; r < fn.numRegs; ++r) {
+                    known.set(r);
+                    values[r].i = 0;
+                }
+            }
+        }
+
+        Instruction& ins = fn.code[pc];
+
+        if (ins.op == OpCode::LOAD_CONST) {
+            known.set(ins.dst);
+            values[ins.dst] = fn.constants[ins.imm];
+        } else if (isUnaryOp(ins.op) || isBinaryOp(ins.op)) {
+            const bool binary = isBinaryOp(ins.op);
+            if (known.test(ins.a) && (!binary || known.test(ins.b))) {
+                Reg value{};
+                const Instruction original = ins;
+                bool ok = guarded([&] {
+                    value = binary ? evalBinary(original.op, values[original.a], values[original.b])
+                                   : evalUnary(original.op, values[original.a]);
+                }, isFloatOp(ins.op) ? "F64" : "I64", fn.location, diagnostics, &fn.name, &pc);
+                if (ok) {
+                    if (ins.op != OpCode::MOVE) ++stats.foldedOps;
+                    makeConstant(ins, value);
+                    continue;
+                }
+            }
+            known.reset(ins.dst);
+        } else if (ins.op == OpCode::JUMP_IF || ins.op == OpCode::JUMP_IF_NOT) {
+            if (known.test(ins.a)) {
+                const bool taken = (values[ins.a].i != 0) == (ins.op == OpCode::JUMP_IF);
+                if (taken) {
+                    ins = Instruction::make(OpCode::JUMP, 0, 0, 0, ins.imm);
+                } else {
+                    removed[pc] = true;
+                }
+                ++stats.resolvedBranches;
+            }
+        }
+    }
+
+    // Clean up until nothing else disappears
+    for (size_t dropped; (dropped = removeDeadCode(fn, removed)) != 0; ) {
+        stats.removedDead += dropped;
+    }
+
+    // Compact the code and retarget jumps
+    std::vector<int32_t> newIndex(n + 1, -1);
+    int32_t next = 0;
+    for (size_t pc = 0; pc < n; ++pc) {
+        if (!removed[pc]) newIndex[pc] = next++;
+    }
+    newIndex[n] = next;
+    for (size_t pc = n; pc-- > 0; ) {
+        if (removed[pc]) newIndex[pc] = newIndex[pc + 1];
+    }
+
+    std::vector<Instruction> code;
+    std::vector<Reg> constants;
+    code.reserve(next);
+    for (size_t pc = 0; pc < n; ++pc) {
+        if (removed[pc]) continue;
+        Instruction ins = fn.code[pc];
+        if (isBranch(ins.op)) {
+            ins.imm = newIndex[ins.imm];
+        } else if (ins.op == OpCode::LOAD_CONST) {
+            // Rebuild the pool with only the constants still referenced, deduplicated
+            const Reg value = fn.constants[ins.imm];
+            int32_t slot = -1;
+            for (size_t c = 0; c < constants.size(); ++c) {
+                if (constants[c].i == value.i) {
+                    slot = static_cast<int32_t>(c);
+                    break;
+                }
+            }
+            if (slot < 0) {
+                constants.push_back(value);
+                slot = static_cast<int32_t>(constants.size()) - 1;
+            }
+            ins.imm = slot;
+        }
+        code.push_back(ins);
+    }
+
+    fn.code = std::move(code);
+    fn.constants = std::move(constants);
+    stats.instructionsAfter = fn.code.size();
+
+    if (!verifyFunction(fn, reason)) {
+        throw std::logic_error("Constant folding produced invalid bytecode in '" + fn.name + "': " + reason);
+    }
+    return stats;
+}
+
+} // namespace holycpp
@@ -0,0 +1,117 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../types/unsigned_int.hpp"
+#include "../types/signed_int.hpp"
+#include "../types/float.hpp"
+#include "../lib/error.hpp"
+#include "../lib/error_types.hpp"
+#include "../runtime/bytecode.hpp"
+
+namespace holycpp {
+
+// ==================== Constant Values ====================
+enum class ConstType : uint8_t {
+    U8, U16, U32, U64,
+    I8, I16, I32, I64,
+    F32, F64
+};
+
+const char* constTypeName(ConstType type);
+
+template<typename T> struct const_type_of;
+template<> struct const_type_of<U8>  { static constexpr ConstType value = ConstType::U8; };
+template<> struct const_type_of<U16> { static constexpr ConstType value = ConstType::U16; };
+template<> struct const_type_of<U32> { static constexpr ConstType value = ConstType::U32; };
+template<> struct const_type_of<U64> { static constexpr ConstType value = ConstType::U64; };
+template<> struct const_type_of<I8>  { static constexpr ConstType value = ConstType::I8; };
+template<> struct const_type_of<I16> { static constexpr ConstType value = ConstType::I16; };
+template<> struct const_type_of<I32> { static constexpr ConstType value = ConstType::I32; };
+template<> struct const_type_of<I64> { static constexpr ConstType value = ConstType::I64; };
+template<> struct const_type_of<F32> { static constexpr ConstType value = ConstType::F32; };
+template<> struct const_type_of<F64> { static constexpr ConstType value = ConstType::F64; };
+
+// A compile-time value of a HolyC scalar type. The raw storage bits are
+// kept, so a folded value is exactly what the runtime type would hold.
+struct ConstValue {
+    ConstType type = ConstType::I64;
+    uint64_t bits = 0;
+
+    template<typename T>
+    static ConstValue of(const T& value) {
+        ConstValue result;
+        result.type = const_type_of<T>::value;
+        auto raw = value.raw();
+        std::memcpy(&result.bits, &raw, sizeof(raw));
+        return result;
+    }
+
+    template<typename T>
+    T as() const {
+        if (type != const_type_of<T>::value) {
+            throw std::runtime_error("ConstValue holds a different type");
+        }
+        typename T::storage_type raw;
+        std::memcpy(&raw, &bits, sizeof(raw));
+        return T(raw);
+    }
+
+    bool operator==(const ConstValue& other) const {
+        return type == other.type && bits == other.bits;
+    }
+    bool operator!=(const ConstValue& other) const { return !(*this == other); }
+
+    std::string toString() const;
+};
+
+enum class ConstOp {
+    ADD, SUB, MUL, DIV, MOD,
+    AND, OR, XOR, SHL, SHR
+};
+
+const char* constOpName(ConstOp op);
+
+// ==================== Constant Folder ====================
+// Evaluates expressions with the UInt<N>/SInt<N>/FInt<N> operators
+// themselves, so folded values match runtime behaviour bit for bit. What
+// would throw at runtime becomes a compile-time diagnostic instead:
+//   division/modulo by zero        -> T012 (TypeError::DIVISION_BY_ZERO)
+//   shift amount out of range      -> S008 (SemanticError::INVALID_CONST_EXPR)
+//   MIN / -1, out-of-range convert -> S008 / T004
+// A failed fold returns false and leaves the expression for the runtime.
+class ConstantFolder {
+public:
+    std::vector<std::unique_ptr<CompilerError>> diagnostics;
+
+    bool fold(ConstOp op, const ConstValue& lhs, const ConstValue& rhs,
+              ConstValue& result, const SourceLocation& loc = {});
+
+    // Conversion with the bounds checks of the converting constructors
+    bool convert(const ConstValue& value, ConstType target,
+                 ConstValue& result, const SourceLocation& loc = {});
+
+    // Moves collected diagnostics into the ErrorManager, in order
+    void flush();
+};
+
+// ==================== Bytecode Folding Pass ====================
+struct FoldStats {
+    size_t instructionsBefore = 0;
+    size_t instructionsAfter = 0;
+    size_t foldedOps = 0;          // Operations replaced by a constant
+    size_t resolvedBranches = 0;   // Conditional branches with a known condition
+    size_t removedDead = 0;        // Dead or unreachable instructions dropped
+
+    size_t removed() const { return instructionsBefore - instructionsAfter; }
+};
+
+// Constant propagation, folding (via evalBinary/evalUnary, the same helpers
+// every execution tier uses), branch resolution and dead-code removal.
+// Operations that would throw are left in place and diagnosed.
+FoldStats foldConstants(Function& fn,
+                        std::vector<std::unique_ptr<CompilerError>>& diagnostics);
+
+} // namespace holycpp
@@ -0,0 +1,179 @@
+#include "symbol_table.hpp"
+#include <stdexcept>
+
+namespace holycpp {
+
+// ==================== String Interner ====================
+const std::string* StringInterner::intern(std::string_view text) {
+    auto it = index.find(text);
+    if (it != index.end()) {
+        return it->second;
+    }
+    // deque::push_back never moves existing elements, so both the returned
+    // pointer and the string_view key stay valid
+    strings.emplace_back(text);
+    const std::string* stored = &strings.back();
+    index.emplace(std::string_view(*stored), stored);
+    return stored;
+}
+
+const std::string* StringInterner::find(std::string_view text) const {
+    auto it = index.find(text);
+    return it == index.end() ? nullptr : it->second;
+}
+
+// ==================== Symbol Table ====================
+namespace {
+
+// Interned strings are at least 8-byte aligned; drop the constant low bits
+// and scramble with a Fibonacci multiplier
+inline size_t hashPointer(const std::string* key) {
+    uint64_t h = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(key)) >> 3;
+    h *= 0x9E3779B97F4A7C15ULL;
+    return static_cast<size_t>(h ^ (h >> 32));
+}
+
+} // namespace
+
+SymbolTable::SymbolTable(StringInterner& interner)
+    : interner(interner), slots(64) {}
+
+uint32_t SymbolTable::findSlot(const std::string* key) const {
+    const size_t mask = slots.size() - 1;
+    for (size_t i = hashPointer(key) & mask;; i = (i + 1) & mask) {
+        if (slots[i].key == key) {
+            return static_cast<uint32_t>(i);
+        }
+        if (!slots[i].key) {
+            return NONE;
+        }
+    }
+}
+
+uint32_t SymbolTable::insertSlot(const std::string* key) {
+    // Keys are never removed (an unbound name keeps its slot), so the load
+    // factor only rises; keep it under 3/4 for short probe sequences
+    if ((usedSlots + 1) * 4 > slots.size() * 3) {
+        grow();
+    }
+    const size_t mask = slots.size() - 1;
+    for (size_t i = hashPointer(key) & mask;; i = (i + 1) & mask) {
+        if (slots[i].key == key) {
+            return static_cast<uint32_t>(i);
+        }
+        if (!slots[i].key) {
+            slots[i].key = key;
+            slots[i].binding = NONE;
+            ++usedSlots;
+            return static_cast<uint32_t>(i);
+        }
+    }
+}
+
+void SymbolTable::grow() {
+    std::vector<Slot> old(slots.size() * 2);
+    old.swap(slots);
+    const size_t mask = slots.size() - 1;
+    for (const Slot& slot : old) {
+        if (!slot.key) {
+            continue;
+        }
+        size_t i = hashPointer(slot.key) & mask;
+        while (slots[i].key) {
+            i = (i + 1) & mask;
+        }
+        slots[i] = slot;
+    }
+}
+
+void SymbolTable::enterScope() {
+    scopeMarks.push_back(static_cast<uint32_t>(symbols.size()));
+}
+
+void SymbolTable::leaveScope() {
+    if (scopeMarks.empty()) {
+        throw std::logic_error("leaveScope() at global scope");
+    }
+    const uint32_t mark = scopeMarks.back();
+    scopeMarks.pop_back();
+
+    // Undo newest first: each binding restores the one it shadowed
+    while (symbols.size() > mark) {
+        const Binding& binding = symbols.back();
+        slots[findSlot(binding.symbol.name)].binding = binding.shadowed;
+        symbols.pop_back();
+    }
+}
+
+const Symbol* SymbolTable::declare(const std::string* name, SymbolKind kind, TypeId type,
+                                   const SourceLocation& loc) {
+    if (!name) {
+        throw std::invalid_argument("Cannot declare a null name");
+    }
+    const uint32_t slot = insertSlot(name);
+    const uint32_t current = slots[slot].binding;
+
+    if (current != NONE && symbols[current].symbol.depth == depth()) {
+        const Symbol& previous = symbols[current].symbol;
+        std::unique_ptr<ContextualError> error;
+        if (kind == SymbolKind::FUNCTION || kind == SymbolKind::CLASS) {
+            error = std::make_unique<ParserError>(ParserError::Code::DUPLICATE_DECLARATION, loc, DiagArg::text(*name));
+        } else {
+            error = std::make_unique<TypeError>(TypeError::Code::REDECLARATION, loc, DiagArg(), DiagArg(), DiagArg::text(*name));
+        }
+        if (previous.location.isValid()) {
+            error->pushContext("Previous declaration at " + previous.location.toString());
+        }
+        diagnostics.push_back(std::move(error));
+        return nullptr;
+    }
+
+    if (symbols.size() >= NONE) {
+        throw std::length_error("Symbol table is full");
+    }
+
+    Binding binding;
+    binding.symbol.name = name;
+    binding.symbol.kind = kind;
+    binding.symbol.type = type;
+    binding.symbol.location = loc;
+    binding.symbol.depth = depth();
+    binding.shadowed = current;
+    symbols.push_back(binding);
+
+    slots[slot].binding = static_cast<uint32_t>(symbols.size() - 1);
+    return &symbols.back().symbol;
+}
+
+const Symbol* SymbolTable::lookup(const std::string* name) const {
+    if (!name) {
+        return nullptr;
+    }
+    const uint32_t slot = findSlot(name);
+    if (slot == NONE || slots[slot].binding == NONE) {
+        return nullptr;
+    }
+    return &symbols[slots[slot].binding].symbol;
+}
+
+const Symbol* SymbolTable::lookup(std::string_view name) const {
+    // A spelling that was never interned cannot be declared
+    return lookup(interner.find(name));
+}
+
+const Symbol* SymbolTable::resolve(const std::string* name, const SourceLocation& loc) {
+    const Symbol* symbol = lookup(name);
+    if (!symbol) {
+        diagnostics.push_back(std::make_unique<TypeError>(
+            TypeError::Code::UNDECLARED_IDENTIFIER, loc, DiagArg(), DiagArg(),
+            name ? DiagArg::text(*name) : DiagArg()));
+    }
+    return symbol;
+}
+
+bool SymbolTable::declaredInCurrentScope(const std::string* name) const {
+    const Symbol* symbol = lookup(name);
+    return symbol && symbol->depth == depth();
+}
+
+} // namespace holycpp
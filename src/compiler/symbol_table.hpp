@@ -0,0 +1,112 @@
+#pragma once
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "../lib/error.hpp"
+#include "../lib/error_types.hpp"
+#include "../types/type_table.hpp"
+
+namespace holycpp {
+
+// ==================== Identifier Interning ====================
+// Each distinct spelling is stored once; the returned pointer is stable for
+// the interner's lifetime, so identifiers compare and hash by address.
+class StringInterner {
+public:
+    const std::string* intern(std::string_view text);
+    const std::string* find(std::string_view text) const;   // Null if never interned
+    size_t size() const { return strings.size(); }
+
+private:
+    std::deque<std::string> strings;
+    std::unordered_map<std::string_view, const std::string*> index;
+};
+
+// ==================== Symbols ====================
+enum class SymbolKind : uint8_t {
+    VARIABLE,
+    PARAMETER,
+    FUNCTION,
+    CLASS
+};
+
+struct Symbol {
+    const std::string* name = nullptr;
+    SymbolKind kind = SymbolKind::VARIABLE;
+    TypeId type = INVALID_TYPE;
+    SourceLocation location;
+    uint32_t depth = 0;          // 0 is the global scope
+};
+
+// ==================== Scoped Symbol Table ====================
+// One open-addressing table maps each interned name to its innermost
+// binding; outer bindings of the same name hang off a shadow chain. Every
+// declaration is appended to an undo log, so leaving a scope pops exactly
+// the names it declared and restores what they shadowed: entering and
+// leaving cost O(names declared), never a map copy.
+//
+// Diagnostics are collected like ConstantFolder's:
+//   same name twice in one scope (variables)  -> T003 (REDECLARATION)
+//   same name twice in one scope (functions,
+//   classes)                                  -> P009 (DUPLICATE_DECLARATION)
+//   resolve() of an unknown name              -> T002 (UNDECLARED_IDENTIFIER)
+class SymbolTable {
+public:
+    static constexpr uint32_t NONE = UINT32_MAX;
+
+    explicit SymbolTable(StringInterner& interner);
+
+    // Names are copied into the diagnostics, so they outlive the interner
+    std::vector<std::unique_ptr<CompilerError>> diagnostics;
+
+    void enterScope();
+    void leaveScope();   // Throws std::logic_error at global scope
+    uint32_t depth() const { return static_cast<uint32_t>(scopeMarks.size()); }
+
+    // Returns the new symbol, or null after reporting a redeclaration
+    const Symbol* declare(const std::string* name, SymbolKind kind, TypeId type,
+                          const SourceLocation& loc = {});
+    const Symbol* declare(std::string_view name, SymbolKind kind, TypeId type,
+                          const SourceLocation& loc = {}) {
+        return declare(interner.intern(name), kind, type, loc);
+    }
+
+    // Innermost visible binding or null; never reports
+    const Symbol* lookup(const std::string* name) const;
+    const Symbol* lookup(std::string_view name) const;
+
+    // Like lookup, but reports T002 at loc when the name is not visible
+    const Symbol* resolve(const std::string* name, const SourceLocation& loc = {});
+
+    // True when name is declared in the innermost scope
+    bool declaredInCurrentScope(const std::string* name) const;
+
+    size_t symbolCount() const { return symbols.size(); }
+
+private:
+    struct Slot {
+        const std::string* key = nullptr;   // Null marks an empty slot
+        uint32_t binding = NONE;            // Index into symbols, NONE if unbound
+    };
+
+    struct Binding {
+        Symbol symbol;
+        uint32_t shadowed;   // Binding this one hides, or NONE
+    };
+
+    StringInterner& interner;
+    std::vector<Slot> slots;       // Power-of-two capacity
+    size_t usedSlots = 0;
+    std::deque<Binding> symbols;   // Undo log, LIFO by scope; addresses stay stable
+    std::vector<uint32_t> scopeMarks;
+
+    uint32_t findSlot(const std::string* key) const;
+    uint32_t insertSlot(const std::string* key);
+    void grow();
+};
+
+} // namespace holycpp
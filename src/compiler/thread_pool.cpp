@@ -0,0 +1,154 @@
+#include "thread_pool.hpp"
+#include <stdexcept>
+
+namespace holycpp {
+
+WorkStealingPool::WorkStealingPool(size_t threads) {
+    if (threads == 0) {
+        threads = std::thread::hardware_concurrency();
+    }
+    if (threads == 0) {
+        threads = 1;
+    }
+
+    for (size_t i = 0; i < threads; ++i) {
+        queues.push_back(std::make_unique<Queue>());
+    }
+    for (size_t i = 1; i < threads; ++i) {
+        workers.emplace_back([this, i] { workerLoop(i); });
+    }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+void WorkStealingPool::parallelFor(size_t count, const std::function<void(size_t)>& fn) {
+    if (count == 0) {
+        return;
+    }
+    if (workers.empty()) {
+        for (size_t i = 0; i < count; ++i) {
+            fn(i);
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (task) {
+            throw std::logic_error("WorkStealingPool::parallelFor is not reentrant");
+        }
+    }
+
+    // Contiguous blocks keep neighbouring functions on one core
+    const size_t n = queues.size();
+    for (size_t q = 0; q < n; ++q) {
+        const size_t begin = count * q / n;
+        const size_t end = count * (q + 1) / n;
+        std::lock_guard<std::mutex> lock(queues[q]->mutex);
+        for (size_t i = begin; i < end; ++i) {
+            queues[q]->items.push_back(i);
+        }
+    }
+
+    failure = nullptr;
+    remaining.store(count, std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        task = &fn;
+        ++generation;
+    }
+    wake.notify_all();
+
+    drain(0, fn);
+
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        done.wait(lock, [this] {
+            return remaining.load(std::memory_order_acquire) == 0 && active == 0;
+        });
+        task = nullptr;
+    }
+
+    if (failure) {
+        std::rethrow_exception(failure);
+    }
+}
+
+void WorkStealingPool::workerLoop(size_t self) {
+    uint64_t seen = 0;
+    for (;;) {
+        const std::function<void(size_t)>* fn = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [&] { return stopping || (task && generation != seen); });
+            if (stopping) {
+                return;
+            }
+            seen = generation;
+            fn = task;
+            ++active;
+        }
+
+        drain(self, *fn);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            --active;
+        }
+        done.notify_all();
+    }
+}
+
+void WorkStealingPool::drain(size_t self, const std::function<void(size_t)>& fn) {
+    size_t index;
+    // Tasks never spawn tasks, so once every deque is empty there is
+    // nothing left to find; in-flight work belongs to other participants.
+    while (popLocal(self, index) || steal(self, index)) {
+        try {
+            fn(index);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(failureMutex);
+            if (!failure) {
+                failure = std::current_exception();
+            }
+        }
+        remaining.fetch_sub(1, std::memory_order_acq_rel);
+    }
+}
+
+bool WorkStealingPool::popLocal(size_t self, size_t& index) {
+    Queue& queue = *queues[self];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.items.empty()) {
+        return false;
+    }
+    index = queue.items.front();
+    queue.items.pop_front();
+    return true;
+}
+
+bool WorkStealingPool::steal(size_t self, size_t& index) {
+    const size_t n = queues.size();
+    for (size_t offset = 1; offset < n; ++offset) {
+        Queue& victim = *queues[(self + offset) % n];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.items.empty()) {
+            index = victim.items.back();
+            victim.items.pop_back();
+            steals.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace holycpp
@@ -0,0 +1,69 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace holycpp {
+
+// ==================== Work-Stealing Thread Pool ====================
+// Every participant owns a deque of task indices. A batch is split into
+// contiguous blocks, one per deque; owners pop from the front of their own
+// block and idle participants steal from the back of someone else's, so
+// uneven functions (one huge, many tiny) still keep every core busy.
+// The calling thread takes part as participant 0.
+class WorkStealingPool {
+public:
+    // threads counts the caller; 0 means std::thread::hardware_concurrency()
+    explicit WorkStealingPool(size_t threads = 0);
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    // Runs task(0) .. task(count - 1) and returns when all have finished.
+    // The first exception thrown by a task is rethrown here once the batch
+    // has drained. Not reentrant: tasks must not call parallelFor.
+    void parallelFor(size_t count, const std::function<void(size_t)>& task);
+
+    size_t threadCount() const { return queues.size(); }
+
+    // Tasks taken from another participant's deque since construction
+    uint64_t stolenTasks() const { return steals.load(std::memory_order_relaxed); }
+
+private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<size_t> items;
+    };
+
+    std::vector<std::unique_ptr<Queue>> queues;
+    std::vector<std::thread> workers;
+
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+    const std::function<void(size_t)>* task = nullptr;
+    uint64_t generation = 0;
+    size_t active = 0;
+    bool stopping = false;
+
+    std::atomic<size_t> remaining{0};
+    std::atomic<uint64_t> steals{0};
+
+    std::mutex failureMutex;
+    std::exception_ptr failure;
+
+    void workerLoop(size_t self);
+    void drain(size_t self, const std::function<void(size_t)>& fn);
+    bool popLocal(size_t self, size_t& index);
+    bool steal(size_t self, size_t& index);
+};
+
+} // namespace holycpp
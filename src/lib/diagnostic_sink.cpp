@@ -0,0 +1,207 @@
+#include "diagnostic_sink.hpp"
+#include <charconv>
+#include <stdexcept>
+
+namespace holycpp {
+
+namespace {
+
+void appendInt(std::string& out, int value) {
+    char digits[16];
+    auto result = std::to_chars(digits, digits + sizeof(digits), value);
+    out.append(digits, result.ptr);
+}
+
+const char* upperSeverity(ErrorSeverity severity) {
+    switch (severity) {
+        case ErrorSeverity::NOTE: return "NOTE";
+        case ErrorSeverity::WARNING: return "WARNING";
+        case ErrorSeverity::ERROR: return "ERROR";
+        case ErrorSeverity::FATAL: return "FATAL";
+    }
+    return "UNKNOWN";
+}
+
+const char* sarifLevel(ErrorSeverity severity) {
+    switch (severity) {
+        case ErrorSeverity::NOTE: return "note";
+        case ErrorSeverity::WARNING: return "warning";
+        case ErrorSeverity::ERROR:
+        case ErrorSeverity::FATAL: return "error";
+    }
+    return "none";
+}
+
+// Appends ["a","b"] for a contextual error's stack; false if there is none
+bool appendContext(std::string& out, const CompilerError& error) {
+    const auto* contextual = dynamic_cast<const ContextualError*>(&error);
+    if (!contextual || contextual->contextDepth() == 0) {
+        return false;
+    }
+    out += '[';
+    bool first = true;
+    contextual->forEachContext([&](const std::string& entry) {
+        if (!first) {
+            out += ',';
+        }
+        first = false;
+        appendJsonString(out, entry);
+    });
+    out += ']';
+    return true;
+}
+
+} // namespace
+
+void appendJsonString(std::string& out, std::string_view text) {
+    static const char HEX[] = "0123456789abcdef";
+    out += '"';
+    size_t plain = 0;   // Start of the run of characters needing no escape
+    for (size_t i = 0; i < text.size(); ++i) {
+        const unsigned char c = static_cast<unsigned char>(text[i]);
+        if (c >= 0x20 && c != '"' && c != '\\') {
+            continue;
+        }
+        out.append(text.data() + plain, i - plain);
+        plain = i + 1;
+        switch (c) {
+            case '"': out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\n': out += "\\n"; break;
+            case '\r': out += "\\r"; break;
+            case '\t': out += "\\t"; break;
+            case '\b': out += "\\b"; break;
+            case '\f': out += "\\f"; break;
+            default:
+                out += "\\u00";
+                out += HEX[c >> 4];
+                out += HEX[c & 0xF];
+                break;
+        }
+    }
+    out.append(text.data() + plain, text.size() - plain);
+    out += '"';
+}
+
+// ==================== Buffered Stream Sink ====================
+BufferedSink::BufferedSink(std::ostream& out, size_t bufferBytes)
+    : out(out), capacity(bufferBytes) {
+    buffer.reserve(bufferBytes + 512);
+}
+
+void BufferedSink::flush() {
+    if (!buffer.empty()) {
+        out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        buffer.clear();
+    }
+    out.flush();
+}
+
+void BufferedSink::commit() {
+    ++count;
+    if (buffer.size() >= capacity) {
+        out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        buffer.clear();
+    }
+}
+
+// ==================== JSON Lines ====================
+void JsonLinesSink::emit(const CompilerError& error) {
+    buffer += "{\"error\":{\"code\":";
+    appendJsonString(buffer, error.getErrorCode());
+    buffer += ",\"severity\":\"";
+    buffer += upperSeverity(error.getSeverity());
+    buffer += "\",\"message\":";
+    appendJsonString(buffer, error.getMessage());
+
+    const SourceLocation& loc = error.getLocation();
+    if (loc.isValid()) {
+        buffer += ",\"location\":{\"file\":";
+        appendJsonString(buffer, loc.filename);
+        buffer += ",\"line\":";
+        appendInt(buffer, loc.line);
+        buffer += ",\"column\":";
+        appendInt(buffer, loc.column);
+        buffer += ",\"length\":";
+        appendInt(buffer, loc.length);
+        buffer += '}';
+    }
+
+    buffer += ",\"context\":";
+    if (!appendContext(buffer, error)) {
+        buffer += "[]";
+    }
+    buffer += "}}\n";
+    commit();
+}
+
+// ==================== SARIF 2.1.0 ====================
+SarifSink::SarifSink(std::ostream& out, std::string toolName, size_t bufferBytes)
+    : BufferedSink(out, bufferBytes), toolName(std::move(toolName)) {}
+
+void SarifSink::start() {
+    buffer += "{\"$schema\":\"https://json.schemastore.org/sarif-2.1.0.json\","
+              "\"version\":\"2.1.0\",\"runs\":[{\"tool\":{\"driver\":{\"name\":";
+    appendJsonString(buffer, toolName);
+    buffer += "}},\"results\":[";
+    started = true;
+}
+
+void SarifSink::emit(const CompilerError& error) {
+    if (finished) {
+        throw std::logic_error("SarifSink::emit() after finish()");
+    }
+    if (!started) {
+        start();
+    } else {
+        buffer += ',';
+    }
+
+    buffer += "\n{";
+    if (!error.getErrorCode().empty()) {
+        buffer += "\"ruleId\":";
+        appendJsonString(buffer, error.getErrorCode());
+        buffer += ',';
+    }
+    buffer += "\"level\":\"";
+    buffer += sarifLevel(error.getSeverity());
+    buffer += "\",\"message\":{\"text\":";
+    appendJsonString(buffer, error.getMessage());
+    buffer += '}';
+
+    const SourceLocation& loc = error.getLocation();
+    if (loc.isValid()) {
+        buffer += ",\"locations\":[{\"physicalLocation\":{\"artifactLocation\":{\"uri\":";
+        appendJsonString(buffer, loc.filename);
+        buffer += "},\"region\":{\"startLine\":";
+        appendInt(buffer, loc.line);
+        buffer += ",\"startColumn\":";
+        appendInt(buffer, loc.column);
+        buffer += ",\"endColumn\":";
+        appendInt(buffer, loc.column + loc.length);
+        buffer += "}}}]";
+    }
+
+    const size_t mark = buffer.size();
+    buffer += ",\"properties\":{\"context\":";
+    if (appendContext(buffer, error)) {
+        buffer += '}';
+    } else {
+        buffer.resize(mark);
+    }
+    buffer += '}';
+    commit();
+}
+
+void SarifSink::finish() {
+    if (!finished) {
+        if (!started) {
+            start();
+        }
+        buffer += "\n]}]}\n";
+        finished = true;
+    }
+    flush();
+}
+
+} // namespace holycpp
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include "error.hpp"
+
+namespace holycpp {
+
+// ==================== Diagnostic Sink ====================
+// Receives every diagnostic ErrorManager keeps, at the moment it is reported.
+// Combined with ErrorManager::setRetainDiagnostics(false) a build can emit
+// any number of diagnostics while holding only the counters in memory.
+// ErrorManager serializes calls, so sinks need no locking of their own.
+class DiagnosticSink {
+public:
+    virtual ~DiagnosticSink() = default;
+
+    virtual void emit(const CompilerError& error) = 0;
+
+    // Writes any trailer and pushes buffered bytes to the stream
+    virtual void finish() {}
+};
+
+// ==================== Buffered Stream Sink ====================
+// Formats into an owned buffer and hands it to the stream in large writes
+class BufferedSink : public DiagnosticSink {
+public:
+    static constexpr size_t DEFAULT_BUFFER_BYTES = 64 * 1024;
+
+    explicit BufferedSink(std::ostream& out, size_t bufferBytes = DEFAULT_BUFFER_BYTES);
+    ~BufferedSink() override = default;
+
+    void finish() override { flush(); }
+    size_t emitted() const { return count; }
+
+protected:
+    std::string buffer;
+    size_t count = 0;
+
+    void flush();
+    void commit();   // Counts one diagnostic and flushes once the buffer is full
+
+private:
+    std::ostream& out;
+    size_t capacity;
+};
+
+// ==================== JSON Lines ====================
+// One object per line, in the shape of the spec's JSON format:
+//   {"error":{"code":"L002","severity":"ERROR","message":"...",
+//    "location":{"file":"a.hc","line":10,"column":5,"length":1},
+//    "context":["..."]}}
+// "location" is omitted for diagnostics without a valid location.
+class JsonLinesSink : public BufferedSink {
+public:
+    using BufferedSink::BufferedSink;
+
+    void emit(const CompilerError& error) override;
+};
+
+// ==================== SARIF 2.1.0 ====================
+// A single run whose results array is streamed; finish() closes the
+// document. Severities map to SARIF levels (fatal -> "error") and the
+// context stack is kept under the result's "properties".
+class SarifSink : public BufferedSink {
+public:
+    explicit SarifSink(std::ostream& out, std::string toolName = "holyc++",
+                       size_t bufferBytes = DEFAULT_BUFFER_BYTES);
+
+    void emit(const CompilerError& error) override;
+    void finish() override;
+
+private:
+    std::string toolName;
+    bool started = false;
+    bool finished = false;
+
+    void start();
+};
+
+// Appends text as a quoted JSON string, escaping as RFC 8259 requires
+void appendJsonString(std::string& out, std::string_view text);
+
+} // namespace holycpp
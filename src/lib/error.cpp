@@ -1,6 +1,644 @@
 #include "error.hpp"
+#include "diagnostic_sink.hpp"
+#include <algorithm>
+#include <stdexcept>
 
 namespace holycpp {
     // Define the singleton instance in one translation unit
     ErrorManager* ErrorManager::instance = nullptr;
-}
\ No newline at end of file
+
+// ==================== Error Severity ====================
+std::string severityToString(ErrorSeverity severity) {
+    switch (severity) {
+        case ErrorSeverity::NOTE: return "note";
+        case ErrorSeverity::WARNING: return "warning";
+        case ErrorSeverity::ERROR: return "error";
+        case ErrorSeverity::FATAL: return "fatal";
+        default: return "unknown";
+    }
+}
+
+// ==================== Source Location ====================
+std::string SourceLocation::toString() const {
+    std::stringstream ss;
+    ss << filename << ":" << line << ":" << column;
+    return ss.str();
+}
+
+bool SourceLocation::isValid() const {
+    return !filename.empty() && line > 0 && column > 0;
+}
+
+// ==================== Diagnostic Arguments ====================
+void DiagArg::render(std::string& out, const std::string& ownedText) const {
+    switch (argKind) {
+        case Kind::NONE:
+            break;
+        case Kind::INTEGER:
+            out += std::to_string(integerValue);
+            break;
+        case Kind::NAME:
+            out += *nameValue;
+            break;
+        case Kind::LITERAL:
+            out += literalValue;
+            break;
+        case Kind::TYPE:
+            out += typeValue.spell(typeValue.table, typeValue.id);
+            break;
+        case Kind::TEXT:
+            if (textValue.data) {
+                out.append(textValue.data, textValue.size);
+            } else {
+                out.append(ownedText, textValue.offset, textValue.size);
+            }
+            break;
+    }
+}
+
+uint64_t DiagArg::hash(const std::string& ownedText) const {
+    std::hash<std::string_view> hasher;
+    switch (argKind) {
+        case Kind::NONE:
+            return 0;
+        case Kind::INTEGER:
+            return static_cast<uint64_t>(integerValue) * 0x9E3779B97F4A7C15ULL + 1;
+        case Kind::NAME:
+            return hasher(*nameValue);
+        case Kind::LITERAL:
+            return hasher(literalValue);
+        case Kind::TYPE:
+            return (static_cast<uint64_t>(typeValue.id) + 2) ^
+                   (reinterpret_cast<uintptr_t>(typeValue.table) * 0x9E3779B97F4A7C15ULL);
+        case Kind::TEXT:
+            if (textValue.data) {
+                return hasher(std::string_view(textValue.data, textValue.size));
+            }
+            return hasher(std::string_view(ownedText).substr(textValue.offset, textValue.size));
+    }
+    return 0;
+}
+
+// ==================== Base Compiler Error ====================
+CompilerError::CompilerError(ErrorSeverity sev, const std::string& msg,
+                             const SourceLocation& loc, const std::string& code)
+    : severity(sev), location(loc), errorCode(code), message(msg) {}
+
+void CompilerError::setArgs(std::initializer_list<DiagArg> list) {
+    if (list.size() > MAX_ARGS) {
+        throw std::invalid_argument("Too many diagnostic arguments");
+    }
+    size_t index = 0;
+    for (const DiagArg& source : list) {
+        DiagArg& stored = args[index++];
+        stored = source;
+        if (stored.argKind == DiagArg::Kind::TEXT) {
+            // Adopt the text so the argument survives copies of this error
+            stored.textValue.offset = static_cast<uint32_t>(argText.size());
+            argText.append(source.textValue.data, source.textValue.size);
+            stored.textValue.data = nullptr;
+        }
+    }
+    message.clear();
+    rendered = false;
+    typedArgs = true;
+}
+
+void CompilerError::adoptArgs() {
+    for (DiagArg& arg : args) {
+        if (arg.argKind != DiagArg::Kind::NAME && arg.argKind != DiagArg::Kind::TYPE) {
+            continue;
+        }
+        const size_t offset = argText.size();
+        arg.render(argText);
+        const size_t size = argText.size() - offset;
+        if (size == 0) {
+            arg = DiagArg();
+            continue;
+        }
+        arg.argKind = DiagArg::Kind::TEXT;
+        arg.textValue = {nullptr, static_cast<uint32_t>(offset), static_cast<uint32_t>(size)};
+    }
+}
+
+uint64_t CompilerError::contentHash() const {
+    std::hash<std::string_view> hasher;
+    uint64_t h = hasher(errorCode);
+    if (!typedArgs) {
+        return (h ^ hasher(getMessage())) * 0x9E3779B97F4A7C15ULL;
+    }
+    for (const DiagArg& arg : args) {
+        h = (h ^ arg.hash(argText)) * 0x9E3779B97F4A7C15ULL;
+    }
+    return h;
+}
+
+void CompilerError::renderWithDetail(std::string& out, std::string head) const {
+    out = std::move(head);
+    if (hasArg(0)) {
+        out += ": ";
+        appendArg(out, 0);
+    }
+}
+
+void CompilerError::renderMessage(std::string&) const {
+    // Plain diagnostics carry their message from construction
+}
+
+bool CompilerError::isError() const {
+    return severity == ErrorSeverity::ERROR || severity == ErrorSeverity::FATAL;
+}
+
+bool CompilerError::isFatal() const { return severity == ErrorSeverity::FATAL; }
+bool CompilerError::isWarning() const { return severity == ErrorSeverity::WARNING; }
+bool CompilerError::isNote() const { return severity == ErrorSeverity::NOTE; }
+
+std::string CompilerError::format() const {
+    std::stringstream ss;
+    if (!errorCode.empty()) {
+        ss << errorCode << ": ";
+    }
+    ss << severityToString(severity) << ": " << getMessage();
+    if (location.isValid()) {
+        ss << "\n  at " << location.toString();
+    }
+    return ss.str();
+}
+
+std::string CompilerError::formatMessage(const std::string& file, int line,
+                                         int column, const std::string& msg) {
+    std::stringstream ss;
+    ss << file << ":" << line << ":" << column << ": " << msg;
+    return ss.str();
+}
+
+// ==================== Context Tree ====================
+const ContextFrame* ContextTree::push(const ContextFrame* parent, std::string_view text) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = index.find(Key{parent, text});
+    if (it != index.end()) {
+        return it->second;
+    }
+    frames.push_back(ContextFrame{parent, std::string(text), parent ? parent->depth + 1 : 1});
+    const ContextFrame* frame = &frames.back();
+    index.emplace(Key{parent, frame->text}, frame);
+    return frame;
+}
+
+size_t ContextTree::size() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return frames.size();
+}
+
+// ==================== Contextual Error ====================
+ContextualError::ContextualError(ErrorSeverity sev, const std::string& msg,
+                                 const SourceLocation& loc, const std::string& code)
+    : CompilerError(sev, msg, loc, code) {}
+
+void ContextualError::pushContext(const std::string& text) {
+    if (!tree) {
+        tree = ErrorManager::get().contextTree();
+    }
+    context = tree->push(context, text);
+}
+
+void ContextualError::popContext() {
+    if (context) {
+        context = context->parent;
+    }
+}
+
+std::vector<std::string> ContextualError::getContext() const {
+    std::vector<std::string> lines;
+    lines.reserve(contextDepth());
+    forEachContext([&](const std::string& text) { lines.push_back(text); });
+    return lines;
+}
+
+std::string ContextualError::format() const {
+    std::string result = CompilerError::format();
+    forEachContext([&](const std::string& text) {
+        result += "\n  ";
+        result += text;
+    });
+    return result;
+}
+
+// ==================== Error Builder ====================
+ErrorBuilder::ErrorBuilder() : error(std::make_unique<ContextualError>()) {}
+
+ErrorBuilder& ErrorBuilder::severity(ErrorSeverity sev) {
+    error->severity = sev;
+    return *this;
+}
+
+ErrorBuilder& ErrorBuilder::code(const std::string& code) {
+    error->errorCode = code;
+    return *this;
+}
+
+ErrorBuilder& ErrorBuilder::at(const std::string& filename, int line, int column, int length) {
+    error->location = SourceLocation(filename, line, column, length);
+    return *this;
+}
+
+ErrorBuilder& ErrorBuilder::inContext(const std::string& context) {
+    error->pushContext(context);
+    return *this;
+}
+
+std::unique_ptr<CompilerError> ErrorBuilder::build() {
+    error->message = messageStream.str();
+    return std::move(error);
+}
+
+// ==================== Diagnostic Arena ====================
+void* DiagnosticArena::allocate(size_t bytes, size_t align) {
+    for (;;) {
+        if (current < chunks.size()) {
+            Chunk& chunk = chunks[current];
+            const uintptr_t base = reinterpret_cast<uintptr_t>(chunk.data.get());
+            const uintptr_t start = (base + offset + align - 1) & ~static_cast<uintptr_t>(align - 1);
+            if (start + bytes <= base + chunk.size) {
+                offset = start + bytes - base;
+                return reinterpret_cast<void*>(start);
+            }
+            if (current + 1 < chunks.size() || offset > 0) {
+                // Move on to the next chunk (kept from before a rewind, or new)
+                ++current;
+                offset = 0;
+                continue;
+            }
+        }
+        const size_t size = std::max(chunkBytes, bytes + align);
+        chunks.push_back({std::unique_ptr<unsigned char[]>(new unsigned char[size]), size});
+        current = chunks.size() - 1;
+        offset = 0;
+    }
+}
+
+void DiagnosticArena::rewind(Mark to) {
+    current = to.chunk;
+    offset = to.offset;
+}
+
+size_t DiagnosticArena::bytesReserved() const {
+    size_t total = 0;
+    for (const Chunk& chunk : chunks) {
+        total += chunk.size;
+    }
+    return total;
+}
+
+// ==================== Error Manager ====================
+void ErrorManager::report(std::unique_ptr<CompilerError> error) {
+    record(DiagnosticPtr(error.release()), true);
+}
+
+void ErrorManager::report(DiagnosticPtr error) {
+    record(std::move(error), true);
+}
+
+void ErrorManager::record(DiagnosticPtr error, bool applyLimits) {
+    if (!error || isFiltered(error->getSeverity())) {
+        return;
+    }
+    // Stored diagnostics outlive the interners and tables that produced them
+    error->adoptArgs();
+
+    if (error->isWarning() && warningsAsErrors.load(std::memory_order_relaxed)) {
+        error->severity = ErrorSeverity::ERROR;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(storageMutex);
+        const bool speculative = openCheckpoints > 0;
+        if (applyLimits && !speculative && !admit(*error)) {
+            return;
+        }
+
+        switch (error->getSeverity()) {
+            case ErrorSeverity::NOTE:
+                counters.notes.fetch_add(1, std::memory_order_relaxed);
+                break;
+            case ErrorSeverity::WARNING:
+                counters.warnings.fetch_add(1, std::memory_order_relaxed);
+                break;
+            case ErrorSeverity::ERROR:
+                counters.errors.fetch_add(1, std::memory_order_relaxed);
+                break;
+            case ErrorSeverity::FATAL:
+                counters.errors.fetch_add(1, std::memory_order_relaxed);
+                counters.fatal.store(true, std::memory_order_relaxed);
+                break;
+        }
+
+        if (speculative) {
+            errors.push_back(std::move(error));   // Settled at the outermost commit
+        } else {
+            if (sink) {
+                sink->emit(*error);
+            }
+            if (retainDiagnostics) {
+                errors.push_back(std::move(error));
+            }
+        }
+    }
+
+    if (getErrorCount() >= maxErrors.load(std::memory_order_relaxed)) {
+        counters.fatal.store(true, std::memory_order_relaxed);
+    }
+}
+
+namespace {
+
+// Line and column packed into one word, then mixed with the content and
+// file name hashes
+uint64_t fingerprintOf(const CompilerError& error) {
+    const SourceLocation& loc = error.getLocation();
+    const uint64_t packed = (static_cast<uint64_t>(static_cast<uint32_t>(loc.line)) << 32) |
+                            (static_cast<uint64_t>(static_cast<uint16_t>(loc.column)) << 16) |
+                            static_cast<uint16_t>(loc.length);
+    std::hash<std::string_view> hasher;
+    uint64_t h = error.contentHash();
+    h = (h ^ hasher(loc.filename)) * 0x9E3779B97F4A7C15ULL;
+    h = (h ^ packed) * 0x9E3779B97F4A7C15ULL;
+    h ^= h >> 29;
+    return h ? h : 1;   // 0 is the empty-slot marker
+}
+
+} // namespace
+
+bool ErrorManager::insertFingerprint(uint64_t fingerprint) {
+    if ((fingerprintCount + 1) * 4 > fingerprints.size() * 3) {
+        std::vector<uint64_t> old(fingerprints.empty() ? 256 : fingerprints.size() * 2);
+        old.swap(fingerprints);
+        const size_t mask = fingerprints.size() - 1;
+        for (uint64_t value : old) {
+            if (value) {
+                size_t i = value & mask;
+                while (fingerprints[i]) {
+                    i = (i + 1) & mask;
+                }
+                fingerprints[i] = value;
+            }
+        }
+    }
+    const size_t mask = fingerprints.size() - 1;
+    for (size_t i = fingerprint & mask;; i = (i + 1) & mask) {
+        if (fingerprints[i] == fingerprint) {
+            return false;
+        }
+        if (!fingerprints[i]) {
+            fingerprints[i] = fingerprint;
+            ++fingerprintCount;
+            return true;
+        }
+    }
+}
+
+bool ErrorManager::admit(const CompilerError& error) {
+    // Fatal diagnostics always get through
+    if (error.isFatal()) {
+        return true;
+    }
+
+    CodeLimit* codeLimit = nullptr;
+    int limit = defaultRateLimit;
+    if (!error.getErrorCode().empty() && (defaultRateLimit > 0 || !codeLimits.empty())) {
+        codeLimit = &codeLimits[error.getErrorCode()];
+        if (codeLimit->limit >= 0) {
+            limit = codeLimit->limit;
+        }
+    }
+
+    if (deduplicate && !insertFingerprint(fingerprintOf(error))) {
+        ++duplicateCount;
+        return false;
+    }
+
+    if (codeLimit) {
+        if (limit > 0 && codeLimit->kept >= limit) {
+            ++codeLimit->suppressed;
+            return false;
+        }
+        ++codeLimit->kept;
+    }
+    return true;
+}
+
+void ErrorManager::reportMessage(ErrorSeverity sev, std::string_view message,
+                                 const SourceLocation& loc) {
+    report(makeDiagnostic<CompilerError>(sev, std::string(message), loc));
+}
+
+ErrorBuilder ErrorManager::buildError() {
+    return ErrorBuilder();
+}
+
+void ErrorManager::updateFilter() {
+    unsigned mask = 0;
+    for (ErrorSeverity sev : {ErrorSeverity::NOTE, ErrorSeverity::WARNING}) {
+        if (sev < minSeverity) {
+            mask |= 1u << static_cast<unsigned>(sev);
+        }
+    }
+    if (suppressWarnings) {
+        mask |= 1u << static_cast<unsigned>(ErrorSeverity::WARNING);
+    }
+    droppedSeverities.store(mask, std::memory_order_relaxed);
+}
+
+void ErrorManager::setMaxErrors(int max) { maxErrors.store(max, std::memory_order_relaxed); }
+void ErrorManager::setWarningsAsErrors(bool asErrors) {
+    warningsAsErrors.store(asErrors, std::memory_order_relaxed);
+}
+
+void ErrorManager::setSuppressWarnings(bool suppress) {
+    suppressWarnings = suppress;
+    updateFilter();
+}
+
+void ErrorManager::setMinSeverity(ErrorSeverity sev) {
+    minSeverity = sev;
+    updateFilter();
+}
+
+void ErrorManager::setSink(DiagnosticSink* newSink) {
+    std::lock_guard<std::mutex> lock(storageMutex);
+    sink = newSink;
+}
+
+void ErrorManager::setRetainDiagnostics(bool retain) {
+    std::lock_guard<std::mutex> lock(storageMutex);
+    retainDiagnostics = retain;
+}
+
+void ErrorManager::setDeduplicate(bool enabled) {
+    std::lock_guard<std::mutex> lock(storageMutex);
+    deduplicate = enabled;
+}
+
+void ErrorManager::setRateLimit(const std::string& code, int limit) {
+    std::lock_guard<std::mutex> lock(storageMutex);
+    codeLimits[code].limit = limit < 0 ? 0 : limit;
+}
+
+void ErrorManager::setDefaultRateLimit(int limit) {
+    std::lock_guard<std::mutex> lock(storageMutex);
+    defaultRateLimit = limit < 0 ? 0 : limit;
+}
+
+int ErrorManager::getDuplicateCount() const {
+    std::lock_guard<std::mutex> lock(storageMutex);
+    return duplicateCount;
+}
+
+std::vector<ErrorManager::SuppressionSummary> ErrorManager::getSuppressed() const {
+    std::vector<SuppressionSummary> summary;
+    {
+        std::lock_guard<std::mutex> lock(storageMutex);
+        for (const auto& [code, state] : codeLimits) {
+            if (state.suppressed > 0) {
+                summary.push_back({code, state.suppressed});
+            }
+        }
+    }
+    std::sort(summary.begin(), summary.end(),
+              [](const SuppressionSummary& a, const SuppressionSummary& b) { return a.code < b.code; });
+    return summary;
+}
+
+void ErrorManager::reportSuppressed() {
+    for (const SuppressionSummary& entry : getSuppressed()) {
+        record(makeDiagnostic<CompilerError>(
+                   ErrorSeverity::NOTE,
+                   std::to_string(entry.suppressed) + " more diagnostic(s) suppressed",
+                   SourceLocation(), entry.code),
+               false);
+        std::lock_guard<std::mutex> lock(storageMutex);
+        codeLimits[entry.code].suppressed = 0;
+    }
+}
+
+ErrorManager::Checkpoint ErrorManager::checkpoint() {
+    std::lock_guard<std::mutex> lock(storageMutex);
+    if (openCheckpoints == 0) {
+        speculationStart = errors.size();
+    }
+    return {errors.size(), getErrorCount(), getWarningCount(), getNoteCount(), hasFatal(),
+            arena.mark(), ++openCheckpoints};
+}
+
+void ErrorManager::rollback(const Checkpoint& mark) {
+    std::lock_guard<std::mutex> lock(storageMutex);
+    if (mark.depth != openCheckpoints || mark.stored > errors.size()) {
+        throw std::logic_error("Checkpoints must be closed innermost first");
+    }
+    // Newest first, then hand the arena space back in one step
+    while (errors.size() > mark.stored) {
+        errors.pop_back();
+    }
+    arena.rewind(mark.arenaMark);
+    counters.errors.store(mark.errors, std::memory_order_relaxed);
+    counters.warnings.store(mark.warnings, std::memory_order_relaxed);
+    counters.notes.store(mark.notes, std::memory_order_relaxed);
+    counters.fatal.store(mark.fatal, std::memory_order_relaxed);
+    --openCheckpoints;
+}
+
+void ErrorManager::commit(const Checkpoint& mark) {
+    std::lock_guard<std::mutex> lock(storageMutex);
+    if (mark.depth != openCheckpoints) {
+        throw std::logic_error("Checkpoints must be closed innermost first");
+    }
+    if (--openCheckpoints == 0) {
+        settleSpeculative();
+    }
+}
+
+void ErrorManager::settleSpeculative() {
+    // Apply what report() deferred: limits, then streaming and retention
+    size_t kept = speculationStart;
+    for (size_t i = speculationStart; i < errors.size(); ++i) {
+        DiagnosticPtr& error = errors[i];
+        if (!admit(*error)) {
+            switch (error->getSeverity()) {
+                case ErrorSeverity::NOTE:
+                    counters.notes.fetch_sub(1, std::memory_order_relaxed);
+                    break;
+                case ErrorSeverity::WARNING:
+                    counters.warnings.fetch_sub(1, std::memory_order_relaxed);
+                    break;
+                default:
+                    counters.errors.fetch_sub(1, std::memory_order_relaxed);
+                    break;
+            }
+            error.reset();
+            continue;
+        }
+        if (sink) {
+            sink->emit(*error);
+        }
+        if (retainDiagnostics) {
+            if (kept != i) {
+                errors[kept] = std::move(error);
+            }
+            ++kept;
+        } else {
+            error.reset();
+        }
+    }
+    errors.resize(kept);
+    if (errors.empty()) {
+        arena.rewind({});
+    }
+}
+
+bool ErrorManager::isSpeculating() const {
+    std::lock_guard<std::mutex> lock(storageMutex);
+    return openCheckpoints > 0;
+}
+
+size_t ErrorManager::arenaBytes() const {
+    std::lock_guard<std::mutex> lock(storageMutex);
+    return arena.bytesReserved();
+}
+
+void ErrorManager::clear() {
+    std::lock_guard<std::mutex> lock(storageMutex);
+    errors.clear();
+    arena.rewind({});
+    openCheckpoints = 0;
+    std::fill(fingerprints.begin(), fingerprints.end(), 0);
+    fingerprintCount = 0;
+    duplicateCount = 0;
+    for (auto& [code, state] : codeLimits) {
+        state.kept = 0;
+        state.suppressed = 0;
+    }
+    counters.errors.store(0, std::memory_order_relaxed);
+    counters.warnings.store(0, std::memory_order_relaxed);
+    counters.notes.store(0, std::memory_order_relaxed);
+    counters.fatal.store(false, std::memory_order_relaxed);
+    // Frames still referenced by surviving diagnostics live on with them
+    std::atomic_store(&contexts, std::make_shared<ContextTree>());
+}
+
+void ErrorManager::dumpAll(std::ostream& out) const {
+    const std::vector<SuppressionSummary> suppressed = getSuppressed();
+    std::lock_guard<std::mutex> lock(storageMutex);
+    for (const auto& error : errors) {
+        out << error->format() << "\n";
+    }
+    for (const SuppressionSummary& entry : suppressed) {
+        out << entry.code << ": " << entry.suppressed << " more suppressed\n";
+    }
+    if (duplicateCount > 0) {
+        out << duplicateCount << " duplicate(s) dropped\n";
+    }
+    out << getErrorCount() << " error(s), " << getWarningCount() << " warning(s), "
+        << getNoteCount() << " note(s)\n";
+}
+
+} // namespace holycpp
@@ -1,11 +1,21 @@
 #pragma once
 
+#include <array>
+#include <cstdint>
+#include <initializer_list>
 #include <string>
 #include <vector>
 #include <memory>
 #include <sstream>
 #include <iostream>
 #include <functional>
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <string_view>
+#include <deque>
+#include <unordered_map>
 
 namespace holycpp {
 
@@ -35,13 +45,118 @@ struct SourceLocation {
     bool isValid() const;
 };
 
+// ==================== Diagnostic Arguments ====================
+// A typed argument stored in a diagnostic instead of pre-formatted text.
+// Nothing is spelled out until the message is rendered, so diagnostics that
+// are discarded (speculation, overload resolution) never build strings.
+class DiagArg {
+public:
+    enum class Kind : uint8_t {
+        NONE,
+        INTEGER,
+        NAME,       // Interned identifier, pointer must outlive the diagnostic
+                    // until it is reported (see CompilerError::adoptArgs)
+        LITERAL,    // Static string, e.g. a type or operator name
+        TYPE,       // Type id spelled by its table when rendered
+        TEXT        // Arbitrary text, copied into the owning diagnostic
+    };
+
+    DiagArg() = default;
+
+    static DiagArg integer(int64_t value) {
+        DiagArg arg(Kind::INTEGER);
+        arg.integerValue = value;
+        return arg;
+    }
+    static DiagArg name(const std::string* interned) {
+        DiagArg arg(interned ? Kind::NAME : Kind::NONE);
+        arg.nameValue = interned;
+        return arg;
+    }
+    static DiagArg literal(const char* text) {
+        DiagArg arg(text && *text ? Kind::LITERAL : Kind::NONE);
+        arg.literalValue = text;
+        return arg;
+    }
+    static DiagArg text(std::string_view text) {
+        DiagArg arg(text.empty() ? Kind::NONE : Kind::TEXT);
+        arg.textValue = {text.data(), 0, static_cast<uint32_t>(text.size())};
+        return arg;
+    }
+    // Any table with `std::string name(Id) const` (e.g. TypeTable)
+    template<typename Table>
+    static DiagArg type(uint32_t id, const Table& table) {
+        DiagArg arg(Kind::TYPE);
+        arg.typeValue = {id, &table, [](const void* t, uint32_t typeId) {
+            return static_cast<const Table*>(t)->name(typeId);
+        }};
+        return arg;
+    }
+
+    Kind kind() const { return argKind; }
+    bool empty() const { return argKind == Kind::NONE; }
+
+    // Appends the spelling; an adopted TEXT argument needs its owner's
+    // buffer, which CompilerError::appendArg supplies
+    void render(std::string& out, const std::string& ownedText = {}) const;
+    // Hashes what render() would spell without building it: text by
+    // content, integers by value, types by id and table
+    uint64_t hash(const std::string& ownedText = {}) const;
+
+private:
+    friend class CompilerError;
+
+    explicit DiagArg(Kind kind) : argKind(kind) {}
+
+    Kind argKind = Kind::NONE;
+    union {
+        int64_t integerValue;
+        const std::string* nameValue;
+        const char* literalValue;
+        struct {
+            const char* data;    // Null once adopted: offset indexes argText
+            uint32_t offset;
+            uint32_t size;
+        } textValue;
+        struct {
+            uint32_t id;
+            const void* table;
+            std::string (*spell)(const void*, uint32_t);
+        } typeValue;
+    };
+};
+
 // ==================== Base Compiler Error ====================
 class CompilerError {
+    friend class ErrorBuilder;
+    friend class ErrorManager;
+    
 protected:
+    static constexpr size_t MAX_ARGS = 3;
+
     ErrorSeverity severity;
-    std::string message;
     SourceLocation location;
     std::string errorCode;
+
+    // Rendered from args on first use by subclasses that override renderMessage
+    mutable std::string message;
+    mutable bool rendered = true;
+    bool typedArgs = false;   // Set by setArgs; plain diagnostics carry only a message
+    std::array<DiagArg, MAX_ARGS> args{};
+    std::string argText;   // Backing storage for TEXT arguments
+
+    // Stores the arguments (copying TEXT into argText) and defers the message
+    void setArgs(std::initializer_list<DiagArg> list);
+    // Spells NAME and TYPE arguments into argText as TEXT, so the diagnostic
+    // no longer points into an interner or type table. Called when it is
+    // handed to the ErrorManager; the message itself stays unrendered.
+    void adoptArgs();
+    bool hasArg(size_t index) const { return !args[index].empty(); }
+    void appendArg(std::string& out, size_t index) const { args[index].render(out, argText); }
+    // "<head>: <arg 0>", or just head when there is no argument
+    void renderWithDetail(std::string& out, std::string head) const;
+
+    virtual void renderMessage(std::string& out) const;
     
 public:
     CompilerError(ErrorSeverity sev = ErrorSeverity::ERROR,
@@ -52,9 +167,20 @@ public:
     virtual ~CompilerError() = default;
     
     ErrorSeverity getSeverity() const { return severity; }
-    const std::string& getMessage() const { return message; }
+    // Renders lazily; not safe to call concurrently on the same diagnostic
+    const std::string& getMessage() const {
+        if (!rendered) {
+            renderMessage(message);
+            rendered = true;
+        }
+        return message;
+    }
     const SourceLocation& getLocation() const { return location; }
     const std::string& getErrorCode() const { return errorCode; }
+    bool isRendered() const { return rendered; }
+    // Hash of the code and message content. Typed diagnostics hash their
+    // arguments, so the message is not rendered; plain ones hash the message.
+    uint64_t contentHash() const;
     
     bool isError() const;
     bool isFatal() const;
@@ -67,10 +193,52 @@ public:
                                      int column, const std::string& msg);
 };
 
+// ==================== Context Tree ====================
+// Context lines ("In function 'Main'") are immutable frames linked to their
+// enclosing frame. A diagnostic holds a pointer to its innermost frame, so
+// attaching context is O(1) and every diagnostic raised in one function
+// shares a single chain.
+struct ContextFrame {
+    const ContextFrame* parent;
+    std::string text;
+    uint32_t depth;   // 1 for an outermost frame
+};
+
+// Append-only frame storage. push() returns the one frame for (parent,
+// text), copying the text only the first time it is seen; frames stay valid
+// for the tree's lifetime. Safe to use from several threads. Each
+// ErrorManager owns the current tree and replaces it on clear(); diagnostics
+// holding frames share ownership, so a tree is freed with its last user.
+class ContextTree {
+public:
+    const ContextFrame* push(const ContextFrame* parent, std::string_view text);
+    size_t size() const;
+
+private:
+    struct Key {
+        const ContextFrame* parent;
+        std::string_view text;
+        bool operator==(const Key& other) const {
+            return parent == other.parent && text == other.text;
+        }
+    };
+    struct KeyHash {
+        size_t operator()(const Key& key) const {
+            return std::hash<std::string_view>()(key.text) ^
+                   (reinterpret_cast<uintptr_t>(key.parent) * 0x9E3779B97F4A7C15ULL);
+        }
+    };
+
+    mutable std::mutex mutex;
+    std::deque<ContextFrame> frames;   // Never moves, so frames and keys stay valid
+    std::unordered_map<Key, const ContextFrame*, KeyHash> index;
+};
+
 // ==================== Contextual Error ====================
 class ContextualError : public CompilerError {
 protected:
-    std::vector<std::string> contextStack;
+    std::shared_ptr<ContextTree> tree;       // Owns context and its parents
+    const ContextFrame* context = nullptr;   // Innermost frame
     
 public:
     ContextualError(ErrorSeverity sev = ErrorSeverity::ERROR,
@@ -78,11 +246,33 @@ public:
                    const SourceLocation& loc = {},
                    const std::string& code = "");
     
+    // Adds a frame inside the current one, in this error's tree or, for the
+    // first frame, in the ErrorManager's current tree
     void pushContext(const std::string& context);
     void popContext();
-    const std::vector<std::string>& getContext() const { return contextStack; }
+    // Replaces the whole chain with frame and its parents from owner; no copying
+    void setContext(std::shared_ptr<ContextTree> owner, const ContextFrame* frame) {
+        tree = std::move(owner);
+        context = frame;
+    }
+    const ContextFrame* contextFrame() const { return context; }
+    size_t contextDepth() const { return context ? context->depth : 0; }
+    
+    // Outermost first, as pushed
+    std::vector<std::string> getContext() const;
+    template<typename Fn>
+    void forEachContext(Fn&& fn) const { visitFrames(context, fn); }
     
     std::string format() const override;
+    
+private:
+    template<typename Fn>
+    static void visitFrames(const ContextFrame* frame, Fn& fn) {
+        if (frame) {
+            visitFrames(frame->parent, fn);
+            fn(frame->text);
+        }
+    }
 };
 
 // ==================== Error Builder ====================
@@ -108,58 +298,247 @@ public:
     std::unique_ptr<CompilerError> build();
 };
 
+// ==================== Diagnostic Arena ====================
+// Bump allocator for diagnostics created while speculating. rewind() hands
+// back everything allocated after a mark in one step; the objects living
+// there must already have been destroyed. Chunks are kept for reuse.
+class DiagnosticArena {
+public:
+    struct Mark {
+        size_t chunk = 0;
+        size_t offset = 0;
+    };
+
+    explicit DiagnosticArena(size_t chunkBytes = 16 * 1024) : chunkBytes(chunkBytes) {}
+
+    void* allocate(size_t bytes, size_t align);
+    Mark mark() const { return {current, offset}; }
+    void rewind(Mark to);
+    size_t bytesReserved() const;
+
+private:
+    struct Chunk {
+        std::unique_ptr<unsigned char[]> data;
+        size_t size;
+    };
+
+    std::vector<Chunk> chunks;
+    size_t chunkBytes;
+    size_t current = 0;   // Chunk being filled
+    size_t offset = 0;    // First free byte in it
+};
+
+// Owns a diagnostic on the heap or, for arena-backed ones, only runs its
+// destructor
+struct DiagnosticDeleter {
+    bool arenaOwned = false;
+
+    void operator()(CompilerError* error) const {
+        if (arenaOwned) {
+            error->~CompilerError();
+        } else {
+            delete error;
+        }
+    }
+};
+
+using DiagnosticPtr = std::unique_ptr<CompilerError, DiagnosticDeleter>;
+
+class DiagnosticSink;
+
 // ==================== Error Manager (Singleton) ====================
+// Counters and the fatal flag are atomics on their own cache line, so
+// hasErrors() polls from worker threads never contend with the filter
+// configuration. Severities that would be dropped are rejected by a single
+// relaxed load before any CompilerError is allocated; with no diagnostics
+// reported the manager never touches the heap.
 class ErrorManager {
 private:
     static ErrorManager* instance;
-    
-    std::vector<std::unique_ptr<CompilerError>> errors;
-    int errorCount = 0;
-    int warningCount = 0;
-    int noteCount = 0;
-    int maxErrors = 100;
+
+    struct alignas(64) Counters {
+        std::atomic<int> errors{0};
+        std::atomic<int> warnings{0};
+        std::atomic<int> notes{0};
+        std::atomic<bool> fatal{false};
+    };
+
+    Counters counters;
+
+    // Bit (1 << severity) set means reports of that severity are dropped
+    alignas(64) std::atomic<unsigned> droppedSeverities{0};
+    std::atomic<bool> warningsAsErrors{false};
+    std::atomic<int> maxErrors{100};
     bool suppressWarnings = false;
-    bool warningsAsErrors = false;
-    bool hasFatalError = false;
-    
+    ErrorSeverity minSeverity = ErrorSeverity::NOTE;
+
+    mutable std::mutex storageMutex;   // Guards errors and the sink
+    std::vector<DiagnosticPtr> errors;
+    DiagnosticSink* sink = nullptr;
+    bool retainDiagnostics = true;
+
+    // Deduplication: open-addressing set of 64-bit fingerprints over
+    // (content hash, file, packed location); 0 marks an empty slot
+    bool deduplicate = false;
+    std::vector<uint64_t> fingerprints;
+    size_t fingerprintCount = 0;
+    int duplicateCount = 0;
+
+    // Per-code rate limits; a limit of 0 means unlimited
+    struct CodeLimit {
+        int limit = -1;      // -1 defers to defaultRateLimit
+        int kept = 0;
+        int suppressed = 0;
+    };
+    std::unordered_map<std::string, CodeLimit> codeLimits;
+    int defaultRateLimit = 0;
+
+    // Speculation: diagnostics reported while a checkpoint is open are
+    // stored unfiltered and unstreamed until the outermost commit
+    DiagnosticArena arena;
+    uint32_t openCheckpoints = 0;
+    size_t speculationStart = 0;   // First diagnostic of the outermost checkpoint
+
+    // Context frames of diagnostics reported since the last clear();
+    // read and replaced atomically
+    std::shared_ptr<ContextTree> contexts = std::make_shared<ContextTree>();
+
+    void record(DiagnosticPtr error, bool applyLimits);
+    void settleSpeculative();   // Called with storageMutex held
+    bool admit(const CompilerError& error);   // Called with storageMutex held
+    bool insertFingerprint(uint64_t fingerprint);
+
     ErrorManager() = default;
-    
+
+    void reportMessage(ErrorSeverity sev, std::string_view message, const SourceLocation& loc);
+    void updateFilter();
+
 public:
-    static ErrorManager& get();
-    
-    // Reporting methods
+    static ErrorManager& get() {
+        static ErrorManager* const manager = instance ? instance : (instance = new ErrorManager());
+        return *manager;
+    }
+
+    // The tree new context frames go into until the next clear()
+    std::shared_ptr<ContextTree> contextTree() const { return std::atomic_load(&contexts); }
+
+    // True when a report of this severity would be discarded; lets callers
+    // skip building expensive messages
+    bool isFiltered(ErrorSeverity sev) const {
+        return droppedSeverities.load(std::memory_order_relaxed) & (1u << static_cast<unsigned>(sev));
+    }
+
+    // Reporting methods (safe to call from several threads)
     void report(std::unique_ptr<CompilerError> error);
-    
-    void note(const std::string& message, 
-              const SourceLocation& loc = {});
-    void warning(const std::string& message, 
-                 const SourceLocation& loc = {});
-    void error(const std::string& message, 
-               const SourceLocation& loc = {});
-    void fatal(const std::string& message, 
-               const SourceLocation& loc = {});
-    
+    void report(DiagnosticPtr error);
+
+    // Constructs E in place: in the speculation arena while a checkpoint is
+    // open, on the heap otherwise
+    template<typename E, typename... Args>
+    void emplace(Args&&... args) {
+        report(makeDiagnostic<E>(std::forward<Args>(args)...));
+    }
+
+    template<typename E, typename... Args>
+    DiagnosticPtr makeDiagnostic(Args&&... args) {
+        static_assert(std::is_base_of_v<CompilerError, E>, "E must derive from CompilerError");
+        {
+            std::lock_guard<std::mutex> lock(storageMutex);
+            if (openCheckpoints > 0) {
+                void* memory = arena.allocate(sizeof(E), alignof(E));
+                return DiagnosticPtr(new (memory) E(std::forward<Args>(args)...), DiagnosticDeleter{true});
+            }
+        }
+        return DiagnosticPtr(new E(std::forward<Args>(args)...), DiagnosticDeleter{false});
+    }
+
+    void note(std::string_view message, const SourceLocation& loc = {}) {
+        if (!isFiltered(ErrorSeverity::NOTE)) {
+            reportMessage(ErrorSeverity::NOTE, message, loc);
+        }
+    }
+    void warning(std::string_view message, const SourceLocation& loc = {}) {
+        if (!isFiltered(ErrorSeverity::WARNING)) {
+            reportMessage(ErrorSeverity::WARNING, message, loc);
+        }
+    }
+    void error(std::string_view message, const SourceLocation& loc = {}) {
+        reportMessage(ErrorSeverity::ERROR, message, loc);
+    }
+    void fatal(std::string_view message, const SourceLocation& loc = {}) {
+        reportMessage(ErrorSeverity::FATAL, message, loc);
+    }
+
     // Builder
     ErrorBuilder buildError();
-    
+
     // Configuration
     void setMaxErrors(int max);
     void setSuppressWarnings(bool suppress);
     void setWarningsAsErrors(bool asErrors);
-    
+    void setMinSeverity(ErrorSeverity sev);   // Errors and fatals are never dropped
+
+    // Streams each kept diagnostic to sink as it is reported (not owned;
+    // null detaches). With retain off only the counters stay in memory.
+    void setSink(DiagnosticSink* newSink);
+    void setRetainDiagnostics(bool retain);
+
+    // Drop diagnostics identical in code, location and message to one
+    // already kept. Off by default.
+    void setDeduplicate(bool enabled);
+
+    // Keep at most limit diagnostics per error code (0 = unlimited); the rest
+    // are only counted and summarized as "N more suppressed"
+    void setRateLimit(const std::string& code, int limit);
+    void setDefaultRateLimit(int limit);
+
+    struct SuppressionSummary {
+        std::string code;
+        int suppressed;
+    };
+
     // Statistics
-    int getErrorCount() const { return errorCount; }
-    int getWarningCount() const { return warningCount; }
-    int getNoteCount() const { return noteCount; }
-    int getTotalCount() const { return errorCount + warningCount + noteCount; }
-    bool hasErrors() const { return errorCount > 0 || hasFatalError; }
-    bool hasFatal() const { return hasFatalError; }
-    
-    // Access
-    const std::vector<std::unique_ptr<CompilerError>>& getErrors() const {
+    int getErrorCount() const { return counters.errors.load(std::memory_order_relaxed); }
+    int getWarningCount() const { return counters.warnings.load(std::memory_order_relaxed); }
+    int getNoteCount() const { return counters.notes.load(std::memory_order_relaxed); }
+    int getTotalCount() const { return getErrorCount() + getWarningCount() + getNoteCount(); }
+    bool hasErrors() const { return getErrorCount() > 0 || hasFatal(); }
+    bool hasFatal() const { return counters.fatal.load(std::memory_order_relaxed); }
+    int getDuplicateCount() const;
+    std::vector<SuppressionSummary> getSuppressed() const;   // Sorted by code
+
+    // Reports one note per rate-limited code, e.g.
+    // "T011: 4998 more diagnostic(s) suppressed", bypassing the limits
+    void reportSuppressed();
+
+    // ==================== Speculation ====================
+    // checkpoint() is O(1). rollback() truncates the stored diagnostics,
+    // restores the counters and rewinds the arena; commit() keeps them.
+    // Checkpoints nest and must be closed innermost first, from one thread.
+    // Dedup, rate limits and the sink only see diagnostics once the
+    // outermost checkpoint commits.
+    struct Checkpoint {
+        size_t stored;
+        int errors;
+        int warnings;
+        int notes;
+        bool fatal;
+        DiagnosticArena::Mark arenaMark;
+        uint32_t depth;
+    };
+
+    Checkpoint checkpoint();
+    void commit(const Checkpoint& mark);
+    void rollback(const Checkpoint& mark);
+    bool isSpeculating() const;
+    int errorsSince(const Checkpoint& mark) const { return getErrorCount() - mark.errors; }
+    size_t arenaBytes() const;
+
+    // Access; only stable once reporting threads have finished
+    const std::vector<DiagnosticPtr>& getErrors() const {
         return errors;
     }
-    
+
     // Utility
     void clear();
     void dumpAll(std::ostream& out = std::cerr) const;
@@ -1,25 +1,52 @@
 #include "error_types.hpp"
-#include <sstream>
 
 namespace holycpp {
     // Define the singleton instance in one translation unit
     ErrorCodeRegistry* ErrorCodeRegistry::instance = nullptr;
 }
 using namespace holycpp;
+
+namespace {
+    // Builds registry ids like "T004" for enums declared in registry order
+    std::string sequentialId(char prefix, int index) {
+        const int n = index + 1;
+        return {prefix, static_cast<char>('0' + n / 100 % 10),
+                static_cast<char>('0' + n / 10 % 10), static_cast<char>('0' + n % 10)};
+    }
+    
+    // Severity registered for a code id, so e.g. T011 stays a warning
+    ErrorSeverity registeredSeverity(const std::string& id, ErrorSeverity fallback) {
+        const auto* info = ErrorCodeRegistry::get().find(id);
+        return info ? info->severity : fallback;
+    }
+}
+
 // LexerError implementations
 LexerError::LexerError(Code code, const SourceLocation& loc, 
                        const std::string& extra)
-    : ContextualError(ErrorSeverity::ERROR, "", loc) {
-    
-    std::stringstream ss;
-    ss << codeToString(code);
-    if (!extra.empty()) {
-        ss << ": " << extra;
+    : LexerError(code, loc, DiagArg::text(extra)) {}
+
+LexerError::LexerError(Code code, const SourceLocation& loc, DiagArg extra)
+    : ContextualError(ErrorSeverity::ERROR, "", loc), code(code) {
+    setArgs({extra});
+    errorCode = codeToId(code);
+    severity = registeredSeverity(errorCode, severity);
+}
+
+void LexerError::renderMessage(std::string& out) const {
+    renderWithDetail(out, codeToString(code));
+}
+
+std::string LexerError::codeToId(Code code) {
+    switch (code) {
+        case Code::UNKNOWN_CHAR: return "L001";
+        case Code::UNTERMINATED_STRING: return "L002";
+        case Code::INVALID_NUMBER: return "L003";
+        case Code::UNTERMINATED_CHAR: return "L004";
+        case Code::INVALID_ESCAPE: return "L005";
+        case Code::NUMBER_TOO_LARGE: return "L006";
+        default: return "L000";
     }
-    
-    // Set message by creating a new error (simplified approach)
-    std::string msg = ss.str();
-    // In a real implementation, we'd need to store this differently
 }
 
 std::string LexerError::codeToString(Code code) {
@@ -38,18 +65,31 @@ std::string LexerError::codeToString(Code code) {
 ParserError::ParserError(Code code, const SourceLocation& loc,
                          const std::string& extra,
                          const std::string& expected)
-    : ContextualError(ErrorSeverity::ERROR, "", loc) {
-    
-    std::stringstream ss;
-    ss << codeToString(code);
-    if (!expected.empty()) {
-        ss << ", expected: " << expected;
+    : ParserError(code, loc, DiagArg::text(extra), DiagArg::text(expected)) {}
+
+ParserError::ParserError(Code code, const SourceLocation& loc,
+                         DiagArg extra, DiagArg expected)
+    : ContextualError(ErrorSeverity::ERROR, "", loc), code(code) {
+    setArgs({extra, expected});
+    errorCode = codeToId(code);
+    severity = registeredSeverity(errorCode, severity);
+}
+
+void ParserError::renderMessage(std::string& out) const {
+    out = codeToString(code);
+    if (hasArg(1)) {
+        out += ", expected: ";
+        appendArg(out, 1);
     }
-    if (!extra.empty()) {
-        ss << " (" << extra << ")";
+    if (hasArg(0)) {
+        out += " (";
+        appendArg(out, 0);
+        out += ")";
     }
-    
-    std::string msg = ss.str();
+}
+
+std::string ParserError::codeToId(Code code) {
+    return sequentialId('P', static_cast<int>(code));
 }
 
 std::string ParserError::codeToString(Code code) {
@@ -73,22 +113,35 @@ TypeError::TypeError(Code code, const SourceLocation& loc,
                      const std::string& type1,
                      const std::string& type2,
                      const std::string& extra)
-    : ContextualError(ErrorSeverity::ERROR, "", loc) {
-    
-    std::stringstream ss;
-    ss << codeToString(code);
-    
-    if (!type1.empty() && !type2.empty()) {
-        ss << " (" << type1 << " vs " << type2 << ")";
-    } else if (!type1.empty()) {
-        ss << " (" << type1 << ")";
+    : TypeError(code, loc, DiagArg::text(type1), DiagArg::text(type2), DiagArg::text(extra)) {}
+
+TypeError::TypeError(Code code, const SourceLocation& loc,
+                     DiagArg type1, DiagArg type2, DiagArg extra)
+    : ContextualError(ErrorSeverity::ERROR, "", loc), code(code) {
+    setArgs({type1, type2, extra});
+    errorCode = codeToId(code);
+    severity = registeredSeverity(errorCode, severity);
+}
+
+void TypeError::renderMessage(std::string& out) const {
+    out = codeToString(code);
+    if (hasArg(0)) {
+        out += " (";
+        appendArg(out, 0);
+        if (hasArg(1)) {
+            out += " vs ";
+            appendArg(out, 1);
+        }
+        out += ")";
     }
-    
-    if (!extra.empty()) {
-        ss << ": " << extra;
+    if (hasArg(2)) {
+        out += ": ";
+        appendArg(out, 2);
     }
-    
-    std::string msg = ss.str();
+}
+
+std::string TypeError::codeToId(Code code) {
+    return sequentialId('T', static_cast<int>(code));
 }
 
 std::string TypeError::codeToString(Code code) {
@@ -112,15 +165,21 @@ std::string TypeError::codeToString(Code code) {
 // SemanticError implementations
 SemanticError::SemanticError(Code code, const SourceLocation& loc,
                              const std::string& extra)
-    : ContextualError(ErrorSeverity::ERROR, "", loc) {
-    
-    std::stringstream ss;
-    ss << codeToString(code);
-    if (!extra.empty()) {
-        ss << ": " << extra;
-    }
-    
-    std::string msg = ss.str();
+    : SemanticError(code, loc, DiagArg::text(extra)) {}
+
+SemanticError::SemanticError(Code code, const SourceLocation& loc, DiagArg extra)
+    : ContextualError(ErrorSeverity::ERROR, "", loc), code(code) {
+    setArgs({extra});
+    errorCode = codeToId(code);
+    severity = registeredSeverity(errorCode, severity);
+}
+
+void SemanticError::renderMessage(std::string& out) const {
+    renderWithDetail(out, codeToString(code));
+}
+
+std::string SemanticError::codeToId(Code code) {
+    return sequentialId('S', static_cast<int>(code));
 }
 
 std::string SemanticError::codeToString(Code code) {
@@ -142,15 +201,21 @@ std::string SemanticError::codeToString(Code code) {
 // CodeGenError implementations
 CodeGenError::CodeGenError(Code code, const SourceLocation& loc,
                            const std::string& extra)
-    : ContextualError(ErrorSeverity::FATAL, "", loc) {
-    
-    std::stringstream ss;
-    ss << codeToString(code);
-    if (!extra.empty()) {
-        ss << ": " << extra;
-    }
-    
-    std::string msg = ss.str();
+    : CodeGenError(code, loc, DiagArg::text(extra)) {}
+
+CodeGenError::CodeGenError(Code code, const SourceLocation& loc, DiagArg extra)
+    : ContextualError(ErrorSeverity::FATAL, "", loc), code(code) {
+    setArgs({extra});
+    errorCode = codeToId(code);
+    severity = registeredSeverity(errorCode, severity);
+}
+
+void CodeGenError::renderMessage(std::string& out) const {
+    renderWithDetail(out, codeToString(code));
+}
+
+std::string CodeGenError::codeToId(Code code) {
+    return sequentialId('C', static_cast<int>(code));
 }
 
 std::string CodeGenError::codeToString(Code code) {
@@ -7,6 +7,10 @@
 
 namespace holycpp {
 
+// The specialized errors below store their code and typed arguments; the
+// message text is rendered only when getMessage() or format() needs it. The
+// std::string constructors remain for convenience and copy their text once.
+
 // ==================== Lexer Errors ====================
 class LexerError : public ContextualError {
 public:
@@ -21,8 +25,18 @@ public:
     
     LexerError(Code code, const SourceLocation& loc, 
                const std::string& extra = "");
+    LexerError(Code code, const SourceLocation& loc, DiagArg extra);
+    
+    Code getCode() const { return code; }
     
     static std::string codeToString(Code code);
+    static std::string codeToId(Code code);
+    
+protected:
+    void renderMessage(std::string& out) const override;
+    
+private:
+    Code code;
 };
 
 // ==================== Parser Errors ====================
@@ -44,8 +58,19 @@ public:
     ParserError(Code code, const SourceLocation& loc,
                 const std::string& extra = "",
                 const std::string& expected = "");
+    ParserError(Code code, const SourceLocation& loc,
+                DiagArg extra, DiagArg expected = {});
+    
+    Code getCode() const { return code; }
     
     static std::string codeToString(Code code);
+    static std::string codeToId(Code code);
+    
+protected:
+    void renderMessage(std::string& out) const override;
+    
+private:
+    Code code;
 };
 
 // ==================== Type Errors ====================
@@ -70,8 +95,19 @@ public:
               const std::string& type1 = "",
               const std::string& type2 = "",
               const std::string& extra = "");
+    TypeError(Code code, const SourceLocation& loc,
+              DiagArg type1, DiagArg type2 = {}, DiagArg extra = {});
+    
+    Code getCode() const { return code; }
     
     static std::string codeToString(Code code);
+    static std::string codeToId(Code code);
+    
+protected:
+    void renderMessage(std::string& out) const override;
+    
+private:
+    Code code;
 };
 
 // ==================== Semantic Errors ====================
@@ -92,8 +128,18 @@ public:
     
     SemanticError(Code code, const SourceLocation& loc,
                   const std::string& extra = "");
+    SemanticError(Code code, const SourceLocation& loc, DiagArg extra);
+    
+    Code getCode() const { return code; }
     
     static std::string codeToString(Code code);
+    static std::string codeToId(Code code);
+    
+protected:
+    void renderMessage(std::string& out) const override;
+    
+private:
+    Code code;
 };
 
 // ==================== CodeGen Errors ====================
@@ -112,8 +158,18 @@ public:
     
     CodeGenError(Code code, const SourceLocation& loc,
                  const std::string& extra = "");
+    CodeGenError(Code code, const SourceLocation& loc, DiagArg extra);
+    
+    Code getCode() const { return code; }
     
     static std::string codeToString(Code code);
+    static std::string codeToId(Code code);
+    
+protected:
+    void renderMessage(std::string& out) const override;
+    
+private:
+    Code code;
 };
 
 // ==================== Internal Compiler Errors ====================
@@ -217,10 +273,10 @@ class ErrorCodeRegistry {
     
 public:
     static ErrorCodeRegistry& get() {
-        if (!instance) {
-            instance = new ErrorCodeRegistry();
-        }
-        return *instance;
+        // Function-local static: first use is safe from parallel compile tasks
+        static ErrorCodeRegistry* const registry =
+            instance ? instance : (instance = new ErrorCodeRegistry());
+        return *registry;
     }
     
     void registerError(const std::string& code, 
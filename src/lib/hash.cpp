@@ -0,0 +1,184 @@
+#include "hash.hpp"
+#include "../types/bits.hpp"
+
+#if HOLYC_X86_DISPATCH
+#include <immintrin.h>
+#endif
+
+namespace holycpp {
+namespace hashing {
+
+// ==================== Long Inputs ====================
+// Eight 64-bit lanes take one 64-byte stripe per step: each lane adds its
+// word to the neighbouring lane and the product of the keyed word's two
+// halves to itself. After every 16 stripes the lanes are scrambled. The
+// lanes are independent, so AVX2 runs four at a time with the same result.
+namespace {
+
+constexpr size_t LANES = 8;
+constexpr size_t STRIPE = LANES * sizeof(uint64_t);
+constexpr size_t STRIPES_PER_BLOCK = 16;
+constexpr size_t BLOCK = STRIPE * STRIPES_PER_BLOCK;
+constexpr uint64_t PRIME32 = 0x9E3779B1u;
+
+// Stripe s of a block uses words [s, s + 8); the scramble uses [16, 24)
+constexpr size_t SECRET_WORDS = STRIPES_PER_BLOCK + LANES;
+constexpr size_t SCRAMBLE_KEY = 16;
+constexpr size_t LAST_STRIPE_KEY = 7;
+constexpr size_t MERGE_KEY = 11;
+
+struct Secret {
+    uint64_t words[SECRET_WORDS] = {};
+};
+
+constexpr Secret makeSecret() {
+    Secret secret;
+    uint64_t state = P0;
+    for (size_t i = 0; i < SECRET_WORDS; ++i) {
+        // splitmix64
+        uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        secret.words[i] = z ^ (z >> 31);
+    }
+    return secret;
+}
+
+constexpr Secret SECRET = makeSecret();
+
+struct ScalarLanes {
+    uint64_t acc[LANES];
+
+    explicit ScalarLanes(uint64_t seed) {
+        for (size_t lane = 0; lane < LANES; ++lane) {
+            acc[lane] = SECRET.words[lane] ^ seed;
+        }
+    }
+
+    void accumulate(const uint8_t* p, const uint64_t* key) {
+        for (size_t lane = 0; lane < LANES; ++lane) {
+            const uint64_t word = read64(p + lane * 8);
+            const uint64_t keyed = word ^ key[lane];
+            acc[lane ^ 1] += word;
+            acc[lane] += (keyed & 0xFFFFFFFFu) * (keyed >> 32);
+        }
+    }
+
+    void scramble(const uint64_t* key) {
+        for (size_t lane = 0; lane < LANES; ++lane) {
+            uint64_t a = acc[lane];
+            a ^= a >> 47;
+            a ^= key[lane];
+            acc[lane] = a * PRIME32;
+        }
+    }
+
+    void store(uint64_t* out) const {
+        std::memcpy(out, acc, sizeof(acc));
+    }
+};
+
+#if HOLYC_X86_DISPATCH
+struct Avx2Lanes {
+    __m256i acc[2];
+
+    __attribute__((target("avx2"))) explicit Avx2Lanes(uint64_t seed) {
+        const __m256i seeds = _mm256_set1_epi64x(static_cast<long long>(seed));
+        for (size_t half = 0; half < 2; ++half) {
+            const __m256i words = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(SECRET.words + 4 * half));
+            acc[half] = _mm256_xor_si256(words, seeds);
+        }
+    }
+
+    __attribute__((target("avx2"))) void accumulate(const uint8_t* p, const uint64_t* key) {
+        for (size_t half = 0; half < 2; ++half) {
+            const __m256i words = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + 32 * half));
+            const __m256i keys = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(key + 4 * half));
+            const __m256i keyed = _mm256_xor_si256(words, keys);
+            const __m256i product = _mm256_mul_epu32(keyed, _mm256_srli_epi64(keyed, 32));
+            const __m256i swapped = _mm256_shuffle_epi32(words, _MM_SHUFFLE(1, 0, 3, 2));
+            acc[half] = _mm256_add_epi64(acc[half], _mm256_add_epi64(product, swapped));
+        }
+    }
+
+    __attribute__((target("avx2"))) void scramble(const uint64_t* key) {
+        const __m256i prime = _mm256_set1_epi64x(PRIME32);
+        for (size_t half = 0; half < 2; ++half) {
+            const __m256i keys = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(key + 4 * half));
+            __m256i a = _mm256_xor_si256(acc[half], _mm256_srli_epi64(acc[half], 47));
+            a = _mm256_xor_si256(a, keys);
+            const __m256i low = _mm256_mul_epu32(a, prime);
+            const __m256i high = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), prime);
+            acc[half] = _mm256_add_epi64(low, _mm256_slli_epi64(high, 32));
+        }
+    }
+
+    __attribute__((target("avx2"))) void store(uint64_t* out) const {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), acc[0]);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 4), acc[1]);
+    }
+};
+#endif
+
+template<typename Lanes>
+inline __attribute__((always_inline)) void stripes(Lanes& lanes, const uint8_t* data, size_t length) {
+    const size_t blocks = (length - 1) / BLOCK;
+    for (size_t block = 0; block < blocks; ++block) {
+        const uint8_t* p = data + block * BLOCK;
+        for (size_t s = 0; s < STRIPES_PER_BLOCK; ++s) {
+            lanes.accumulate(p + s * STRIPE, SECRET.words + s);
+        }
+        lanes.scramble(SECRET.words + SCRAMBLE_KEY);
+    }
+    // Whole stripes left, then the last 64 bytes, which may overlap them
+    const size_t tail = (length - 1 - blocks * BLOCK) / STRIPE;
+    for (size_t s = 0; s < tail; ++s) {
+        lanes.accumulate(data + blocks * BLOCK + s * STRIPE, SECRET.words + s);
+    }
+    lanes.accumulate(data + length - STRIPE, SECRET.words + LAST_STRIPE_KEY);
+}
+
+uint64_t merge(const uint64_t* acc, size_t length, uint64_t seed) {
+    uint64_t h = length * P0;
+    for (size_t pair = 0; pair < LANES / 2; ++pair) {
+        h += mix(acc[2 * pair] ^ SECRET.words[MERGE_KEY + 2 * pair],
+                 acc[2 * pair + 1] ^ SECRET.words[MERGE_KEY + 2 * pair + 1]);
+    }
+    h += seed * P3;
+    h ^= h >> 37;
+    h *= 0x165667919E3779F9ull;
+    return h ^ (h >> 32);
+}
+
+#if HOLYC_X86_DISPATCH
+__attribute__((target("avx2")))
+uint64_t hashLongAvx2(const uint8_t* data, size_t length, uint64_t seed) {
+    Avx2Lanes lanes(seed);
+    stripes(lanes, data, length);
+    uint64_t acc[LANES];
+    lanes.store(acc);
+    return merge(acc, length, seed);
+}
+#endif
+
+} // namespace
+
+uint64_t hashLongScalar(const uint8_t* data, size_t length, uint64_t seed) {
+    ScalarLanes lanes(seed);
+    stripes(lanes, data, length);
+    uint64_t acc[LANES];
+    lanes.store(acc);
+    return merge(acc, length, seed);
+}
+
+uint64_t hashLong(const uint8_t* data, size_t length, uint64_t seed) {
+#if HOLYC_X86_DISPATCH
+    if (bits::cpuHasAvx2()) {
+        return hashLongAvx2(data, length, seed);
+    }
+#endif
+    return hashLongScalar(data, length, seed);
+}
+
+} // namespace hashing
+} // namespace holycpp
@@ -0,0 +1,231 @@
+#pragma once
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <string_view>
+#include <utility>
+#include "../types/union_type.hpp"
+
+namespace holycpp {
+
+// ==================== Hash Primitives ====================
+// Non-cryptographic 64-bit hashing. Short inputs go through a
+// wyhash-style path built on one 64x64->128 multiply per 16 bytes. Inputs
+// of LONG_INPUT bytes or more go to hashing::hashLong(), an XXH3-style
+// stripe accumulator that uses AVX2 when the CPU has it. The SIMD and
+// scalar paths give identical hashes. Results are stable across runs and
+// machines for the same seed, but nothing here resists hash flooding.
+namespace hashing {
+
+constexpr uint64_t P0 = 0xa0761d6478bd642full;
+constexpr uint64_t P1 = 0xe7037ed1a0b428dbull;
+constexpr uint64_t P2 = 0x8ebc6af09c88c6e3ull;
+constexpr uint64_t P3 = 0x589965cc75374cc3ull;
+
+constexpr size_t LONG_INPUT = 512;
+
+// Both halves of the 128-bit product, folded together
+inline uint64_t mix(uint64_t a, uint64_t b) {
+    const __uint128_t product = static_cast<__uint128_t>(a) * b;
+    return static_cast<uint64_t>(product) ^ static_cast<uint64_t>(product >> 64);
+}
+
+inline uint64_t read64(const uint8_t* p) {
+    uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint64_t read32(const uint8_t* p) {
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+uint64_t hashLong(const uint8_t* data, size_t length, uint64_t seed);
+uint64_t hashLongScalar(const uint8_t* data, size_t length, uint64_t seed);
+
+} // namespace hashing
+
+inline uint64_t hashBytes(const void* data, size_t length, uint64_t seed = 0) {
+    using namespace hashing;
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    if (length >= LONG_INPUT) {
+        return hashLong(p, length, seed);
+    }
+
+    seed ^= mix(seed ^ P0, P1);
+    uint64_t a, b;
+    if (length <= 16) {
+        if (length >= 4) {
+            const size_t middle = (length >> 3) << 2;
+            a = (read32(p) << 32) | read32(p + middle);
+            b = (read32(p + length - 4) << 32) | read32(p + length - 4 - middle);
+        } else if (length > 0) {
+            a = (uint64_t(p[0]) << 16) | (uint64_t(p[length >> 1]) << 8) | p[length - 1];
+            b = 0;
+        } else {
+            a = b = 0;
+        }
+    } else {
+        size_t remaining = length;
+        if (remaining > 48) {
+            uint64_t lane1 = seed, lane2 = seed;
+            do {
+                seed = mix(read64(p) ^ P1, read64(p + 8) ^ seed);
+                lane1 = mix(read64(p + 16) ^ P2, read64(p + 24) ^ lane1);
+                lane2 = mix(read64(p + 32) ^ P3, read64(p + 40) ^ lane2);
+                p += 48;
+                remaining -= 48;
+            } while (remaining > 48);
+            seed ^= lane1 ^ lane2;
+        }
+        while (remaining > 16) {
+            seed = mix(read64(p) ^ P1, read64(p + 8) ^ seed);
+            p += 16;
+            remaining -= 16;
+        }
+        a = read64(p + remaining - 16);
+        b = read64(p + remaining - 8);
+    }
+    a ^= P1;
+    b ^= seed;
+    const __uint128_t product = static_cast<__uint128_t>(a) * b;
+    return mix(static_cast<uint64_t>(product) ^ P0 ^ length, static_cast<uint64_t>(product >> 64) ^ P1);
+}
+
+inline uint64_t hashBytes(std::string_view text, uint64_t seed = 0) {
+    return hashBytes(text.data(), text.size(), seed);
+}
+
+// Order matters: hashCombine(a, b) != hashCombine(b, a)
+inline uint64_t hashCombine(uint64_t first, uint64_t second) {
+    return hashing::mix(first ^ hashing::P0, second ^ hashing::P2);
+}
+
+// ==================== Integer Mixers ====================
+// Up to 32 bits one widening multiply spreads the input; 64-bit inputs
+// take two 128-bit folds, since one leaves the top input bits reaching
+// only a few output bits. Every output bit depends on every input bit.
+inline uint64_t hashInt(uint32_t value, uint64_t seed = 0) {
+    uint64_t h = (value ^ seed) * 0x9E3779B97F4A7C15ull;
+    h = (h ^ (h >> 32)) * hashing::P1;
+    return h ^ (h >> 29);
+}
+
+inline uint64_t hashInt(uint64_t value, uint64_t seed = 0) {
+    return hashing::mix(hashing::mix(value ^ seed ^ hashing::P0, hashing::P1) ^ hashing::P2, hashing::P3);
+}
+
+// ==================== HolyC Values ====================
+// Equal values hash equally: FInt maps -0.0 to +0.0 and every NaN to one
+// quiet NaN first. Union and Value hash their active type with its value.
+template<size_t Bits, typename Policy>
+uint64_t hash(const UInt<Bits, Policy>& value, uint64_t seed = 0) {
+    if constexpr (Bits <= 32) {
+        return hashInt(static_cast<uint32_t>(value.raw()), seed);
+    } else {
+        return hashInt(static_cast<uint64_t>(value.raw()), seed);
+    }
+}
+
+template<size_t Bits, typename Policy>
+uint64_t hash(const SInt<Bits, Policy>& value, uint64_t seed = 0) {
+    return hash(value.as_unsigned(), seed);
+}
+
+template<size_t Bits>
+uint64_t hash(const FInt<Bits>& value, uint64_t seed = 0) {
+    using Raw = typename FInt<Bits>::storage_type;
+    Raw raw = value.raw();
+    if (raw == Raw(0)) {
+        raw = Raw(0);
+    } else if (std::isnan(raw)) {
+        raw = std::numeric_limits<Raw>::quiet_NaN();
+    }
+    if constexpr (sizeof(Raw) == 4) {
+        uint32_t bits;
+        std::memcpy(&bits, &raw, sizeof(bits));
+        return hashInt(bits, seed);
+    } else {
+        uint64_t bits;
+        std::memcpy(&bits, &raw, sizeof(bits));
+        return hashInt(bits, seed);
+    }
+}
+
+inline uint64_t hash(const U0&, uint64_t seed = 0) {
+    return hashInt(uint64_t(0), seed ^ hashing::P3);
+}
+
+// Pointers hash by address
+inline uint64_t hash(const void* pointer, uint64_t seed = 0) {
+    return hashInt(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(pointer)), seed);
+}
+
+inline uint64_t hash(std::string_view text, uint64_t seed = 0) {
+    return hashBytes(text, seed);
+}
+
+inline uint64_t hash(const Value& value, uint64_t seed = 0) {
+    uint64_t payload;
+    switch (value.type) {
+        case FLOAT_TYPE: payload = hash(value.f, seed); break;
+        case CHAR_TYPE:  payload = hash(value.ch, seed); break;
+        case VALUE_TYPE: payload = hash(static_cast<const void*>(value.val), seed); break;
+        case INT_TYPE:   payload = hash(value.i, seed); break;
+        case UINT_TYPE:  payload = hash(value.u, seed); break;
+        default:         payload = seed; break;
+    }
+    return hashCombine(static_cast<uint64_t>(value.type), payload);
+}
+
+namespace hashing {
+
+template<typename Un, typename... Types, size_t... I>
+uint64_t hashActive(const Un& value, uint64_t seed, std::index_sequence<I...>) {
+    uint64_t payload = seed;
+    ((value.active() == static_cast<int>(I) ? (payload = hash(value.template as<Types>(), seed), 0) : 0), ...);
+    return payload;
+}
+
+} // namespace hashing
+
+template<typename... Types>
+uint64_t hash(const Union<Types...>& value, uint64_t seed = 0) {
+    const uint64_t payload = hashing::hashActive<Union<Types...>, Types...>(
+        value, seed, std::index_sequence_for<Types...>{});
+    return hashCombine(static_cast<uint64_t>(value.active()), payload);
+}
+
+// For unordered containers: std::unordered_map<I64, V, holycpp::Hash>
+struct Hash {
+    template<typename T>
+    size_t operator()(const T& value) const {
+        return static_cast<size_t>(hash(value));
+    }
+};
+
+} // namespace holycpp
+
+namespace std {
+
+template<size_t Bits, typename Policy>
+struct hash<holycpp::UInt<Bits, Policy>> : holycpp::Hash {};
+
+template<size_t Bits, typename Policy>
+struct hash<holycpp::SInt<Bits, Policy>> : holycpp::Hash {};
+
+template<size_t Bits>
+struct hash<holycpp::FInt<Bits>> : holycpp::Hash {};
+
+template<>
+struct hash<holycpp::Value> : holycpp::Hash {};
+
+template<typename... Types>
+struct hash<holycpp::Union<Types...>> : holycpp::Hash {};
+
+} // namespace std
@@ -0,0 +1,396 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include "hash.hpp"
+#include "../types/bits.hpp"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace holycpp {
+
+namespace hashmap {
+
+// ==================== Stored Keys ====================
+// Integer and float wrappers are stored as their storage_type, so a key
+// array of I32 is a plain int32_t array and compares with one instruction.
+// Lookups take a Lookup key, which lets string-keyed maps be probed with a
+// std::string_view without building a std::string.
+template<typename K>
+struct KeySlot {
+    using Stored = K;
+    using Lookup = const K&;
+    static const Stored& store(const K& key) { return key; }
+    static const K& load(const Stored& stored) { return stored; }
+    static bool equal(const Stored& stored, Lookup key) { return stored == key; }
+};
+
+template<size_t Bits, typename Policy>
+struct KeySlot<UInt<Bits, Policy>> {
+    using Key = UInt<Bits, Policy>;
+    using Stored = typename Key::storage_type;
+    using Lookup = Key;
+    static Stored store(Key key) { return key.raw(); }
+    static Key load(Stored stored) { return Key(stored); }
+    static bool equal(Stored stored, Key key) { return stored == key.raw(); }
+};
+
+template<size_t Bits, typename Policy>
+struct KeySlot<SInt<Bits, Policy>> {
+    using Key = SInt<Bits, Policy>;
+    using Stored = typename Key::storage_type;
+    using Lookup = Key;
+    static Stored store(Key key) { return key.raw(); }
+    static Key load(Stored stored) { return Key(stored); }
+    static bool equal(Stored stored, Key key) { return stored == key.raw(); }
+};
+
+// Stored doubles compare with ==, like FInt: -0.0 finds +0.0, NaN finds nothing
+template<size_t Bits>
+struct KeySlot<FInt<Bits>> {
+    using Key = FInt<Bits>;
+    using Stored = typename Key::storage_type;
+    using Lookup = Key;
+    static Stored store(Key key) { return key.raw(); }
+    static Key load(Stored stored) { return Key(stored); }
+    static bool equal(Stored stored, Key key) { return stored == key.raw(); }
+};
+
+template<>
+struct KeySlot<std::string> {
+    using Stored = std::string;
+    using Lookup = std::string_view;
+    static const Stored& store(const std::string& key) { return key; }
+    static std::string_view load(const Stored& stored) { return stored; }
+    static bool equal(const Stored& stored, std::string_view key) { return stored == key; }
+};
+
+// ==================== Control Bytes ====================
+// One byte per slot: EMPTY, DELETED, or the low 7 bits of a full slot's
+// hash. Slots come in aligned groups of 16 whose bytes are matched at once
+// (SSE2 on x86-64, a byte loop elsewhere), so a probe checks 16 candidates
+// per step and compares keys only on a 7-bit match.
+constexpr int8_t EMPTY = -128;
+constexpr int8_t DELETED = -2;
+constexpr size_t GROUP = 16;
+
+struct Group {
+#if defined(__SSE2__)
+    __m128i bytes;
+
+    explicit Group(const int8_t* ctrl) : bytes(_mm_load_si128(reinterpret_cast<const __m128i*>(ctrl))) {}
+
+    uint32_t match(int8_t h2) const {
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), bytes)));
+    }
+    uint32_t matchEmpty() const { return match(EMPTY); }
+    // EMPTY and DELETED are the only negative bytes
+    uint32_t matchFree() const { return static_cast<uint32_t>(_mm_movemask_epi8(bytes)); }
+#else
+    const int8_t* ctrl;
+
+    explicit Group(const int8_t* ctrl) : ctrl(ctrl) {}
+
+    uint32_t match(int8_t h2) const {
+        uint32_t mask = 0;
+        for (size_t i = 0; i < GROUP; ++i) {
+            mask |= static_cast<uint32_t>(ctrl[i] == h2) << i;
+        }
+        return mask;
+    }
+    uint32_t matchEmpty() const { return match(EMPTY); }
+    uint32_t matchFree() const {
+        uint32_t mask = 0;
+        for (size_t i = 0; i < GROUP; ++i) {
+            mask |= static_cast<uint32_t>(ctrl[i] < 0) << i;
+        }
+        return mask;
+    }
+#endif
+};
+
+} // namespace hashmap
+
+// ==================== Flat Hash Map ====================
+// Open addressing over groups of 16 slots, Swiss-table style. Control
+// bytes, keys and values live in three separate arrays: probes read only
+// control bytes and keys, and a key array holds no padding from the
+// values. The probe visits groups in triangular order (1, 2, 3, ... groups
+// further each step), which covers every group of a power-of-two table.
+//
+// The table grows by doubling once 7/8 of its slots are full or deleted.
+// erase() leaves an EMPTY byte when the slot's group still has one, since
+// no probe can have passed such a group, and a DELETED byte otherwise.
+//
+// Pointers returned by find()/insert() stay valid until the next insert
+// that grows or rehashes the table; erase() never moves other entries.
+template<typename K, typename V, typename H = Hash>
+class HashMap {
+    using Slot = hashmap::KeySlot<K>;
+    using Stored = typename Slot::Stored;
+    using Lookup = typename Slot::Lookup;
+
+public:
+    HashMap() = default;
+    explicit HashMap(size_t expected) { reserve(expected); }
+    ~HashMap() { release(); }
+
+    HashMap(const HashMap& other) : hasher(other.hasher) {
+        reserve(other.count);
+        other.forEach([this](const auto& key, const V& value) { emplace(key, value); });
+    }
+
+    HashMap(HashMap&& other) noexcept { steal(other); }
+
+    HashMap& operator=(const HashMap& other) {
+        if (this != &other) {
+            HashMap copy(other);
+            release();
+            steal(copy);
+        }
+        return *this;
+    }
+
+    HashMap& operator=(HashMap&& other) noexcept {
+        if (this != &other) {
+            release();
+            steal(other);
+        }
+        return *this;
+    }
+
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    size_t capacity() const { return slots; }
+
+    // Null if the key is absent
+    V* find(Lookup key) { return locate(key, hashOf(key)); }
+    const V* find(Lookup key) const { return const_cast<HashMap*>(this)->find(key); }
+    bool contains(Lookup key) const { return find(key) != nullptr; }
+
+    V& at(Lookup key) {
+        V* value = find(key);
+        if (!value) {
+            throw std::out_of_range("HashMap::at: key not found");
+        }
+        return *value;
+    }
+    const V& at(Lookup key) const { return const_cast<HashMap*>(this)->at(key); }
+
+    // Inserts V(args...) unless the key is present; returns the entry and
+    // whether it was inserted
+    template<typename... Args>
+    std::pair<V*, bool> emplace(Lookup key, Args&&... args) {
+        const size_t h = hashOf(key);
+        if (V* existing = locate(key, h)) {
+            return {existing, false};
+        }
+        const size_t index = claim(h);
+        new (&keys[index]) Stored(Slot::store(K(key)));
+        new (&values[index]) V(std::forward<Args>(args)...);
+        return {&values[index], true};
+    }
+
+    std::pair<V*, bool> insert(Lookup key, const V& value) { return emplace(key, value); }
+    std::pair<V*, bool> insert(Lookup key, V&& value) { return emplace(key, std::move(value)); }
+
+    // Replaces the value if the key is present
+    V& assign(Lookup key, V value) {
+        auto [entry, inserted] = emplace(key, std::move(value));
+        if (!inserted) {
+            *entry = std::move(value);
+        }
+        return *entry;
+    }
+
+    V& operator[](Lookup key) { return *emplace(key).first; }
+
+    bool erase(Lookup key) {
+        V* value = find(key);
+        if (!value) {
+            return false;
+        }
+        const size_t index = static_cast<size_t>(value - values);
+        const size_t group = index & ~(hashmap::GROUP - 1);
+        const bool keepProbing = hashmap::Group(ctrl + group).matchEmpty() == 0;
+        ctrl[index] = keepProbing ? hashmap::DELETED : hashmap::EMPTY;
+        tombstones += keepProbing;
+        keys[index].~Stored();
+        values[index].~V();
+        --count;
+        return true;
+    }
+
+    void clear() {
+        destroyEntries();
+        if (slots) {
+            std::memset(ctrl, static_cast<uint8_t>(hashmap::EMPTY), slots);
+        }
+        count = tombstones = 0;
+    }
+
+    // Makes room for `expected` entries without growing
+    void reserve(size_t expected) {
+        size_t needed = hashmap::GROUP;
+        while (needed / 8 * 7 < expected) {
+            needed *= 2;
+        }
+        if (needed > slots) {
+            rehash(needed);
+        }
+    }
+
+    // fn(key, value) for every entry, in table order; string keys are
+    // passed as std::string_view
+    template<typename F>
+    void forEach(F fn) {
+        for (size_t i = 0; i < slots; ++i) {
+            if (ctrl[i] >= 0) {
+                fn(Slot::load(keys[i]), values[i]);
+            }
+        }
+    }
+
+    template<typename F>
+    void forEach(F fn) const {
+        for (size_t i = 0; i < slots; ++i) {
+            if (ctrl[i] >= 0) {
+                fn(Slot::load(keys[i]), static_cast<const V&>(values[i]));
+            }
+        }
+    }
+
+private:
+    int8_t* ctrl = nullptr;
+    Stored* keys = nullptr;
+    V* values = nullptr;
+    size_t slots = 0;        // Power of two, a multiple of GROUP, or 0
+    size_t count = 0;
+    size_t tombstones = 0;
+    H hasher;
+
+    size_t hashOf(Lookup key) const { return static_cast<size_t>(hasher(key)); }
+
+    static int8_t h2(size_t h) { return static_cast<int8_t>(h & 0x7F); }
+
+    template<typename F>
+    size_t probe(size_t h, F visit) const {
+        const size_t groupMask = slots / hashmap::GROUP - 1;
+        size_t group = (h >> 7) & groupMask;
+        for (size_t step = 1;; ++step) {
+            const size_t base = group * hashmap::GROUP;
+            const size_t found = visit(base, hashmap::Group(ctrl + base));
+            if (found != SIZE_MAX) {
+                return found;
+            }
+            group = (group + step) & groupMask;
+        }
+    }
+
+    V* locate(Lookup key, size_t h) const {
+        if (count == 0) {
+            return nullptr;
+        }
+        const size_t index = probe(h, [&](size_t base, const hashmap::Group& group) -> size_t {
+            for (uint32_t mask = group.match(h2(h)); mask; mask &= mask - 1) {
+                const size_t i = base + static_cast<size_t>(bits::countTrailingZeros(mask));
+                if (Slot::equal(keys[i], key)) {
+                    return i;
+                }
+            }
+            return group.matchEmpty() ? slots : SIZE_MAX;
+        });
+        return index == slots ? nullptr : &values[index];
+    }
+
+    // A free slot for hash h, growing first if the table is at its load limit
+    size_t claim(size_t h) {
+        if (slots == 0 || (count + tombstones + 1) > slots / 8 * 7) {
+            // Mostly tombstones: rehash in place; otherwise double
+            rehash(slots == 0 ? hashmap::GROUP : (count * 2 < slots / 8 * 7 ? slots : slots * 2));
+        }
+        const size_t index = probe(h, [](size_t base, const hashmap::Group& group) -> size_t {
+            const uint32_t mask = group.matchFree();
+            return mask ? base + static_cast<size_t>(bits::countTrailingZeros(mask)) : SIZE_MAX;
+        });
+        tombstones -= ctrl[index] == hashmap::DELETED;
+        ctrl[index] = h2(h);
+        ++count;
+        return index;
+    }
+
+    void rehash(size_t newSlots) {
+        int8_t* oldCtrl = ctrl;
+        Stored* oldKeys = keys;
+        V* oldValues = values;
+        const size_t oldSlots = slots;
+
+        ctrl = static_cast<int8_t*>(::operator new(newSlots, std::align_val_t(hashmap::GROUP)));
+        keys = static_cast<Stored*>(::operator new(newSlots * sizeof(Stored), std::align_val_t(alignof(Stored))));
+        values = static_cast<V*>(::operator new(newSlots * sizeof(V), std::align_val_t(alignof(V))));
+        std::memset(ctrl, static_cast<uint8_t>(hashmap::EMPTY), newSlots);
+        slots = newSlots;
+        count = tombstones = 0;
+
+        for (size_t i = 0; i < oldSlots; ++i) {
+            if (oldCtrl[i] >= 0) {
+                const size_t h = hashOf(Slot::load(oldKeys[i]));
+                const size_t index = claim(h);
+                new (&keys[index]) Stored(std::move(oldKeys[i]));
+                new (&values[index]) V(std::move(oldValues[i]));
+                oldKeys[i].~Stored();
+                oldValues[i].~V();
+            }
+        }
+        freeArrays(oldCtrl, oldKeys, oldValues);
+    }
+
+    void destroyEntries() {
+        if constexpr (!std::is_trivially_destructible_v<Stored> || !std::is_trivially_destructible_v<V>) {
+            for (size_t i = 0; i < slots; ++i) {
+                if (ctrl[i] >= 0) {
+                    keys[i].~Stored();
+                    values[i].~V();
+                }
+            }
+        }
+    }
+
+    static void freeArrays(int8_t* c, Stored* k, V* v) {
+        if (c) {
+            ::operator delete(c, std::align_val_t(hashmap::GROUP));
+            ::operator delete(k, std::align_val_t(alignof(Stored)));
+            ::operator delete(v, std::align_val_t(alignof(V)));
+        }
+    }
+
+    void release() {
+        destroyEntries();
+        freeArrays(ctrl, keys, values);
+        ctrl = nullptr;
+        keys = nullptr;
+        values = nullptr;
+        slots = count = tombstones = 0;
+    }
+
+    void steal(HashMap& other) {
+        ctrl = std::exchange(other.ctrl, nullptr);
+        keys = std::exchange(other.keys, nullptr);
+        values = std::exchange(other.values, nullptr);
+        slots = std::exchange(other.slots, 0);
+        count = std::exchange(other.count, 0);
+        tombstones = std::exchange(other.tombstones, 0);
+        hasher = other.hasher;
+    }
+};
+
+} // namespace holycpp
@@ -0,0 +1,128 @@
+#include "bytecode.hpp"
+#include <sstream>
+
+namespace holycpp {
+
+const char* opCodeName(OpCode op) {
+    switch (op) {
+        case OpCode::LOAD_CONST: return "LOAD_CONST";
+        case OpCode::MOVE: return "MOVE";
+        case OpCode::ADD_I64: return "ADD_I64";
+        case OpCode::SUB_I64: return "SUB_I64";
+        case OpCode::MUL_I64: return "MUL_I64";
+        case OpCode::DIV_I64: return "DIV_I64";
+        case OpCode::MOD_I64: return "MOD_I64";
+        case OpCode::AND_I64: return "AND_I64";
+        case OpCode::OR_I64: return "OR_I64";
+        case OpCode::XOR_I64: return "XOR_I64";
+        case OpCode::SHL_I64: return "SHL_I64";
+        case OpCode::SHR_I64: return "SHR_I64";
+        case OpCode::ADD_F64: return "ADD_F64";
+        case OpCode::SUB_F64: return "SUB_F64";
+        case OpCode::MUL_F64: return "MUL_F64";
+        case OpCode::DIV_F64: return "DIV_F64";
+        case OpCode::LT_I64: return "LT_I64";
+        case OpCode::LE_I64: return "LE_I64";
+        case OpCode::EQ_I64: return "EQ_I64";
+        case OpCode::NE_I64: return "NE_I64";
+        case OpCode::LT_F64: return "LT_F64";
+        case OpCode::LE_F64: return "LE_F64";
+        case OpCode::I64_TO_F64: return "I64_TO_F64";
+        case OpCode::F64_TO_I64: return "F64_TO_I64";
+        case OpCode::JUMP: return "JUMP";
+        case OpCode::JUMP_IF: return "JUMP_IF";
+        case OpCode::JUMP_IF_NOT: return "JUMP_IF_NOT";
+        case OpCode::RETURN: return "RETURN";
+        default: return "UNKNOWN";
+    }
+}
+
+bool verifyFunction(const Function& fn, std::string& reason) {
+    std::stringstream ss;
+
+    if (fn.numRegs <= 0 || fn.numRegs > 256) {
+        ss << "register count " << fn.numRegs << " outside 1..256";
+        reason = ss.str();
+        return false;
+    }
+    if (fn.numParams < 0 || fn.numParams > fn.numRegs) {
+        ss << "parameter count " << fn.numParams << " exceeds register count";
+        reason = ss.str();
+        return false;
+    }
+    if (fn.code.empty()) {
+        reason = "function has no instructions";
+        return false;
+    }
+
+    const int count = static_cast<int>(fn.code.size());
+    for (int pc = 0; pc < count; ++pc) {
+        const Instruction& ins = fn.code[pc];
+
+        if (ins.op > OpCode::RETURN) {
+            ss << "unknown opcode " << static_cast<int>(ins.op) << " at pc " << pc;
+            reason = ss.str();
+            return false;
+        }
+
+        bool badReg = false;
+        if (writesDst(ins.op) && ins.dst >= fn.numRegs) badReg = true;
+        if ((isUnaryOp(ins.op) || isBinaryOp(ins.op) || ins.op == OpCode::JUMP_IF ||
+             ins.op == OpCode::JUMP_IF_NOT || ins.op == OpCode::RETURN) &&
+            ins.a >= fn.numRegs) badReg = true;
+        if (isBinaryOp(ins.op) && ins.b >= fn.numRegs) badReg = true;
+        if (badReg) {
+            ss << "register out of range in " << opCodeName(ins.op) << " at pc " << pc;
+            reason = ss.str();
+            return false;
+        }
+
+        if (ins.op == OpCode::LOAD_CONST &&
+            (ins.imm < 0 || ins.imm >= static_cast<int>(fn.constants.size()))) {
+            ss << "constant index " << ins.imm << " out of range at pc " << pc;
+            reason = ss.str();
+            return false;
+        }
+
+        if (isBranch(ins.op) && (ins.imm < 0 || ins.imm >= count)) {
+            ss << "jump target " << ins.imm << " out of range at pc " << pc;
+            reason = ss.str();
+            return false;
+        }
+    }
+
+    if (!isTerminator(fn.code.back().op)) {
+        reason = "control falls off the end of the function";
+        return false;
+    }
+
+    return true;
+}
+
+std::string disassemble(const Function& fn) {
+    std::stringstream ss;
+    ss << fn.name << " (params " << fn.numParams << ", regs " << fn.numRegs << ")\n";
+
+    for (size_t pc = 0; pc < fn.code.size(); ++pc) {
+        const Instruction& ins = fn.code[pc];
+        ss << "  " << pc << ": " << opCodeName(ins.op);
+
+        if (ins.op == OpCode::LOAD_CONST) {
+            ss << " r" << int(ins.dst) << ", #" << ins.imm;
+        } else if (isBinaryOp(ins.op)) {
+            ss << " r" << int(ins.dst) << ", r" << int(ins.a) << ", r" << int(ins.b);
+        } else if (isUnaryOp(ins.op)) {
+            ss << " r" << int(ins.dst) << ", r" << int(ins.a);
+        } else if (ins.op == OpCode::JUMP) {
+            ss << " @" << ins.imm;
+        } else if (ins.op == OpCode::JUMP_IF || ins.op == OpCode::JUMP_IF_NOT) {
+            ss << " r" << int(ins.a) << ", @" << ins.imm;
+        } else if (ins.op == OpCode::RETURN) {
+            ss << " r" << int(ins.a);
+        }
+        ss << "\n";
+    }
+    return ss.str();
+}
+
+} // namespace holycpp
@@ -0,0 +1,182 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "../types/signed_int.hpp"
+#include "../types/float.hpp"
+#include "../lib/error.hpp"
+
+namespace holycpp {
+
+// ==================== Register Value ====================
+// Untyped 64-bit register. The opcode decides whether the I64 or the
+// F64 view is live, exactly like the anonymous union in HolyC's Value.
+union Reg {
+    int64_t i;
+    double f;
+
+    static Reg ofInt(int64_t v) { Reg r; r.i = v; return r; }
+    static Reg ofFloat(double v) { Reg r; r.f = v; return r; }
+};
+
+static_assert(sizeof(Reg) == 8, "Reg must be a single 64-bit slot");
+
+// ==================== Opcodes ====================
+enum class OpCode : uint8_t {
+    LOAD_CONST,     // dst = constants[imm]
+    MOVE,           // dst = a
+
+    // I64 arithmetic (HolyC I64 semantics: wrapping + - *, checked / % << >>)
+    ADD_I64, SUB_I64, MUL_I64, DIV_I64, MOD_I64,
+    AND_I64, OR_I64, XOR_I64, SHL_I64, SHR_I64,
+
+    // F64 arithmetic (F64 semantics: / throws on zero divisor)
+    ADD_F64, SUB_F64, MUL_F64, DIV_F64,
+
+    // Comparisons produce an I64 0/1
+    LT_I64, LE_I64, EQ_I64, NE_I64,
+    LT_F64, LE_F64,
+
+    // Conversions
+    I64_TO_F64, F64_TO_I64,
+
+    // Control flow (imm = target instruction index)
+    JUMP, JUMP_IF, JUMP_IF_NOT,
+    RETURN          // return a
+};
+
+const char* opCodeName(OpCode op);
+
+// ==================== Instruction ====================
+struct Instruction {
+    OpCode op;
+    uint8_t dst = 0;
+    uint8_t a = 0;
+    uint8_t b = 0;
+    int32_t imm = 0;
+
+    static Instruction make(OpCode op, uint8_t dst = 0, uint8_t a = 0,
+                            uint8_t b = 0, int32_t imm = 0) {
+        Instruction ins;
+        ins.op = op;
+        ins.dst = dst;
+        ins.a = a;
+        ins.b = b;
+        ins.imm = imm;
+        return ins;
+    }
+
+    bool operator==(const Instruction& other) const {
+        return op == other.op && dst == other.dst && a == other.a &&
+               b == other.b && imm == other.imm;
+    }
+    bool operator!=(const Instruction& other) const { return !(*this == other); }
+};
+
+// ==================== Function ====================
+// A HolyC function lowered to register bytecode. Parameters arrive in
+// registers 0..numParams-1; every other register starts zeroed.
+struct Function {
+    std::string name;
+    int numParams = 0;
+    int numRegs = 0;
+    std::vector<Instruction> code;
+    std::vector<Reg> constants;
+    SourceLocation location;
+
+    int addConstant(Reg value) {
+        constants.push_back(value);
+        return static_cast<int>(constants.size()) - 1;
+    }
+
+    Function& emit(OpCode op, uint8_t dst = 0, uint8_t a = 0,
+                   uint8_t b = 0, int32_t imm = 0) {
+        code.push_back(Instruction::make(op, dst, a, b, imm));
+        return *this;
+    }
+};
+
+// ==================== Opcode Properties ====================
+inline bool isBinaryOp(OpCode op) {
+    return op >= OpCode::ADD_I64 && op <= OpCode::LE_F64;
+}
+
+inline bool isUnaryOp(OpCode op) {
+    return op == OpCode::MOVE || op == OpCode::I64_TO_F64 || op == OpCode::F64_TO_I64;
+}
+
+inline bool isBranch(OpCode op) {
+    return op == OpCode::JUMP || op == OpCode::JUMP_IF || op == OpCode::JUMP_IF_NOT;
+}
+
+inline bool isTerminator(OpCode op) {
+    return op == OpCode::JUMP || op == OpCode::RETURN;
+}
+
+inline bool writesDst(OpCode op) {
+    return op == OpCode::LOAD_CONST || isUnaryOp(op) || isBinaryOp(op);
+}
+
+// ==================== Shared Evaluation ====================
+// Every execution tier (interpreter, compiled code, constant folder) goes
+// through these helpers, so all of them agree bit for bit. Errors surface as
+// the same std exceptions the HolyC types throw.
+inline Reg evalBinary(OpCode op, Reg lhs, Reg rhs) {
+    const uint64_t ul = static_cast<uint64_t>(lhs.i);
+    const uint64_t ur = static_cast<uint64_t>(rhs.i);
+
+    switch (op) {
+        // Two's complement wrap-around, as HolyC does (no UB on overflow)
+        case OpCode::ADD_I64: return Reg::ofInt(static_cast<int64_t>(ul + ur));
+        case OpCode::SUB_I64: return Reg::ofInt(static_cast<int64_t>(ul - ur));
+        case OpCode::MUL_I64: return Reg::ofInt(static_cast<int64_t>(ul * ur));
+        case OpCode::DIV_I64: return Reg::ofInt((I64(lhs.i) / I64(rhs.i)).raw());
+        case OpCode::MOD_I64: return Reg::ofInt((I64(lhs.i) % I64(rhs.i)).raw());
+        case OpCode::AND_I64: return Reg::ofInt(lhs.i & rhs.i);
+        case OpCode::OR_I64:  return Reg::ofInt(lhs.i | rhs.i);
+        case OpCode::XOR_I64: return Reg::ofInt(lhs.i ^ rhs.i);
+        case OpCode::SHL_I64: return Reg::ofInt((I64(lhs.i) << I64(rhs.i)).raw());
+        case OpCode::SHR_I64: return Reg::ofInt((I64(lhs.i) >> I64(rhs.i)).raw());
+
+        case OpCode::ADD_F64: return Reg::ofFloat((F64(lhs.f) + F64(rhs.f)).raw());
+        case OpCode::SUB_F64: return Reg::ofFloat((F64(lhs.f) - F64(rhs.f)).raw());
+        case OpCode::MUL_F64: return Reg::ofFloat((F64(lhs.f) * F64(rhs.f)).raw());
+        case OpCode::DIV_F64: return Reg::ofFloat((F64(lhs.f) / F64(rhs.f)).raw());
+
+        case OpCode::LT_I64: return Reg::ofInt(lhs.i < rhs.i);
+        case OpCode::LE_I64: return Reg::ofInt(lhs.i <= rhs.i);
+        case OpCode::EQ_I64: return Reg::ofInt(lhs.i == rhs.i);
+        case OpCode::NE_I64: return Reg::ofInt(lhs.i != rhs.i);
+        case OpCode::LT_F64: return Reg::ofInt(lhs.f < rhs.f);
+        case OpCode::LE_F64: return Reg::ofInt(lhs.f <= rhs.f);
+
+        default:
+            throw std::invalid_argument("Not a binary opcode");
+    }
+}
+
+inline Reg evalUnary(OpCode op, Reg operand) {
+    switch (op) {
+        case OpCode::MOVE: return operand;
+        case OpCode::I64_TO_F64: return Reg::ofFloat(F64(I64(operand.i)).raw());
+        case OpCode::F64_TO_I64:
+            // NaN and out-of-range values fail both comparisons
+            if (!(operand.f >= -9223372036854775808.0 && operand.f < 9223372036854775808.0)) {
+                throw std::out_of_range("F64 value out of range for I64");
+            }
+            return Reg::ofInt(static_cast<int64_t>(operand.f));
+        default:
+            throw std::invalid_argument("Not a unary opcode");
+    }
+}
+
+// ==================== Verification ====================
+// Checks register, constant and jump-target ranges and that control cannot
+// fall off the end. Returns false and fills `reason` on the first problem.
+bool verifyFunction(const Function& fn, std::string& reason);
+
+// Human-readable listing, one instruction per line
+std::string disassemble(const Function& fn);
+
+} // namespace holycpp
@@ -0,0 +1,208 @@
+#include "gc.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <limits>
+#include <new>
+
+namespace holycpp {
+
+GcHeap::GcHeap() : GcHeap(Config{}) {}
+
+GcHeap::GcHeap(const Config& config) : config(config), trigger(config.initialTrigger) {
+    if (this->config.stepBudget == 0) {
+        this->config.stepBudget = 1;
+    }
+    if (this->config.stepEvery == 0) {
+        this->config.stepEvery = 1;
+    }
+}
+
+GcHeap::~GcHeap() {
+    for (const auto& segment : segments) {
+        ::operator delete(segment->memory, std::align_val_t(SEGMENT_BYTES));
+    }
+}
+
+void GcHeap::removeRoot(Value* const* slot) {
+    // Roots usually go away in reverse order of registration
+    auto it = std::find(roots.rbegin(), roots.rend(), slot);
+    if (it != roots.rend()) {
+        roots.erase(std::next(it).base());
+    }
+}
+
+// ==================== Allocation ====================
+
+void* GcHeap::allocateSlot() {
+    if (phase == Phase::IDLE) {
+        if (sinceCycle >= trigger) {
+            if (config.incremental) {
+                timedStep(config.stepBudget);
+            } else {
+                collect();
+            }
+        }
+    } else if (config.incremental && ++sinceStep >= config.stepEvery) {
+        sinceStep = 0;
+        timedStep(config.stepBudget);
+    }
+
+    if (!freeList) {
+        addSegment();
+    }
+    FreeSlot* slot = freeList;
+    freeList = slot->next;
+
+    Segment& segment = *segmentOf(slot);
+    const size_t index = slotOf(segment, slot);
+    const uint64_t bit = uint64_t(1) << (index % 64);
+    segment.allocated[index / 64] |= bit;
+    if (phase != Phase::IDLE) {
+        segment.marks[index / 64] |= bit;   // Allocated black
+    }
+
+    ++live;
+    ++sinceCycle;
+    ++statistics.allocated;
+    return slot;
+}
+
+void GcHeap::addSegment() {
+    auto segment = std::make_unique<Segment>();
+    segment->memory = static_cast<char*>(::operator new(SEGMENT_BYTES, std::align_val_t(SEGMENT_BYTES)));
+    segmentIndex.emplace(reinterpret_cast<uintptr_t>(segment->memory), segment.get());
+
+    // Pushed in reverse so consecutive allocations are adjacent
+    for (size_t i = SLOTS_PER_SEGMENT; i-- > 0;) {
+        freeList = new (segment->memory + i * SLOT_BYTES) FreeSlot{freeList};
+    }
+    segments.push_back(std::move(segment));
+}
+
+// ==================== Marking ====================
+
+void GcHeap::shade(Value* value) {
+    Segment* segment = value ? segmentOf(value) : nullptr;
+    if (!segment) {
+        return;
+    }
+    const size_t index = slotOf(*segment, value);
+    const uint64_t bit = uint64_t(1) << (index % 64);
+    if (!(segment->allocated[index / 64] & bit) || (segment->marks[index / 64] & bit)) {
+        return;
+    }
+    segment->marks[index / 64] |= bit;
+    gray.push_back(value);
+}
+
+void GcHeap::startCycle() {
+    for (const auto& segment : segments) {
+        std::memset(segment->marks, 0, sizeof(segment->marks));
+    }
+    phase = Phase::MARK;
+    sinceStep = 0;
+    ++statistics.cycles;
+    shadeRoots();
+}
+
+void GcHeap::shadeRoots() {
+    for (Value* const* root : roots) {
+        shade(*root);
+    }
+}
+
+size_t GcHeap::markSome(size_t budget) {
+    size_t done = 0;
+    while (done < budget) {
+        if (gray.empty()) {
+            // Roots may have changed without a barrier since the last scan
+            shadeRoots();
+            if (gray.empty()) {
+                phase = Phase::SWEEP;
+                sweepSegment = 0;
+                sweepWord = 0;
+                break;
+            }
+        }
+        Value* value = gray.back();
+        gray.pop_back();
+        ++done;
+        if (value->is_value_ptr()) {
+            shade(value->val);
+        }
+    }
+    return done;
+}
+
+// ==================== Sweeping ====================
+
+size_t GcHeap::sweepSome(size_t budget) {
+    size_t done = 0;
+    while (done < budget) {
+        if (sweepSegment == segments.size()) {
+            finishCycle();
+            break;
+        }
+        Segment& segment = *segments[sweepSegment];
+        uint64_t dead = segment.allocated[sweepWord] & ~segment.marks[sweepWord];
+        segment.allocated[sweepWord] &= segment.marks[sweepWord];
+        while (dead) {
+            const size_t index = sweepWord * 64 + static_cast<size_t>(__builtin_ctzll(dead));
+            dead &= dead - 1;
+            freeList = new (segment.memory + index * SLOT_BYTES) FreeSlot{freeList};
+            --live;
+            ++statistics.freed;
+        }
+        done += 64;
+        if (++sweepWord == BITMAP_WORDS) {
+            sweepWord = 0;
+            ++sweepSegment;
+        }
+    }
+    return done;
+}
+
+void GcHeap::finishCycle() {
+    phase = Phase::IDLE;
+    sinceCycle = 0;
+    // Let the heap grow to `growth` times what survived before the next cycle
+    const double headroom = static_cast<double>(live) * std::max(config.growth - 1.0, 0.0);
+    trigger = std::max(config.initialTrigger, static_cast<size_t>(headroom));
+}
+
+// ==================== Driving Collections ====================
+
+void GcHeap::timedStep(size_t budget) {
+    auto start = std::chrono::steady_clock::now();
+    if (phase == Phase::IDLE) {
+        startCycle();
+    }
+    size_t used = 0;
+    if (phase == Phase::MARK) {
+        used = markSome(budget);
+    }
+    if (phase == Phase::SWEEP && used < budget) {
+        sweepSome(budget - used);
+    }
+    auto nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    const uint64_t pause = static_cast<uint64_t>(nanos.count());
+    ++statistics.steps;
+    statistics.totalPauseNanos += pause;
+    statistics.maxPauseNanos = std::max(statistics.maxPauseNanos, pause);
+}
+
+bool GcHeap::step() {
+    timedStep(config.stepBudget);
+    return isCollecting();
+}
+
+void GcHeap::collect() {
+    const size_t unbounded = std::numeric_limits<size_t>::max();
+    timedStep(unbounded);
+    while (phase != Phase::IDLE) {
+        timedStep(unbounded);
+    }
+}
+
+} // namespace holycpp
@@ -0,0 +1,181 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "../types/union_type.hpp"
+
+namespace holycpp {
+
+// ==================== Garbage-Collected Value Heap ====================
+// An optional precise tracing collector for Values. Objects live in 64 KiB
+// segments aligned to their size; each segment keeps its mark and
+// allocation bitmaps outside the objects, so marking never writes to a
+// Value and sweeping walks bits rather than memory.
+//
+// Tracing is precise: a Value is an edge only when it holds a Value
+// pointer (is_value_ptr()) into this heap. Pointers to Values elsewhere
+// (the stack, MAllocValue) are ignored. Roots are registered explicitly,
+// usually through GcRoot.
+//
+// Collection is incremental. Once the objects allocated since the last
+// cycle pass the trigger, every `stepEvery` allocations do one step that
+// marks or sweeps at most `stepBudget` objects, which bounds the pause.
+// While a cycle runs:
+//   - pointer stores into heap Values must go through setValuePtr(),
+//     which shades the new target (an insertion barrier)
+//   - new objects are allocated marked, so the running cycle keeps them
+//   - roots are rescanned when the gray stack empties, before sweeping
+// With `incremental` off, the trigger runs a whole collection instead.
+class GcHeap {
+public:
+    struct Config {
+        size_t initialTrigger = 64 * 1024;   // Allocations before the first cycle
+        double growth = 2.0;                 // Heap may grow to live objects * growth between cycles
+        size_t stepBudget = 2048;            // Objects marked or swept per step
+        size_t stepEvery = 256;              // Allocations between steps
+        bool incremental = true;
+    };
+
+    struct Stats {
+        uint64_t cycles = 0;
+        uint64_t allocated = 0;
+        uint64_t freed = 0;
+        uint64_t steps = 0;
+        uint64_t maxPauseNanos = 0;
+        uint64_t totalPauseNanos = 0;
+    };
+
+    static constexpr size_t SLOT_BYTES = 16;
+    static constexpr size_t SEGMENT_BYTES = 64 * 1024;
+    static constexpr size_t SLOTS_PER_SEGMENT = SEGMENT_BYTES / SLOT_BYTES;
+
+    static_assert(sizeof(Value) <= SLOT_BYTES && alignof(Value) <= SLOT_BYTES);
+    static_assert(std::is_trivially_destructible_v<Value>, "Sweeping runs no destructors");
+
+    GcHeap();
+    explicit GcHeap(const Config& config);
+    ~GcHeap();
+
+    GcHeap(const GcHeap&) = delete;
+    GcHeap& operator=(const GcHeap&) = delete;
+
+    // A new Value, constructed in place. May run a collection step first,
+    // so every Value the caller still needs must be reachable from a root.
+    template<typename... Args>
+    Value* make(Args&&... args) {
+        Value* value = new (allocateSlot()) Value(std::forward<Args>(args)...);
+        if (phase == Phase::MARK && value->is_value_ptr()) {
+            shade(value->val);
+        }
+        return value;
+    }
+
+    // The write barrier: object->set_value_ptr(target)
+    void setValuePtr(Value* object, Value* target) {
+        if (phase == Phase::MARK) {
+            shade(target);
+        }
+        object->set_value_ptr(target);
+    }
+
+    // Roots are addresses of Value* variables, read at every scan
+    void addRoot(Value* const* slot) { roots.push_back(slot); }
+    void removeRoot(Value* const* slot);
+
+    // Runs or finishes a whole cycle
+    void collect();
+
+    // One bounded increment, starting a cycle if none is running. Returns
+    // true while the cycle is still in progress.
+    bool step();
+
+    bool isCollecting() const { return phase != Phase::IDLE; }
+    bool owns(const Value* value) const { return segmentOf(value) != nullptr; }
+
+    size_t liveObjects() const { return live; }
+    size_t reservedBytes() const { return segments.size() * SEGMENT_BYTES; }
+    const Stats& stats() const { return statistics; }
+
+private:
+    enum class Phase : uint8_t { IDLE, MARK, SWEEP };
+
+    static constexpr size_t BITMAP_WORDS = SLOTS_PER_SEGMENT / 64;
+
+    struct Segment {
+        char* memory = nullptr;
+        uint64_t marks[BITMAP_WORDS] = {};
+        uint64_t allocated[BITMAP_WORDS] = {};
+    };
+
+    struct FreeSlot {
+        FreeSlot* next;
+    };
+
+    Config config;
+    Phase phase = Phase::IDLE;
+    std::vector<std::unique_ptr<Segment>> segments;
+    std::unordered_map<uintptr_t, Segment*> segmentIndex;   // By base address
+    std::vector<Value* const*> roots;
+    std::vector<Value*> gray;
+    FreeSlot* freeList = nullptr;
+
+    size_t live = 0;
+    size_t sinceCycle = 0;   // Allocations since the last cycle ended
+    size_t sinceStep = 0;    // Allocations since the last step
+    size_t trigger;
+    size_t sweepSegment = 0;
+    size_t sweepWord = 0;
+    Stats statistics;
+
+    void* allocateSlot();
+    void addSegment();
+
+    Segment* segmentOf(const void* ptr) const {
+        auto it = segmentIndex.find(reinterpret_cast<uintptr_t>(ptr) & ~(uintptr_t(SEGMENT_BYTES) - 1));
+        return it == segmentIndex.end() ? nullptr : it->second;
+    }
+
+    static size_t slotOf(const Segment& segment, const void* ptr) {
+        return static_cast<size_t>(static_cast<const char*>(ptr) - segment.memory) / SLOT_BYTES;
+    }
+
+    // Marks an unmarked heap Value and queues it for scanning
+    void shade(Value* value);
+
+    void startCycle();
+    void shadeRoots();
+    size_t markSome(size_t budget);
+    size_t sweepSome(size_t budget);
+    void finishCycle();
+    void timedStep(size_t budget);
+};
+
+// ==================== GC Roots ====================
+// Keeps one Value (and what it reaches) alive for its scope
+class GcRoot {
+public:
+    GcRoot(GcHeap& heap, Value* value = nullptr) : heap(heap), value(value) { heap.addRoot(&this->value); }
+    ~GcRoot() { heap.removeRoot(&value); }
+
+    GcRoot(const GcRoot&) = delete;
+    GcRoot& operator=(const GcRoot&) = delete;
+
+    GcRoot& operator=(Value* other) {
+        value = other;
+        return *this;
+    }
+
+    Value* get() const { return value; }
+    Value* operator->() const { return value; }
+    operator Value*() const { return value; }
+
+private:
+    GcHeap& heap;
+    Value* value;
+};
+
+} // namespace holycpp
@@ -0,0 +1,363 @@
+#include "tiered.hpp"
+#include <chrono>
+#include <sstream>
+#include <stdexcept>
+
+namespace holycpp {
+
+// ==================== Baseline Interpreter ====================
+Reg Interpreter::run(const Function& fn, const Reg* args, size_t argc,
+                     uint64_t* backEdges) {
+    if (argc != static_cast<size_t>(fn.numParams)) {
+        throw std::invalid_argument("Argument count mismatch calling '" + fn.name + "'");
+    }
+
+    Reg regs[256];
+    for (int r = 0; r < fn.numRegs; ++r) {
+        regs[r].i = 0;
+    }
+    for (size_t p = 0; p < argc; ++p) {
+        regs[p] = args[p];
+    }
+
+    const Instruction* code = fn.code.data();
+    size_t pc = 0;
+    uint64_t edges = 0;
+
+    for (;;) {
+        const Instruction& ins = code[pc];
+        switch (ins.op) {
+            case OpCode::LOAD_CONST:
+                regs[ins.dst] = fn.constants[ins.imm];
+                ++pc;
+                break;
+            case OpCode::MOVE:
+            case OpCode::I64_TO_F64:
+            case OpCode::F64_TO_I64:
+                regs[ins.dst] = evalUnary(ins.op, regs[ins.a]);
+                ++pc;
+                break;
+            case OpCode::JUMP:
+                if (static_cast<size_t>(ins.imm) <= pc) ++edges;
+                pc = ins.imm;
+                break;
+            case OpCode::JUMP_IF:
+            case OpCode::JUMP_IF_NOT:
+                if ((regs[ins.a].i != 0) == (ins.op == OpCode::JUMP_IF)) {
+                    if (static_cast<size_t>(ins.imm) <= pc) ++edges;
+                    pc = ins.imm;
+                } else {
+                    ++pc;
+                }
+                break;
+            case OpCode::RETURN:
+                if (backEdges) *backEdges += edges;
+                return regs[ins.a];
+            default:
+                regs[ins.dst] = evalBinary(ins.op, regs[ins.a], regs[ins.b]);
+                ++pc;
+                break;
+        }
+    }
+}
+
+// ==================== Threaded-Code Backend ====================
+namespace {
+
+struct ThreadedOp;
+using Handler = const ThreadedOp* (*)(const ThreadedOp*, Reg*);
+
+struct ThreadedOp {
+    Handler fn = nullptr;
+    uint8_t dst = 0;
+    uint8_t a = 0;
+    uint8_t b = 0;
+    Reg constant{};
+    const ThreadedOp* target = nullptr;
+};
+
+const ThreadedOp* constHandler(const ThreadedOp* op, Reg* regs) {
+    regs[op->dst] = op->constant;
+    return op + 1;
+}
+
+template<OpCode Op>
+const ThreadedOp* unaryHandler(const ThreadedOp* op, Reg* regs) {
+    regs[op->dst] = evalUnary(Op, regs[op->a]);
+    return op + 1;
+}
+
+template<OpCode Op>
+const ThreadedOp* binaryHandler(const ThreadedOp* op, Reg* regs) {
+    regs[op->dst] = evalBinary(Op, regs[op->a], regs[op->b]);
+    return op + 1;
+}
+
+// Compare fused with the JUMP_IF/JUMP_IF_NOT that follows it. The branch
+// keeps its own slot (other jumps may target it), so fall-through skips two.
+template<OpCode Op, bool JumpIfTrue>
+const ThreadedOp* fusedBranchHandler(const ThreadedOp* op, Reg* regs) {
+    const Reg result = evalBinary(Op, regs[op->a], regs[op->b]);
+    regs[op->dst] = result;
+    return ((result.i != 0) == JumpIfTrue) ? op->target : op + 2;
+}
+
+const ThreadedOp* jumpHandler(const ThreadedOp* op, Reg*) {
+    return op->target;
+}
+
+template<bool JumpIfTrue>
+const ThreadedOp* branchHandler(const ThreadedOp* op, Reg* regs) {
+    return ((regs[op->a].i != 0) == JumpIfTrue) ? op->target : op + 1;
+}
+
+const ThreadedOp* returnHandler(const ThreadedOp*, Reg*) {
+    return nullptr;
+}
+
+Handler unaryFor(OpCode op) {
+    switch (op) {
+        case OpCode::MOVE: return unaryHandler<OpCode::MOVE>;
+        case OpCode::I64_TO_F64: return unaryHandler<OpCode::I64_TO_F64>;
+        case OpCode::F64_TO_I64: return unaryHandler<OpCode::F64_TO_I64>;
+        default: return nullptr;
+    }
+}
+
+Handler binaryFor(OpCode op) {
+    switch (op) {
+        case OpCode::ADD_I64: return binaryHandler<OpCode::ADD_I64>;
+        case OpCode::SUB_I64: return binaryHandler<OpCode::SUB_I64>;
+        case OpCode::MUL_I64: return binaryHandler<OpCode::MUL_I64>;
+        case OpCode::DIV_I64: return binaryHandler<OpCode::DIV_I64>;
+        case OpCode::MOD_I64: return binaryHandler<OpCode::MOD_I64>;
+        case OpCode::AND_I64: return binaryHandler<OpCode::AND_I64>;
+        case OpCode::OR_I64: return binaryHandler<OpCode::OR_I64>;
+        case OpCode::XOR_I64: return binaryHandler<OpCode::XOR_I64>;
+        case OpCode::SHL_I64: return binaryHandler<OpCode::SHL_I64>;
+        case OpCode::SHR_I64: return binaryHandler<OpCode::SHR_I64>;
+        case OpCode::ADD_F64: return binaryHandler<OpCode::ADD_F64>;
+        case OpCode::SUB_F64: return binaryHandler<OpCode::SUB_F64>;
+        case OpCode::MUL_F64: return binaryHandler<OpCode::MUL_F64>;
+        case OpCode::DIV_F64: return binaryHandler<OpCode::DIV_F64>;
+        case OpCode::LT_I64: return binaryHandler<OpCode::LT_I64>;
+        case OpCode::LE_I64: return binaryHandler<OpCode::LE_I64>;
+        case OpCode::EQ_I64: return binaryHandler<OpCode::EQ_I64>;
+        case OpCode::NE_I64: return binaryHandler<OpCode::NE_I64>;
+        case OpCode::LT_F64: return binaryHandler<OpCode::LT_F64>;
+        case OpCode::LE_F64: return binaryHandler<OpCode::LE_F64>;
+        default: return nullptr;
+    }
+}
+
+Handler fusedFor(OpCode op, bool jumpIfTrue) {
+    switch (op) {
+        case OpCode::LT_I64: return jumpIfTrue ? fusedBranchHandler<OpCode::LT_I64, true> : fusedBranchHandler<OpCode::LT_I64, false>;
+        case OpCode::LE_I64: return jumpIfTrue ? fusedBranchHandler<OpCode::LE_I64, true> : fusedBranchHandler<OpCode::LE_I64, false>;
+        case OpCode::EQ_I64: return jumpIfTrue ? fusedBranchHandler<OpCode::EQ_I64, true> : fusedBranchHandler<OpCode::EQ_I64, false>;
+        case OpCode::NE_I64: return jumpIfTrue ? fusedBranchHandler<OpCode::NE_I64, true> : fusedBranchHandler<OpCode::NE_I64, false>;
+        case OpCode::LT_F64: return jumpIfTrue ? fusedBranchHandler<OpCode::LT_F64, true> : fusedBranchHandler<OpCode::LT_F64, false>;
+        case OpCode::LE_F64: return jumpIfTrue ? fusedBranchHandler<OpCode::LE_F64, true> : fusedBranchHandler<OpCode::LE_F64, false>;
+        default: return nullptr;
+    }
+}
+
+class ThreadedCode : public CompiledCode {
+public:
+    std::vector<ThreadedOp> ops;
+    std::string name;
+    int numParams = 0;
+    int numRegs = 0;
+
+    Reg run(const Reg* args, size_t argc) const override {
+        if (argc != static_cast<size_t>(numParams)) {
+            throw std::invalid_argument("Argument count mismatch calling '" + name + "'");
+        }
+
+        Reg regs[256];
+        for (int r = 0; r < numRegs; ++r) {
+            regs[r].i = 0;
+        }
+        for (size_t p = 0; p < argc; ++p) {
+            regs[p] = args[p];
+        }
+
+        const ThreadedOp* op = ops.data();
+        for (const ThreadedOp* next; (next = op->fn(op, regs)) != nullptr; ) {
+            op = next;
+        }
+        return regs[op->a];
+    }
+};
+
+} // namespace
+
+CompileResult ThreadedBackend::compile(const Function& fn) {
+    CompileResult result;
+
+    std::string reason;
+    if (!verifyFunction(fn, reason)) {
+        result.failure = CodeGenError::Code::INVALID_IR;
+        result.detail = reason;
+        return result;
+    }
+
+    auto code = std::make_unique<ThreadedCode>();
+    code->name = fn.name;
+    code->numParams = fn.numParams;
+    code->numRegs = fn.numRegs;
+    code->ops.resize(fn.code.size());
+
+    for (size_t pc = 0; pc < fn.code.size(); ++pc) {
+        const Instruction& ins = fn.code[pc];
+        ThreadedOp& op = code->ops[pc];
+        op.dst = ins.dst;
+        op.a = ins.a;
+        op.b = ins.b;
+
+        if (isBranch(ins.op)) {
+            op.target = &code->ops[ins.imm];
+        }
+
+        switch (ins.op) {
+            case OpCode::LOAD_CONST:
+                op.fn = constHandler;
+                op.constant = fn.constants[ins.imm];
+                break;
+            case OpCode::JUMP:
+                op.fn = jumpHandler;
+                break;
+            case OpCode::JUMP_IF:
+                op.fn = branchHandler<true>;
+                break;
+            case OpCode::JUMP_IF_NOT:
+                op.fn = branchHandler<false>;
+                break;
+            case OpCode::RETURN:
+                op.fn = returnHandler;
+                break;
+            default:
+                op.fn = isUnaryOp(ins.op) ? unaryFor(ins.op) : binaryFor(ins.op);
+                break;
+        }
+
+        if (!op.fn) {
+            result.failure = CodeGenError::Code::FUNCTION_CREATION_FAILED;
+            result.detail = std::string("no handler for ") + opCodeName(ins.op);
+            return result;
+        }
+    }
+
+    // Fuse compare + conditional branch on the compare's result
+    for (size_t pc = 0; pc + 1 < fn.code.size(); ++pc) {
+        const Instruction& cmp = fn.code[pc];
+        const Instruction& br = fn.code[pc + 1];
+        if ((br.op == OpCode::JUMP_IF || br.op == OpCode::JUMP_IF_NOT) && br.a == cmp.dst) {
+            if (Handler fused = fusedFor(cmp.op, br.op == OpCode::JUMP_IF)) {
+                code->ops[pc].fn = fused;
+                code->ops[pc].target = &code->ops[br.imm];
+            }
+        }
+    }
+
+    result.code = std::move(code);
+    return result;
+}
+
+// ==================== Tiered Engine ====================
+TieredEngine::TieredEngine(std::unique_ptr<JitBackend> backend, TierPolicy policy)
+    : backend(std::move(backend)), policy(policy) {}
+
+size_t TieredEngine::addFunction(Function fn) {
+    std::string reason;
+    if (!verifyFunction(fn, reason)) {
+        throw std::invalid_argument("Invalid bytecode in '" + fn.name + "': " + reason);
+    }
+    entries.push_back(Entry{std::move(fn), FunctionProfile{}, nullptr});
+    return entries.size() - 1;
+}
+
+Reg TieredEngine::call(size_t id, const Reg* args, size_t argc) {
+    Entry& entry = entries.at(id);
+    ++entry.profile.calls;
+
+    if (entry.compiled) {
+        return entry.compiled->run(args, argc);
+    }
+
+    if (backend && entry.profile.tier == Tier::INTERPRETED && isHot(entry.profile)) {
+        tierUp(entry);
+        if (entry.compiled) {
+            return entry.compiled->run(args, argc);
+        }
+    }
+
+    return Interpreter::run(entry.fn, args, argc, &entry.profile.backEdges);
+}
+
+bool TieredEngine::compileNow(size_t id) {
+    Entry& entry = entries.at(id);
+    if (!entry.compiled && backend) {
+        tierUp(entry);
+    }
+    return entry.compiled != nullptr;
+}
+
+bool TieredEngine::isHot(const FunctionProfile& profile) const {
+    return profile.calls >= policy.callThreshold ||
+           profile.backEdges >= policy.backEdgeThreshold;
+}
+
+void TieredEngine::tierUp(Entry& entry) {
+    if (!backendChecked) {
+        backendChecked = true;
+        std::string reason;
+        backendReady = backend->initialize(reason);
+        if (!backendReady) {
+            reportFailure(entry, CodeGenError::Code::LLVM_INIT_FAILED, reason);
+        }
+    }
+    if (!backendReady) {
+        entry.profile.tier = Tier::FAILED;
+        return;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    CompileResult result;
+    try {
+        result = backend->compile(entry.fn);
+    } catch (const std::exception& e) {
+        result.code.reset();
+        result.detail = e.what();
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    entry.profile.compileNanos = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+
+    if (!result.code) {
+        entry.profile.tier = Tier::FAILED;
+        reportFailure(entry, result.failure, result.detail);
+        return;
+    }
+
+    entry.compiled = std::move(result.code);
+    entry.profile.tier = Tier::COMPILED;
+}
+
+void TieredEngine::reportFailure(const Entry& entry, CodeGenError::Code code,
+                                 const std::string& detail) {
+    // Tier-up is an optimization: whatever the backend's reason, the
+    // program keeps running, so this is reported as C006 (a warning).
+    std::stringstream ss;
+    ss << "tier-up of '" << entry.fn.name << "' via " << backend->name()
+       << " backend failed (" << CodeGenError::codeToString(code);
+    if (!detail.empty()) {
+        ss << ": " << detail;
+    }
+    ss << "); continuing in the interpreter";
+
+    ErrorManager::get().report(std::make_unique<CodeGenError>(
+        CodeGenError::Code::OPTIMIZATION_FAILED, entry.fn.location, ss.str()));
+}
+
+} // namespace holycpp
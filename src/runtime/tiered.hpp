@@ -0,0 +1,125 @@
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include <initializer_list>
+#include "bytecode.hpp"
+#include "../lib/error.hpp"
+#include "../lib/error_types.hpp"
+
+namespace holycpp {
+
+// ==================== Tiering Policy ====================
+enum class Tier {
+    INTERPRETED,    // Tier 0: baseline bytecode interpreter
+    COMPILED,       // Tier 1: backend-compiled code
+    FAILED          // Tier-up was attempted and failed; stays in tier 0
+};
+
+struct TierPolicy {
+    uint32_t callThreshold = 1000;       // Invocations before tier-up
+    uint32_t backEdgeThreshold = 10000;  // Loop iterations before tier-up
+};
+
+struct FunctionProfile {
+    uint64_t calls = 0;
+    uint64_t backEdges = 0;
+    uint64_t compileNanos = 0;
+    Tier tier = Tier::INTERPRETED;
+};
+
+// ==================== Baseline Interpreter ====================
+class Interpreter {
+public:
+    // Executes a verified function. Taken backward jumps are added to
+    // *backEdges when it is non-null.
+    static Reg run(const Function& fn, const Reg* args, size_t argc,
+                   uint64_t* backEdges = nullptr);
+};
+
+// ==================== Backend Interface ====================
+class CompiledCode {
+public:
+    virtual ~CompiledCode() = default;
+    virtual Reg run(const Reg* args, size_t argc) const = 0;
+};
+
+struct CompileResult {
+    std::unique_ptr<CompiledCode> code;       // null on failure
+    CodeGenError::Code failure = CodeGenError::Code::FUNCTION_CREATION_FAILED;
+    std::string detail;
+};
+
+// An in-process code generator. An LLVM ORC backend plugs in here; the
+// default ThreadedBackend needs no external dependencies.
+class JitBackend {
+public:
+    virtual ~JitBackend() = default;
+
+    virtual const char* name() const = 0;
+
+    // Called once before the first compile; false disables tier-up
+    virtual bool initialize(std::string& reason) {
+        (void)reason;
+        return true;
+    }
+
+    virtual CompileResult compile(const Function& fn) = 0;
+};
+
+// ==================== Threaded-Code Backend ====================
+// Translates bytecode into pre-decoded, direct-threaded handlers: operands
+// and jump targets are resolved once, constants are inlined and
+// compare+branch pairs are fused, so the dispatch loop does no decoding.
+class ThreadedBackend : public JitBackend {
+public:
+    const char* name() const override { return "threaded"; }
+    CompileResult compile(const Function& fn) override;
+};
+
+// ==================== Tiered Engine ====================
+// Runs every function in the interpreter first and promotes it to the
+// backend once it crosses the call or back-edge threshold. A back-edge
+// promotion takes effect on the next call (there is no on-stack replacement).
+// Backend failures are reported as CodeGenError warnings and the function
+// keeps running in the interpreter.
+class TieredEngine {
+public:
+    explicit TieredEngine(std::unique_ptr<JitBackend> backend = std::make_unique<ThreadedBackend>(),
+                          TierPolicy policy = {});
+
+    // Verifies and registers a function; throws std::invalid_argument on bad bytecode
+    size_t addFunction(Function fn);
+
+    Reg call(size_t id, const Reg* args, size_t argc);
+    Reg call(size_t id, std::initializer_list<Reg> args) {
+        return call(id, args.begin(), args.size());
+    }
+
+    // Forces tier-up regardless of counters; returns true when compiled
+    bool compileNow(size_t id);
+
+    const FunctionProfile& profile(size_t id) const { return entries.at(id).profile; }
+    const Function& function(size_t id) const { return entries.at(id).fn; }
+    size_t functionCount() const { return entries.size(); }
+
+private:
+    struct Entry {
+        Function fn;
+        FunctionProfile profile;
+        std::unique_ptr<CompiledCode> compiled;
+    };
+
+    std::vector<Entry> entries;
+    std::unique_ptr<JitBackend> backend;
+    TierPolicy policy;
+    bool backendChecked = false;
+    bool backendReady = false;
+
+    bool isHot(const FunctionProfile& profile) const;
+    void tierUp(Entry& entry);
+    void reportFailure(const Entry& entry, CodeGenError::Code code, const std::string& detail);
+};
+
+} // namespace holycpp
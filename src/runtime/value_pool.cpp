@@ -0,0 +1,114 @@
+#include "value_pool.hpp"
+#include <atomic>
+
+namespace holycpp {
+
+namespace {
+
+std::atomic<uint64_t> nextPoolId{1};
+
+} // namespace
+
+ValuePool::ValuePool(bool threadCaches)
+    : threadCaches(threadCaches), id(nextPoolId.fetch_add(1, std::memory_order_relaxed)) {}
+
+ValuePool::~ValuePool() {
+    for (void* slab : slabs) {
+        ::operator delete(slab, std::align_val_t(SLOT_ALIGN));
+    }
+    for (void* slab : spareSlabs) {
+        ::operator delete(slab, std::align_val_t(SLOT_ALIGN));
+    }
+}
+
+void* ValuePool::carve(size_t index) {
+    SizeClass& cls = classes[index];
+    const size_t slotBytes = (index + 1) * SLOT_ALIGN;
+    if (cls.bump == cls.end) {
+        char* slab;
+        if (!spareSlabs.empty()) {
+            slab = static_cast<char*>(spareSlabs.back());
+            spareSlabs.pop_back();
+        } else {
+            slab = static_cast<char*>(::operator new(SLAB_BYTES, std::align_val_t(SLOT_ALIGN)));
+        }
+        slabs.push_back(slab);
+        cls.bump = slab;
+        cls.end = slab + SLAB_BYTES / slotBytes * slotBytes;
+    }
+    void* slot = cls.bump;
+    cls.bump += slotBytes;
+    return slot;
+}
+
+ValuePool::CacheRef ValuePool::attachCache() {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::unique_ptr<ThreadCache>& cache = caches[std::this_thread::get_id()];
+    if (!cache) {
+        cache = std::make_unique<ThreadCache>();
+    }
+    return CacheRef{id, cache.get()};
+}
+
+void ValuePool::refill(ThreadCache& cache, size_t index) {
+    std::lock_guard<std::mutex> lock(mutex);
+    SizeClass& cls = classes[index];
+    for (uint32_t i = 0; i < CACHE_BATCH; ++i) {
+        void* slot;
+        if (cls.free) {
+            slot = cls.free;
+            cls.free = cls.free->next;
+        } else {
+            slot = carve(index);
+        }
+        cache.lists[index] = new (slot) FreeSlot{cache.lists[index]};
+    }
+    cache.counts[index] += CACHE_BATCH;
+}
+
+void ValuePool::spill(ThreadCache& cache, size_t index) {
+    // Detach one batch from the front of the thread's list, then splice it
+    // onto the shared list under the lock
+    FreeSlot* first = cache.lists[index];
+    FreeSlot* last = first;
+    for (uint32_t i = 1; i < CACHE_BATCH; ++i) {
+        last = last->next;
+    }
+    cache.lists[index] = last->next;
+    cache.counts[index] -= CACHE_BATCH;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    SizeClass& cls = classes[index];
+    last->next = cls.free;
+    cls.free = first;
+}
+
+void ValuePool::reset() {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (SizeClass& cls : classes) {
+        cls = SizeClass{};
+    }
+    for (auto& entry : caches) {
+        *entry.second = ThreadCache{};
+    }
+    // Slabs are kept for reuse rather than returned to the system
+    spareSlabs.insert(spareSlabs.end(), slabs.begin(), slabs.end());
+    slabs.clear();
+}
+
+size_t ValuePool::slabCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return slabs.size();
+}
+
+size_t ValuePool::reservedBytes() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return (slabs.size() + spareSlabs.size()) * SLAB_BYTES;
+}
+
+ValuePool& ValuePool::shared() {
+    static ValuePool pool(true);
+    return pool;
+}
+
+} // namespace holycpp
@@ -0,0 +1,175 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <unordered_map>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace holycpp {
+
+// ==================== Value Pool ====================
+// Fixed-size slots for Value, Union<...> and graph nodes built from them.
+// Requests are rounded up to 16, 32, 48 or 64 bytes; each size class
+// carves 64 KiB slabs and keeps freed slots on an intrusive free list, so
+// allocate and deallocate are a pointer pop and push. Consecutive
+// allocations are adjacent in memory, which keeps linked Value graphs
+// cache-local. Larger requests fall through to operator new.
+//
+// Without thread caches a pool is single-threaded and takes no locks.
+// With them, each thread allocates from and frees into its own per-class
+// lists, trading batches of slots with the shared slabs under a mutex. A
+// slot may be freed on any thread. Caches live until the pool does.
+class ValuePool {
+public:
+    static constexpr size_t SLOT_ALIGN = 16;
+    static constexpr size_t MAX_SLOT = 64;
+    static constexpr size_t CLASS_COUNT = MAX_SLOT / SLOT_ALIGN;
+    static constexpr size_t SLAB_BYTES = 64 * 1024;
+    static constexpr uint32_t CACHE_BATCH = 32;   // Slots moved per refill or spill
+
+    explicit ValuePool(bool threadCaches = false);
+    ~ValuePool();
+
+    ValuePool(const ValuePool&) = delete;
+    ValuePool& operator=(const ValuePool&) = delete;
+
+    // 16-byte aligned storage for `bytes`; pass the same size back to free
+    void* allocate(size_t bytes) {
+        if (bytes > MAX_SLOT) {
+            return ::operator new(bytes, std::align_val_t(SLOT_ALIGN));
+        }
+        const size_t index = classOf(bytes);
+        if (threadCaches) {
+            return cachedAllocate(index);
+        }
+        SizeClass& cls = classes[index];
+        if (cls.free) {
+            FreeSlot* slot = cls.free;
+            cls.free = slot->next;
+            return slot;
+        }
+        return carve(index);
+    }
+
+    void deallocate(void* ptr, size_t bytes) {
+        if (!ptr) {
+            return;
+        }
+        if (bytes > MAX_SLOT) {
+            ::operator delete(ptr, std::align_val_t(SLOT_ALIGN));
+            return;
+        }
+        const size_t index = classOf(bytes);
+        if (threadCaches) {
+            cachedDeallocate(ptr, index);
+            return;
+        }
+        SizeClass& cls = classes[index];
+        cls.free = new (ptr) FreeSlot{cls.free};
+    }
+
+    template<typename T, typename... Args>
+    T* create(Args&&... args) {
+        static_assert(alignof(T) <= SLOT_ALIGN, "ValuePool slots are 16-byte aligned");
+        void* slot = allocate(sizeof(T));
+        try {
+            return new (slot) T(std::forward<Args>(args)...);
+        } catch (...) {
+            deallocate(slot, sizeof(T));
+            throw;
+        }
+    }
+
+    template<typename T>
+    void destroy(T* object) {
+        if (object) {
+            object->~T();
+            deallocate(object, sizeof(T));
+        }
+    }
+
+    // Frees every slot at once without running destructors, for graphs that
+    // die together. The slabs are kept and carved again. No thread may be
+    // using the pool during the call.
+    void reset();
+
+    size_t slabCount() const;       // Slabs carved since construction or reset()
+    size_t reservedBytes() const;   // Including slabs kept by reset()
+
+    // A process-wide pool with thread caches
+    static ValuePool& shared();
+
+private:
+    struct FreeSlot {
+        FreeSlot* next;
+    };
+
+    struct SizeClass {
+        FreeSlot* free = nullptr;
+        char* bump = nullptr;   // Uncarved part of the newest slab
+        char* end = nullptr;
+    };
+
+    struct ThreadCache {
+        FreeSlot* lists[CLASS_COUNT] = {};
+        uint32_t counts[CLASS_COUNT] = {};
+    };
+
+    // The calling thread's cache for the pool it used last
+    struct CacheRef {
+        uint64_t pool = 0;
+        ThreadCache* cache = nullptr;
+    };
+
+    SizeClass classes[CLASS_COUNT];
+    std::vector<void*> slabs;
+    std::vector<void*> spareSlabs;
+    const bool threadCaches;
+    const uint64_t id;   // Tells thread-local lookups apart across pools
+
+    mutable std::mutex mutex;   // Guards classes and slabs when caching
+    std::unordered_map<std::thread::id, std::unique_ptr<ThreadCache>> caches;
+
+    static constexpr size_t classOf(size_t bytes) {
+        return bytes == 0 ? 0 : (bytes - 1) / SLOT_ALIGN;
+    }
+
+    void* carve(size_t index);
+    CacheRef attachCache();
+
+    ThreadCache& localCache() {
+        thread_local CacheRef last;
+        if (last.pool != id) {
+            last = attachCache();
+        }
+        return *last.cache;
+    }
+
+    void* cachedAllocate(size_t index) {
+        ThreadCache& cache = localCache();
+        if (!cache.lists[index]) {
+            refill(cache, index);
+        }
+        FreeSlot* slot = cache.lists[index];
+        cache.lists[index] = slot->next;
+        --cache.counts[index];
+        return slot;
+    }
+
+    void cachedDeallocate(void* ptr, size_t index) {
+        ThreadCache& cache = localCache();
+        cache.lists[index] = new (ptr) FreeSlot{cache.lists[index]};
+        if (++cache.counts[index] > 2 * CACHE_BATCH) {
+            spill(cache, index);
+        }
+    }
+
+    void refill(ThreadCache& cache, size_t index);
+    void spill(ThreadCache& cache, size_t index);
+};
+
+} // namespace holycpp
@@ -0,0 +1,82 @@
+#pragma once
+#include <string>
+#include <vector>
+#include "../runtime/bytecode.hpp"
+
+namespace holycpp {
+namespace testing {
+
+// ==================== Bytecode Fixture ====================
+// Generated functions for the compile pipeline tests. Function <seed>
+// starts at line seed * 10 of unit.hc.
+
+// I64 F<seed>(I64 n) { I64 s = 0; for (I64 i = 0; i < n; i++) s += i * k; return s + c; }
+inline Function makeLoop(int seed) {
+    Function fn;
+    fn.name = "Loop" + std::to_string(seed);
+    fn.numParams = 1;
+    fn.numRegs = 8;
+    fn.location = SourceLocation("unit.hc", seed * 10, 1);
+    int k = fn.addConstant(Reg::ofInt(seed % 7 + 1));
+    int one = fn.addConstant(Reg::ofInt(1));
+    int c = fn.addConstant(Reg::ofInt(seed * 3));
+    int two = fn.addConstant(Reg::ofInt(2));
+    fn.emit(OpCode::LOAD_CONST, 3, 0, 0, k)         // 0
+      .emit(OpCode::LOAD_CONST, 4, 0, 0, one)       // 1
+      .emit(OpCode::LOAD_CONST, 5, 0, 0, two)       // 2
+      .emit(OpCode::MUL_I64, 3, 3, 5)               // 3: k * 2, folded
+      .emit(OpCode::LT_I64, 6, 2, 0)                // 4: i < n
+      .emit(OpCode::JUMP_IF_NOT, 0, 6, 0, 10)       // 5
+      .emit(OpCode::MUL_I64, 7, 2, 3)               // 6
+      .emit(OpCode::ADD_I64, 1, 1, 7)               // 7
+      .emit(OpCode::ADD_I64, 2, 2, 4)               // 8
+      .emit(OpCode::JUMP, 0, 0, 0, 4)               // 9
+      .emit(OpCode::LOAD_CONST, 7, 0, 0, c)         // 10
+      .emit(OpCode::ADD_I64, 1, 1, 7)               // 11
+      .emit(OpCode::RETURN, 0, 1);                  // 12
+    return fn;
+}
+
+// Divides by a constant zero: folding reports T012 but codegen still succeeds
+inline Function makeDivByZero(int seed) {
+    Function fn;
+    fn.name = "Div" + std::to_string(seed);
+    fn.numRegs = 3;
+    fn.location = SourceLocation("unit.hc", seed * 10, 1);
+    int ten = fn.addConstant(Reg::ofInt(10));
+    fn.emit(OpCode::LOAD_CONST, 0, 0, 0, ten)
+      .emit(OpCode::DIV_I64, 2, 0, 1)               // r1 is zero-initialized
+      .emit(OpCode::RETURN, 0, 2);
+    return fn;
+}
+
+// Reads a register past numRegs: rejected by verification (C005)
+inline Function makeMalformed(int seed) {
+    Function fn;
+    fn.name = "Bad" + std::to_string(seed);
+    fn.numRegs = 2;
+    fn.location = SourceLocation("unit.hc", seed * 10, 1);
+    fn.emit(OpCode::RETURN, 0, 9);
+    return fn;
+}
+
+// Loops, with a division by zero every 13th function (from 5) when
+// withErrors is set and a malformed one every 29th (from 11) when
+// withMalformed is too
+inline std::vector<Function> makeUnit(size_t size, bool withErrors, bool withMalformed = true) {
+    std::vector<Function> unit;
+    for (size_t i = 0; i < size; ++i) {
+        int seed = static_cast<int>(i);
+        if (withErrors && i % 13 == 5) {
+            unit.push_back(makeDivByZero(seed));
+        } else if (withErrors && withMalformed && i % 29 == 11) {
+            unit.push_back(makeMalformed(seed));
+        } else {
+            unit.push_back(makeLoop(seed));
+        }
+    }
+    return unit;
+}
+
+} // namespace testing
+} // namespace holycpp
@@ -0,0 +1,294 @@
+#include "../types/array.hpp"
+#include "../types/reduce.hpp"
+#include "../types/fixed.hpp"
+#include "test_helpers.hpp"
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+using namespace holycpp;
+using namespace holycpp::testing;
+
+// Test function prototypes
+void test_array_basics();
+void test_bounds_policy();
+void test_slices();
+void test_heap_array();
+void test_kernel_interop();
+void benchmark_indexing();
+
+int main() {
+    std::cout << "🧪 Running HolyC++ Array Tests\n";
+    std::cout << "==============================\n";
+
+    try {
+        test_array_basics();
+        test_bounds_policy();
+        test_slices();
+        test_heap_array();
+        test_kernel_interop();
+        benchmark_indexing();
+
+        std::cout << "\n✅ All array tests passed!\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ Test failed: " << e.what() << "\n";
+        return 1;
+    }
+}
+
+static bool alignedTo(const void* pointer, size_t alignment) {
+    return reinterpret_cast<uintptr_t>(pointer) % alignment == 0;
+}
+
+void test_array_basics() {
+    std::cout << "\n🔹 Testing Array...\n";
+
+    Array<I64, 5> a = {1, 2, 3, 4, 5};
+    assert(a.size() == 5 && a[0] == 1 && a[4] == 5);
+    a[2] = I64(30);
+    int total = 0;
+    for (const I64& value : a) {
+        total += value;
+    }
+    assert(total == 1 + 2 + 30 + 4 + 5);
+
+    a.fill(I64(7));
+    for (size_t i = 0; i < a.size(); ++i) {
+        assert(a[i] == 7);
+    }
+
+    const Array<I64, 5>& view = a;
+    assert(view[4] == 7 && view.at(0) == 7 && *view.begin() == 7);
+
+    // Small arrays align for one vector load, larger ones to a cache line
+    static_assert(Array<I8, 3>::ALIGNMENT == 32 && Array<F64, 8>::ALIGNMENT == 64);
+    static_assert(alignof(Array<F64, 16>) == 64 && sizeof(Array<F64, 16>) == 128);
+    Array<F64, 16> doubles{};
+    assert(alignedTo(doubles.data(), 64) && doubles[15] == F64(0.0));
+    Array<F32, 3> singles[2] = {};
+    assert(alignedTo(singles[1].data(), 32));
+
+    std::cout << "  ✓ Aggregate initialization, iteration and aligned storage\n";
+}
+
+void test_bounds_policy() {
+    std::cout << "\n🔹 Testing bounds checks...\n";
+
+    Array<I64, 4> checked = {1, 2, 3, 4};
+    assert(throws<std::out_of_range>([&] { checked[4]; }));
+    assert(throws<std::out_of_range>([&] { checked.at(100); }));
+    assert(throws<std::out_of_range>([&] { checked.slice()[size_t(-1)]; }));
+
+    // Unchecked strips operator[]'s check. The slice covers half the
+    // array, so reading past it stays in memory that exists
+    static_assert(!checking::checks_bounds_v<checking::Unchecked>);
+    static_assert(checking::checks_bounds_v<checking::Basic> && checking::checks_bounds_v<checking::Saturating>);
+    Array<I64, 8, checking::Unchecked> backing = {0, 1, 2, 3, 4, 5, 6, 7};
+    Slice<I64, checking::Unchecked> half = backing.slice().first(4);
+    assert(half.size() == 4 && half[5] == 5);
+    assert(throws<std::out_of_range>([&] { half.at(5); }));   // at() always checks
+
+    // The same slice viewed under the default policy checks again
+    Slice<const I64> rechecked = half;
+    assert(throws<std::out_of_range>([&] { rechecked[5]; }));
+
+    std::cout << "  ✓ operator[] checks unless the policy is Unchecked; at() always checks\n";
+}
+
+void test_slices() {
+    std::cout << "\n🔹 Testing Slice...\n";
+
+    std::vector<I64> values = {10, 20, 30, 40, 50, 60};
+    Slice<I64> all = values;
+    assert(all.size() == 6 && all.data() == values.data());
+
+    Slice<I64> middle = all.subslice(1, 4);
+    assert(middle.size() == 4 && middle[0] == 20 && middle[3] == 50);
+    middle[1] = I64(33);
+    assert(values[2] == 33);
+
+    assert(all.first(2).size() == 2 && all.drop(4)[0] == 50 && all.drop(6).empty());
+    assert(throws<std::out_of_range>([&] { all.subslice(5, 2); }));
+    assert(throws<std::out_of_range>([&] { all.subslice(7, 0); }));
+    assert(throws<std::out_of_range>([&] { all.subslice(2, size_t(-1)); }));   // offset + count wraps
+    assert(throws<std::out_of_range>([&] { all.drop(7); }));
+    assert(all.subslice(6, 0).empty());
+
+    // Read-only views of mutable and const containers
+    const std::vector<I64>& constValues = values;
+    Slice<const I64> readOnly = constValues;
+    Slice<const I64> fromSlice = middle;
+    assert(readOnly[2] == 33 && fromSlice[1] == 33);
+    static_assert(!std::is_constructible_v<Slice<I64>, const std::vector<I64>&>);
+    static_assert(!std::is_constructible_v<Slice<I64>, std::vector<I32>&>);
+
+    int total = 0;
+    for (const I64& value : middle) {
+        total += value;
+    }
+    assert(total == 20 + 33 + 40 + 50);
+
+    Slice<I64> empty;
+    assert(empty.empty() && empty.begin() == empty.end());
+
+    std::cout << "  ✓ Subslices check their range once; const views and conversions\n";
+}
+
+struct Tracked {
+    static int live;
+    static int failAt;
+    int value;
+    Tracked() : Tracked(0) {}
+    explicit Tracked(int value) : value(value) {
+        if (live == failAt) {
+            throw std::runtime_error("construction failed");
+        }
+        ++live;
+    }
+    Tracked(const Tracked& other) : Tracked(other.value) {}
+    ~Tracked() { --live; }
+};
+
+int Tracked::live = 0;
+int Tracked::failAt = -1;
+
+void test_heap_array() {
+    std::cout << "\n🔹 Testing HeapArray...\n";
+
+    HeapArray<I64> zeroed = MAllocArray<I64>(1000);
+    assert(zeroed.size() == 1000 && alignedTo(zeroed.data(), 64));
+    for (const I64& value : zeroed) {
+        assert(value == 0);
+    }
+    assert(throws<std::out_of_range>([&] { zeroed[1000]; }));
+
+    HeapArray<F64> filled(10, F64(2.5));
+    HeapArray<F64> copy = filled;
+    copy[0] = F64(1.0);
+    assert(filled[0] == F64(2.5) && copy[0] == F64(1.0) && copy[9] == F64(2.5));
+
+    HeapArray<F64> moved = std::move(copy);
+    assert(moved.size() == 10 && copy.empty() && copy.data() == nullptr);
+    copy = moved;
+    moved = std::move(filled);
+    assert(copy[0] == F64(1.0) && moved[0] == F64(2.5) && filled.empty());
+
+    {
+        HeapArray<Tracked> tracked(5, Tracked(3));
+        assert(Tracked::live == 5 && tracked[4].value == 3);
+        HeapArray<Tracked> second = tracked;
+        assert(Tracked::live == 10);
+        second = HeapArray<Tracked>(2);
+        assert(Tracked::live == 7);
+    }
+    assert(Tracked::live == 0);
+
+    // A throwing element constructor leaves nothing behind
+    Tracked::failAt = 3;
+    assert(throws<std::runtime_error>([] { HeapArray<Tracked> failing(10); }));
+    assert(Tracked::live == 0);
+    Tracked::failAt = -1;
+
+    assert(HeapArray<I64>(0).empty() && HeapArray<I64>().data() == nullptr);
+
+    // A count whose byte size wraps is rejected before anything is written
+    assert(throws<std::bad_array_new_length>([] { HeapArray<int64_t> huge(SIZE_MAX / 8 + 2); }));
+    assert(throws<std::bad_array_new_length>([] { MAllocArray<I64>(SIZE_MAX); }));
+
+    std::cout << "  ✓ Aligned, zeroed storage; copies, moves and failed builds clean up; oversized counts throw\n";
+}
+
+void test_kernel_interop() {
+    std::cout << "\n🔹 Testing SIMD kernels over arrays...\n";
+
+    HeapArray<F64> values(1000);
+    Array<F64, 1000> weights{};
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = F64(0.5 + static_cast<double>(i));
+        weights[i] = F64(i % 2 ? -1.0 : 1.0);
+    }
+    assert(sum(values) == sum(values.data(), values.size()));
+    assert(sum(values, Summation::COMPENSATED) == F64(500000.0));
+    assert(dot(values, weights, Summation::NAIVE) == dot(values.data(), weights.data(), 1000, Summation::NAIVE));
+    assert(dot(values, weights) == F64(-500.0));
+    assert(norm(weights.slice().first(4)) == F64(2.0));
+    assert(sum(Slice<const F64>(values).subslice(10, 2)) == F64(22.0));
+    assert(throws<std::invalid_argument>([&] { dot(values, weights.slice().first(999)); }));
+
+    std::vector<F32> singles(17, F32(1.0f));
+    assert(sum(Slice<const F32>(singles)) == F32(17.0f));
+
+    Array<Q15, 40> a{}, b{};
+    Array<Q15, 40> out{};
+    for (size_t i = 0; i < a.size(); ++i) {
+        a[i] = Q15(0.5);
+        b[i] = Q15(-0.25);
+    }
+    multiplyArray(a, b, out);
+    assert(out[39] == Q15(-0.125));
+    assert(dot(a, b) == Q15Accumulator(-5.0));
+    HeapArray<Q15> shorter(39);
+    assert(throws<std::invalid_argument>([&] { multiplyArray(a, b, shorter); }));
+
+    std::cout << "  ✓ sum, dot, norm, multiplyArray and Q15 dot take arrays and slices\n";
+}
+
+void benchmark_indexing() {
+    std::cout << "\n🔹 Benchmarking indexed loops (64K I32, in cache)...\n";
+
+    const size_t count = 1 << 16;
+    const int rounds = 2000;
+    HeapArray<I32> values(count);
+    for (size_t i = 0; i < count; ++i) {
+        values[i] = I32(static_cast<int32_t>(i * 2654435761u));
+    }
+    const Slice<const I32> checked = values;
+    const Slice<const I32, checking::Unchecked> unchecked = values;
+    const int32_t* raw = reinterpret_cast<const int32_t*>(values.data());
+
+    int64_t sink = 0;
+    const double rawNanos = nanosPerValue(count, rounds, [&] {
+        int64_t total = 0;
+        for (size_t i = 0; i < count; ++i) {
+            total += raw[i];
+        }
+        sink += total;
+    });
+    const double checkedNanos = nanosPerValue(count, rounds, [&] {
+        int64_t total = 0;
+        for (size_t i = 0; i < checked.size(); ++i) {
+            total += checked[i];
+        }
+        sink += total;
+    });
+    const double rangeNanos = nanosPerValue(count, rounds, [&] {
+        int64_t total = 0;
+        for (const I32& value : checked) {
+            total += value;
+        }
+        sink += total;
+    });
+    const double uncheckedNanos = nanosPerValue(count, rounds, [&] {
+        int64_t total = 0;
+        for (size_t i = 0; i < unchecked.size(); ++i) {
+            total += unchecked[i];
+        }
+        sink += total;
+    });
+    // Strided access the compiler cannot prove in range
+    const double stridedNanos = nanosPerValue(count, rounds / 4, [&] {
+        int64_t total = 0;
+        for (size_t i = 0, j = 0; i < count; ++i, j = (j + 40503) & (count - 1)) {
+            total += checked[j];
+        }
+        sink += total;
+    });
+    assert(sink != 0);
+
+    std::cout << "  raw pointer " << rawNanos << " ns/value, checked operator[] " << checkedNanos
+              << ", range-for " << rangeNanos << ", Unchecked policy " << uncheckedNanos
+              << ", checked strided " << stridedNanos << "\n";
+}
@@ -0,0 +1,355 @@
+#include "../types/bits.hpp"
+#include "../types/unsigned_int.hpp"
+#include "../types/signed_int.hpp"
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <random>
+#include <vector>
+
+using namespace holycpp;
+
+// Test function prototypes
+void test_known_values();
+void test_against_reference();
+void test_signed_patterns();
+void test_arrays();
+void benchmark_popcount();
+void benchmark_byte_swap();
+void benchmark_extract();
+
+int main() {
+    std::cout << "🧪 Running HolyC++ Bit Intrinsic Tests\n";
+    std::cout << "======================================\n";
+
+    try {
+        test_known_values();
+        test_against_reference();
+        test_signed_patterns();
+        test_arrays();
+        benchmark_popcount();
+        benchmark_byte_swap();
+        benchmark_extract();
+
+        std::cout << "\n✅ All bit intrinsic tests passed!\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ Test failed: " << e.what() << "\n";
+        return 1;
+    }
+}
+
+// Usable in constant expressions
+static_assert(bits::popcount(uint64_t(0xFF00FF)) == 16);
+static_assert(bits::countLeadingZeros(uint16_t(1)) == 15);
+static_assert(bits::countTrailingZeros(uint8_t(0)) == 8);
+static_assert(bits::byteSwap(uint32_t(0x11223344)) == 0x44332211u);
+static_assert(bits::rotateRight(uint8_t(0x01), 1) == 0x80);
+
+void test_known_values() {
+    std::cout << "\n🔹 Testing known values...\n";
+
+    assert(U32(0x12345678u).byte_swap() == 0x78563412u);
+    assert(U16(0x00F0).popcount() == 4);
+    assert(U64(0).leading_zeros() == 64 && U64(0).trailing_zeros() == 64);
+    assert(U64(1).leading_zeros() == 63 && U8(0x80).trailing_zeros() == 7);
+    assert(U8(0x81).rotate_left(1) == 0x03 && U8(0x81).rotate_right(1) == 0xC0);
+    assert(U32(0x80000001u).rotate_left(36) == 0x18u);   // Counts are taken modulo the width
+    assert(U16(0xABCD).rotate_left(0) == 0xABCD);
+
+    // PEXT gathers the masked bits; PDEP puts them back
+    assert(U8(0xB6).extract_bits(0xF0) == 0x0B);
+    assert(U8(0x0B).deposit_bits(0xF0) == 0xB0);
+    assert(U64(0xDEADBEEFCAFEF00Dull).extract_bits(0xFF000000000000FFull) == 0xDE0D);
+    assert(U32(0b101).deposit_bits(0b1010100) == 0b1000100);
+
+    std::cout << "  ✓ Counts, swaps, rotates, extract and deposit\n";
+}
+
+// Bit-at-a-time versions to check against
+template<typename T>
+struct Reference {
+    static constexpr int BITS = sizeof(T) * 8;
+
+    static bool bit(T value, int i) { return (value >> i) & 1; }
+
+    static int popcount(T value) {
+        int count = 0;
+        for (int i = 0; i < BITS; ++i) {
+            count += bit(value, i);
+        }
+        return count;
+    }
+
+    static int leadingZeros(T value) {
+        int count = 0;
+        for (int i = BITS - 1; i >= 0 && !bit(value, i); --i) {
+            ++count;
+        }
+        return count;
+    }
+
+    static int trailingZeros(T value) {
+        int count = 0;
+        for (int i = 0; i < BITS && !bit(value, i); ++i) {
+            ++count;
+        }
+        return count;
+    }
+
+    static T byteSwap(T value) {
+        T result = 0;
+        for (size_t i = 0; i < sizeof(T); ++i) {
+            result = static_cast<T>(result | (((value >> (8 * i)) & 0xFF) << (8 * (sizeof(T) - 1 - i))));
+        }
+        return result;
+    }
+
+    static T rotateLeft(T value, unsigned count) {
+        T result = 0;
+        for (int i = 0; i < BITS; ++i) {
+            if (bit(value, i)) {
+                result = static_cast<T>(result | (T(1) << ((i + count) % BITS)));
+            }
+        }
+        return result;
+    }
+
+    static T extract(T value, T mask) {
+        T result = 0;
+        int out = 0;
+        for (int i = 0; i < BITS; ++i) {
+            if (bit(mask, i)) {
+                result = static_cast<T>(result | (T(bit(value, i)) << out++));
+            }
+        }
+        return result;
+    }
+
+    static T deposit(T value, T mask) {
+        T result = 0;
+        int in = 0;
+        for (int i = 0; i < BITS; ++i) {
+            if (bit(mask, i)) {
+                result = static_cast<T>(result | (T(bit(value, in++)) << i));
+            }
+        }
+        return result;
+    }
+};
+
+template<typename U>
+static void checkWidth(std::mt19937_64& rng) {
+    using T = typename U::storage_type;
+    using R = Reference<T>;
+
+    std::vector<T> samples = {0, 1, U::MAX, static_cast<T>(U::MAX >> 1), static_cast<T>(T(1) << (U::BITS - 1))};
+    for (int i = 0; i < 2000; ++i) {
+        T value = static_cast<T>(rng());
+        value = static_cast<T>(value >> (rng() % U::BITS));   // Vary the leading zeros
+        samples.push_back(value);
+    }
+
+    for (T raw : samples) {
+        const U value(raw);
+        const T mask = static_cast<T>(rng());
+        const unsigned count = static_cast<unsigned>(rng() % 200);
+        assert(value.popcount() == R::popcount(raw));
+        assert(value.leading_zeros() == R::leadingZeros(raw));
+        assert(value.trailing_zeros() == R::trailingZeros(raw));
+        assert(value.byte_swap() == R::byteSwap(raw));
+        assert(value.rotate_left(count) == R::rotateLeft(raw, count));
+        assert(value.rotate_right(count).rotate_left(count) == value);
+        assert(value.extract_bits(mask) == R::extract(raw, mask));
+        assert(value.deposit_bits(mask) == R::deposit(raw, mask));
+        assert(value.extract_bits(mask).deposit_bits(mask) == (value & U(mask)));
+    }
+}
+
+void test_against_reference() {
+    std::cout << "\n🔹 Testing every width against bit-at-a-time loops...\n";
+
+    std::mt19937_64 rng(42);
+    checkWidth<U8>(rng);
+    checkWidth<U16>(rng);
+    checkWidth<U32>(rng);
+    checkWidth<U64>(rng);
+
+    std::cout << "  ✓ U8, U16, U32 and U64 agree on 2005 values each\n";
+}
+
+void test_signed_patterns() {
+    std::cout << "\n🔹 Testing signed types...\n";
+
+    assert(I8(-1).popcount() == 8);
+    assert(I32(-1).leading_zeros() == 0 && I64(-8).trailing_zeros() == 3);
+    assert(I16(0x1234).byte_swap() == 0x3412);
+    assert(I16(0x00FF).byte_swap() == -256);
+    assert(I8(-128).rotate_left(1) == 1);
+    assert(I8(1).rotate_right(1) == -128);
+
+    // Masks are unsigned bit patterns, so any mask fits
+    assert(I64(-1).extract_bits(0xFFFF000000000000ull) == 0xFFFF);
+    assert(I32(-1).deposit_bits(0x80000000u) == I32::MIN);
+    assert(I16::from_bits(U16(0xFFFE)) == -2);
+
+    std::cout << "  ✓ Operations act on the two's-complement pattern\n";
+}
+
+void test_arrays() {
+    std::cout << "\n🔹 Testing array operations...\n";
+
+    std::mt19937_64 rng(7);
+    for (size_t length : {0, 1, 3, 4, 7, 1001}) {
+        std::vector<uint64_t> words(length);
+        for (auto& word : words) {
+            word = rng();
+        }
+
+        uint64_t expected = 0;
+        for (uint64_t word : words) {
+            expected += static_cast<uint64_t>(bits::popcount(word));
+        }
+        assert(bits::popcountArray(words.data(), words.size()) == expected);
+
+        std::vector<uint64_t> swapped = words;
+        bits::byteSwapArray(swapped.data(), swapped.size());
+        std::vector<uint32_t> narrow(length);
+        std::vector<uint16_t> narrower(length);
+        for (size_t i = 0; i < length; ++i) {
+            narrow[i] = static_cast<uint32_t>(words[i]);
+            narrower[i] = static_cast<uint16_t>(words[i]);
+        }
+        bits::byteSwapArray(narrow.data(), narrow.size());
+        bits::byteSwapArray(narrower.data(), narrower.size());
+
+        std::vector<uint64_t> rotated = words;
+        std::vector<uint32_t> rotatedNarrow(length);
+        for (size_t i = 0; i < length; ++i) {
+            rotatedNarrow[i] = static_cast<uint32_t>(words[i]);
+        }
+        bits::rotateLeftArray(rotated.data(), rotated.size(), 13);
+        bits::rotateLeftArray(rotatedNarrow.data(), rotatedNarrow.size(), 45);
+
+        const uint64_t mask = 0x0F0F00FF0000F00Full;
+        std::vector<uint64_t> extracted(length), deposited(length);
+        bits::extractBitsArray(words.data(), extracted.data(), length, mask);
+        bits::depositBitsArray(words.data(), deposited.data(), length, mask);
+
+        for (size_t i = 0; i < length; ++i) {
+            assert(swapped[i] == bits::byteSwap(words[i]));
+            assert(narrow[i] == bits::byteSwap(static_cast<uint32_t>(words[i])));
+            assert(narrower[i] == bits::byteSwap(static_cast<uint16_t>(words[i])));
+            assert(rotated[i] == bits::rotateLeft(words[i], 13));
+            assert(rotatedNarrow[i] == bits::rotateLeft(static_cast<uint32_t>(words[i]), 13));
+            assert(extracted[i] == Reference<uint64_t>::extract(words[i], mask));
+            assert(deposited[i] == Reference<uint64_t>::deposit(words[i], mask));
+        }
+    }
+
+    std::cout << "  ✓ Array results match the scalar ones (AVX2 " << (bits::cpuHasAvx2() ? "yes" : "no")
+              << ", BMI2 " << (bits::cpuHasBmi2() ? "yes" : "no") << ")\n";
+}
+
+static std::vector<uint64_t> randomWords(size_t count) {
+    std::mt19937_64 rng(123);
+    std::vector<uint64_t> words(count);
+    for (auto& word : words) {
+        word = rng();
+    }
+    return words;
+}
+
+template<typename F>
+static double timeMs(int rounds, F body) {
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int r = 0; r < rounds; ++r) {
+        body();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+void benchmark_popcount() {
+    std::cout << "\n🔹 Benchmarking popcount...\n";
+
+    const std::vector<uint64_t> words = randomWords(1 << 20);
+    const int rounds = 20;
+    volatile uint64_t sink = 0;
+
+    uint64_t loopTotal = 0, scalarTotal = 0, arrayTotal = 0;
+    double loopMs = timeMs(rounds, [&] {
+        uint64_t total = 0;
+        for (uint64_t word : words) {
+            for (int b = 0; b < 64; ++b) {
+                total += (word >> b) & 1;
+            }
+        }
+        loopTotal = total;
+    });
+    double scalarMs = timeMs(rounds, [&] {
+        uint64_t total = 0;
+        for (uint64_t word : words) {
+            total += static_cast<uint64_t>(U64(word).popcount());
+        }
+        scalarTotal = total;
+    });
+    double arrayMs = timeMs(rounds, [&] { arrayTotal = bits::popcountArray(words.data(), words.size()); });
+    assert(loopTotal == scalarTotal && scalarTotal == arrayTotal);
+    sink = arrayTotal;
+    (void)sink;
+
+    std::cout << "  " << rounds << " x 1M words: hand loop " << loopMs << " ms, U64::popcount() " << scalarMs
+              << " ms, popcountArray " << arrayMs << " ms\n";
+}
+
+void benchmark_byte_swap() {
+    std::cout << "\n🔹 Benchmarking byte swaps...\n";
+
+    std::vector<uint32_t> loopWords(1 << 20), arrayWords(1 << 20);
+    for (size_t i = 0; i < loopWords.size(); ++i) {
+        loopWords[i] = arrayWords[i] = static_cast<uint32_t>(i * 2654435761u);
+    }
+    const int rounds = 51;   // Odd, so both end swapped
+
+    double loopMs = timeMs(rounds, [&] {
+        for (uint32_t& word : loopWords) {
+            uint32_t swapped = 0;
+            for (int b = 0; b < 4; ++b) {
+                swapped = (swapped << 8) | ((word >> (8 * b)) & 0xFF);
+            }
+            word = swapped;
+        }
+    });
+    double arrayMs = timeMs(rounds, [&] { bits::byteSwapArray(arrayWords.data(), arrayWords.size()); });
+    assert(loopWords == arrayWords);
+
+    std::cout << "  " << rounds << " x 1M U32: hand loop " << loopMs << " ms, byteSwapArray " << arrayMs << " ms\n";
+}
+
+void benchmark_extract() {
+    std::cout << "\n🔹 Benchmarking bit extract...\n";
+
+    const std::vector<uint64_t> words = randomWords(1 << 18);
+    std::vector<uint64_t> loopOut(words.size()), arrayOut(words.size());
+    const uint64_t mask = 0x00FF00FF0F0F3333ull;
+    const int rounds = 20;
+
+    double loopMs = timeMs(rounds, [&] {
+        for (size_t i = 0; i < words.size(); ++i) {
+            uint64_t result = 0;
+            int out = 0;
+            for (int b = 0; b < 64; ++b) {
+                if ((mask >> b) & 1) {
+                    result |= ((words[i] >> b) & 1) << out++;
+                }
+            }
+            loopOut[i] = result;
+        }
+    });
+    double arrayMs = timeMs(rounds, [&] { bits::extractBitsArray(words.data(), arrayOut.data(), words.size(), mask); });
+    assert(loopOut == arrayOut);
+
+    std::cout << "  " << rounds << " x 256K words: hand loop " << loopMs << " ms, extractBitsArray " << arrayMs
+              << " ms\n";
+}
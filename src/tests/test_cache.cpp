@@ -0,0 +1,321 @@
+#include "../compiler/compile_cache.hpp"
+#include "../compiler/compile_unit.hpp"
+#include "../runtime/bytecode.hpp"
+#include "../runtime/tiered.hpp"
+#include "../lib/error.hpp"
+#include "../lib/error_types.hpp"
+#include "bytecode_fixture.hpp"
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+using namespace holycpp;
+using namespace holycpp::testing;
+namespace fs = std::filesystem;
+
+// Test function prototypes
+void test_cache_keys();
+void test_cache_roundtrip();
+void test_corrupt_entries();
+void test_incremental_rebuild();
+void benchmark_edit_rebuild();
+
+std::string cacheDir(const std::string& name) {
+    fs::path dir = fs::temp_directory_path() / ("holyc_cache_" + name);
+    fs::remove_all(dir);
+    return dir.string();
+}
+
+int main() {
+    std::cout << "🧪 Running HolyC++ Compile Cache Tests\n";
+    std::cout << "=======================================\n";
+
+    try {
+        test_cache_keys();
+        test_cache_roundtrip();
+        test_corrupt_entries();
+        test_incremental_rebuild();
+        benchmark_edit_rebuild();
+
+        std::cout << "\n✅ All compile cache tests passed!\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ Test failed: " << e.what() << "\n";
+        return 1;
+    }
+}
+
+void test_cache_keys() {
+    std::cout << "\n🔹 Testing content hash keys...\n";
+
+    const Function base = makeLoop(4);
+    const CacheKey key = CompileCache::keyFor(base, 0, 1);
+    assert(key == CompileCache::keyFor(makeLoop(4), 0, 1));
+    assert(key.toString().size() == 16);
+
+    Function edited = base;
+    edited.code[3].op = OpCode::ADD_I64;
+    assert(CompileCache::keyFor(edited, 0, 1) != key);
+
+    edited = base;
+    edited.constants[0] = Reg::ofInt(99);
+    assert(CompileCache::keyFor(edited, 0, 1) != key);
+
+    edited = base;
+    edited.location.filename = "other.hc";   // Diagnostics carry the file
+    assert(CompileCache::keyFor(edited, 0, 1) != key);
+
+    // Moving the function within its file keeps the key
+    edited = base;
+    edited.location.line += 1;
+    edited.location.column += 4;
+    assert(CompileCache::keyFor(edited, 0, 1) == key);
+
+    edited = base;
+    edited.name = "Renamed";
+    assert(CompileCache::keyFor(edited, 0, 1) != key);
+
+    assert(CompileCache::keyFor(base, 1, 1) != key);   // Dependency changed
+    assert(CompileCache::keyFor(base, 0, 0) != key);   // Options changed
+
+    std::cout << "  ✓ Keys change with every input the pipeline reads, not position\n";
+}
+
+void test_cache_roundtrip() {
+    std::cout << "\n🔹 Testing entry round trip...\n";
+
+    CompileCache cache(cacheDir("roundtrip"));
+    Function fn = makeDivByZero(2);
+    const CacheKey key = CompileCache::keyFor(fn, 7, 1);
+
+    CacheEntry entry;
+    assert(!cache.lookup(key, fn.location, entry));
+
+    std::vector<std::unique_ptr<CompilerError>> diagnostics;
+    FoldStats stats = foldConstants(fn, diagnostics);
+    assert(diagnostics.size() == 1);
+    diagnostics.push_back(std::make_unique<CompilerError>(
+        ErrorSeverity::NOTE, "plain note", SourceLocation("unit.hc", 1, 2)));
+    cache.store(key, fn, stats, diagnostics);
+
+    assert(cache.lookup(key, fn.location, entry));
+    assert(entry.function.name == fn.name);
+    assert(entry.function.code == fn.code);
+    assert(entry.function.constants.size() == fn.constants.size());
+    assert(entry.function.location.toString() == fn.location.toString());
+    assert(entry.stats.foldedOps == stats.foldedOps);
+    assert(entry.stats.instructionsAfter == stats.instructionsAfter);
+
+    assert(entry.diagnostics.size() == 2);
+    for (size_t i = 0; i < diagnostics.size(); ++i) {
+        assert(entry.diagnostics[i]->format() == diagnostics[i]->format());
+        assert(entry.diagnostics[i]->getSeverity() == diagnostics[i]->getSeverity());
+    }
+    assert(entry.diagnostics[0]->getErrorCode() == "T012");
+
+    // Replayed at the function's new position: lines shift with it, and
+    // the column too on its first line
+    SourceLocation moved = fn.location;
+    moved.line += 10;
+    moved.column += 2;
+    assert(cache.lookup(key, moved, entry));
+    assert(entry.function.location.toString() == moved.toString());
+    assert(entry.diagnostics[0]->getLocation().toString() == moved.toString());
+    assert(entry.diagnostics[1]->getLocation().toString() == "unit.hc:11:2");
+
+    CacheStats counters = cache.stats();
+    assert(counters.hits == 2 && counters.misses == 1 && counters.stores == 1);
+
+    // Concurrent writers of one key each use their own temporary file
+    std::vector<std::thread> writers;
+    for (int t = 0; t < 8; ++t) {
+        writers.emplace_back([&] {
+            for (int i = 0; i < 20; ++i) {
+                cache.store(key, fn, stats, diagnostics);
+            }
+        });
+    }
+    for (auto& writer : writers) {
+        writer.join();
+    }
+    assert(cache.stats().stores == 1 + 8 * 20);
+    assert(cache.lookup(key, fn.location, entry) && entry.diagnostics.size() == 2);
+    for (const auto& item : fs::directory_iterator(cache.directory())) {
+        assert(item.path().string().find(".tmp.") == std::string::npos);
+    }
+
+    assert(cache.clear() == 1);
+    assert(!cache.lookup(key, fn.location, entry));
+    fs::remove_all(cache.directory());
+
+    std::cout << "  ✓ Bytecode, stats and diagnostics survive the disk\n";
+}
+
+void test_corrupt_entries() {
+    std::cout << "\n🔹 Testing corrupt and stale entries...\n";
+
+    CompileCache cache(cacheDir("corrupt"));
+    Function fn = makeLoop(9);
+    const CacheKey key = CompileCache::keyFor(fn, 0, 1);
+    std::vector<std::unique_ptr<CompilerError>> none;
+    cache.store(key, fn, FoldStats{}, none);
+
+    const fs::path path = fs::path(cache.directory()) / (key.toString() + ".hcc");
+    const auto size = fs::file_size(path);
+
+    // Truncated file
+    fs::resize_file(path, size / 2);
+    CacheEntry entry;
+    assert(!cache.lookup(key, fn.location, entry));
+
+    // Garbage with the right length
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out << std::string(size, 'x');
+    }
+    assert(!cache.lookup(key, fn.location, entry));
+
+    // An entry stored under a different key is not trusted
+    cache.store(CompileCache::keyFor(makeLoop(10), 0, 1), fn, FoldStats{}, none);
+    fs::copy_file(fs::path(cache.directory()) / (CompileCache::keyFor(makeLoop(10), 0, 1).toString() + ".hcc"),
+                  path, fs::copy_options::overwrite_existing);
+    assert(!cache.lookup(key, fn.location, entry));
+
+    // A different function whose hash collides with the stored key
+    cache.store(key, fn, FoldStats{}, none);
+    CacheKey colliding = CompileCache::keyFor(makeLoop(11), 0, 1);
+    colliding.hash = key.hash;
+    assert(!cache.lookup(colliding, fn.location, entry));
+    assert(cache.lookup(key, fn.location, entry));
+
+    assert(cache.stats().rejected == 4);
+    fs::remove_all(cache.directory());
+
+    std::cout << "  ✓ Bad entries are rejected as misses\n";
+}
+
+std::string dumpErrors() {
+    std::string out;
+    for (const auto& error : ErrorManager::get().getErrors()) {
+        out += error->format() + "\n";
+    }
+    return out;
+}
+
+void test_incremental_rebuild() {
+    std::cout << "\n🔹 Testing incremental rebuilds...\n";
+
+    CompileCache cache(cacheDir("incremental"));
+    CompileOptions options;
+    options.cache = &cache;
+    options.dependencyHash = 0xC0FFEE;
+    WorkStealingPool pool(4);
+
+    // Cold build
+    ErrorManager::get().clear();
+    std::vector<Function> cold = makeUnit(200, true, false);
+    UnitResult first = compileUnit(cold, pool, options);
+    const std::string coldOutput = dumpErrors();
+    const int coldErrors = ErrorManager::get().getErrorCount();
+    assert(first.cacheHits == 0);
+    assert(coldErrors > 0);
+
+    // Warm build: everything hits, the same diagnostics are replayed
+    ErrorManager::get().clear();
+    std::vector<Function> warm = makeUnit(200, true, false);
+    UnitResult second = compileUnit(warm, pool, options);
+    assert(second.cacheHits == 200);
+    assert(dumpErrors() == coldOutput);
+    assert(ErrorManager::get().getErrorCount() == coldErrors);
+    assert(second.failed == first.failed);
+    for (size_t i = 0; i < warm.size(); ++i) {
+        assert(warm[i].code == cold[i].code);
+        if (warm[i].numParams == 1) {
+            Reg arg = Reg::ofInt(30);
+            assert(second.functions[i].code->run(&arg, 1).i == first.functions[i].code->run(&arg, 1).i);
+        }
+    }
+
+    // Editing one function recompiles only that function
+    ErrorManager::get().clear();
+    std::vector<Function> edited = makeUnit(200, true, false);
+    edited[50].constants[2] = Reg::ofInt(-1);
+    UnitResult third = compileUnit(edited, pool, options);
+    assert(third.cacheHits == 199);
+    assert(!third.functions[50].fromCache);
+    assert(dumpErrors() == coldOutput);
+
+    // A line inserted above every function still hits, and diagnostics move
+    ErrorManager::get().clear();
+    std::vector<Function> shifted = makeUnit(200, true, false);
+    for (Function& fn : shifted) {
+        fn.location.line += 1;
+    }
+    UnitResult fourth = compileUnit(shifted, pool, options);
+    assert(fourth.cacheHits == 200);
+    for (const auto& error : ErrorManager::get().getErrors()) {
+        const int line = error->getLocation().line;
+        assert(line % 10 == 1);   // Was seed * 10
+    }
+    assert(ErrorManager::get().getErrorCount() == coldErrors);
+
+    // A dependency change invalidates everything
+    options.dependencyHash = 0xBEEF;
+    ErrorManager::get().clear();
+    std::vector<Function> rebuilt = makeUnit(200, true, false);
+    assert(compileUnit(rebuilt, pool, options).cacheHits == 0);
+
+    ErrorManager::get().clear();
+    fs::remove_all(cache.directory());
+
+    std::cout << "  ✓ Unchanged functions are skipped and warnings replayed\n";
+}
+
+void benchmark_edit_rebuild() {
+    std::cout << "\n🔹 Benchmarking edit-rebuild latency...\n";
+
+    // 8000 functions x 13 instructions: ~100k bytecode lines
+    const size_t functions = 8000;
+    const std::vector<Function> source = makeUnit(functions, true, false);
+    size_t lines = 0;
+    for (const auto& fn : source) {
+        lines += fn.code.size();
+    }
+
+    CompileCache cache(cacheDir("bench"));
+    CompileOptions cached;
+    cached.cache = &cache;
+    WorkStealingPool pool;
+
+    auto timeBuild = [&](std::vector<Function> unit, const CompileOptions& options, size_t& hits) {
+        ErrorManager::get().clear();
+        auto start = std::chrono::high_resolution_clock::now();
+        UnitResult result = compileUnit(unit, pool, options);
+        auto end = std::chrono::high_resolution_clock::now();
+        hits = result.cacheHits;
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    };
+
+    size_t hits = 0;
+    double uncached = timeBuild(source, CompileOptions{}, hits);
+    double cold = timeBuild(source, cached, hits);
+    double noop = timeBuild(source, cached, hits);
+    assert(hits == functions);
+
+    std::vector<Function> edited = source;
+    edited[functions / 2].constants[0] = Reg::ofInt(12345);
+    double oneEdit = timeBuild(edited, cached, hits);
+    assert(hits == functions - 1);
+
+    std::cout << "  Corpus: " << functions << " functions, " << lines << " lines\n";
+    std::cout << "  No cache:       " << uncached << " ms\n";
+    std::cout << "  Cold cache:     " << cold << " ms\n";
+    std::cout << "  No-op rebuild:  " << noop << " ms\n";
+    std::cout << "  One-edit build: " << oneEdit << " ms\n";
+
+    ErrorManager::get().clear();
+    fs::remove_all(cache.directory());
+}
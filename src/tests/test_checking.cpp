@@ -0,0 +1,278 @@
+#include "../types/unsigned_int.hpp"
+#include "../types/signed_int.hpp"
+#include "../lib/error.hpp"
+#include <iostream>
+#include <cassert>
+#include <chrono>
+
+using namespace holycpp;
+using namespace holycpp::checking;
+
+// Test function prototypes
+void test_default_policy();
+void test_unchecked();
+void test_trapping();
+void test_saturating();
+void test_reporting();
+void benchmark_policies();
+
+int main() {
+    std::cout << "🧪 Running HolyC++ Checking Policy Tests\n";
+    std::cout << "=========================================\n";
+
+    try {
+        test_default_policy();
+        test_unchecked();
+        test_trapping();
+        test_saturating();
+        test_reporting();
+        benchmark_policies();
+
+        std::cout << "\n✅ All checking policy tests passed!\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ Test failed: " << e.what() << "\n";
+        return 1;
+    }
+}
+
+template<typename F>
+static bool throwsOverflow(F f) {
+    try {
+        f();
+    } catch (const std::overflow_error&) {
+        return true;
+    }
+    return false;
+}
+
+void test_default_policy() {
+    std::cout << "\n🔹 Testing the default policy...\n";
+
+    static_assert(std::is_same_v<U8::policy_type, Basic>);
+    static_assert(std::is_same_v<I64, SInt<64, Basic>>);
+    static_assert(is_unsigned_holyc_v<UInt<16, Saturating>>);
+    static_assert(is_signed_holyc_v<SInt<32, Trapping>>);
+
+    // Wrapping, including the signed cases that used to be undefined
+    assert(U8(200) + U8(100) == 44);
+    assert(I32(I32::MAX) + I32(1) == I32::MIN);
+    I64 counter(I64::MAX);
+    ++counter;
+    assert(counter == I64::MIN);
+
+    // MIN % -1 is 0 instead of a hardware trap
+    assert(I64(I64::MIN) % I64(-1) == 0);
+
+    bool threw = false;
+    try {
+        U32 shifted = U32(1) << -1;
+        (void)shifted;
+    } catch (const std::out_of_range&) {
+        threw = true;
+    }
+    assert(threw);
+    assert(throwsOverflow([] { return -I16(I16::MIN); }));
+
+    // Policies convert into each other like widths do
+    UInt<32, Saturating> saturating = U8(7);
+    I64 widened = SInt<8, Unchecked>(int8_t(-3));
+    assert(saturating == 7u && widened == -3);
+
+    std::cout << "  ✓ Basic wraps +, -, * and checks the rest\n";
+}
+
+void test_unchecked() {
+    std::cout << "\n🔹 Testing Unchecked...\n";
+
+    using UU32 = UInt<32, Unchecked>;
+    using UI8 = SInt<8, Unchecked>;
+    assert(UU32(UU32::MAX) * UU32(2) == UU32::MAX - 1);
+    assert(-UI8(int8_t(UI8::MIN)) == UI8::MIN);
+
+    // Shift counts are masked to the storage width, as on x86
+    assert((UU32(1) << 33) == 2u);
+    assert((UInt<64, Unchecked>(8) >> 67) == 1u);
+
+    std::cout << "  ✓ No checks, wrapping and masked shifts\n";
+}
+
+void test_trapping() {
+    std::cout << "\n🔹 Testing Trapping...\n";
+
+    using TU8 = UInt<8, Trapping>;
+    using TI32 = SInt<32, Trapping>;
+    assert(TU8(200) + TU8(55) == 255);
+    assert(throwsOverflow([] { return TU8(200) + TU8(56); }));
+    assert(throwsOverflow([] { return TU8(16) * TU8(16); }));
+    assert(throwsOverflow([] { return TI32(TI32::MIN) - TI32(1); }));
+    assert(throwsOverflow([] { return TI32(TI32::MIN) * TI32(-1); }));
+    assert(throwsOverflow([] { TI32 value(TI32::MAX); value += TI32(1); return value; }));
+    assert(throwsOverflow([] { TI32 value(TI32::MAX); return ++value; }));
+
+    bool underflow = false;
+    try {
+        TU8 value = TU8(0) - TU8(1);
+        (void)value;
+    } catch (const std::underflow_error& e) {
+        underflow = std::string(e.what()) == "Unsigned subtraction underflow";
+    }
+    assert(underflow);
+
+    // Division and shifts keep Basic's checks
+    bool domain = false;
+    try {
+        TI32 value = TI32(1) / TI32(0);
+        (void)value;
+    } catch (const std::domain_error&) {
+        domain = true;
+    }
+    assert(domain);
+
+    std::cout << "  ✓ Every operator throws on overflow\n";
+}
+
+void test_saturating() {
+    std::cout << "\n🔹 Testing Saturating...\n";
+
+    using SU8 = UInt<8, Saturating>;
+    using SI8 = SInt<8, Saturating>;
+    assert(SU8(200) + SU8(100) == 255);
+    assert(SU8(10) - SU8(20) == 0);
+    assert(SU8(16) * SU8(16) == 255);
+    assert(SI8(int8_t(100)) + SI8(int8_t(100)) == 127);
+    assert(SI8(int8_t(-100)) - SI8(int8_t(100)) == -128);
+    assert(SI8(int8_t(-100)) * SI8(int8_t(2)) == -128);
+    assert(SI8(int8_t(-100)) * SI8(int8_t(-2)) == 127);
+    assert(SI8(SI8::MIN) / SI8(int8_t(-1)) == 127);
+    assert(-SI8(SI8::MIN) == 127);
+
+    // Division by zero saturates toward the dividend's sign
+    assert(SI8(int8_t(-5)) / SI8(int8_t(0)) == -128);
+    assert(SU8(5) / SU8(0) == 255);
+    assert(SU8(0) / SU8(0) == 0);
+    assert(SU8(5) % SU8(0) == 0);
+
+    // Left shifts that lose bits clamp; right shifts past the width empty out
+    assert((SU8(3) << 6) == 192);
+    assert((SU8(3) << 7) == 255);
+    assert((SI8(int8_t(-1)) << 7) == -128);
+    assert((SI8(int8_t(-2)) << 7) == -128);
+    assert((SI8(int8_t(-8)) >> 9) == -1);
+    assert((SU8(8) >> 9) == 0);
+
+    SU8 counter(250);
+    for (int i = 0; i < 10; ++i) {
+        ++counter;
+    }
+    assert(counter == 255);
+
+    std::cout << "  ✓ Results clamp to [MIN, MAX]\n";
+}
+
+void test_reporting() {
+    std::cout << "\n🔹 Testing Reporting...\n";
+
+    using RU16 = UInt<16, Reporting>;
+    using RI64 = SInt<64, Reporting>;
+    ErrorManager& manager = ErrorManager::get();
+    manager.clear();
+
+    // No fault, no diagnostic
+    assert(RU16(1000) * RU16(60) == 60000);
+    assert(manager.getWarningCount() == 0);
+
+    // Overflow wraps and warns
+    assert(RU16(1000) * RU16(70) == static_cast<uint16_t>(70000));
+    assert(manager.getWarningCount() == 1);
+    assert(manager.getErrors().back()->getMessage() == "Unsigned multiplication overflow");
+
+    RI64 value(RI64::MIN);
+    --value;
+    assert(value == RI64::MAX);
+    assert(manager.getWarningCount() == 2);
+
+    // Division faults are errors and yield 0
+    assert(RI64(7) / RI64(0) == 0);
+    assert(RU16(7) % RU16(0) == 0);
+    assert(manager.getErrorCount() == 2);
+    assert(manager.getErrors().back()->getMessage() == "Modulo by zero");
+
+    assert((RU16(1) << 16) == 0);
+    assert(manager.getWarningCount() == 3);
+    assert(manager.getErrors().back()->getMessage() == "Shift amount exceeds bit width");
+
+    manager.clear();
+    std::cout << "  ✓ Faults become diagnostics and execution continues\n";
+}
+
+// Multiply-add, division and shift over one type; returns a checksum. The
+// value stays small, so no policy ever faults and all agree on the result.
+template<typename Int>
+static uint64_t arithmeticLoop(int iterations, double& ms) {
+    Int acc(1);
+    Int step(3);
+    Int divisor(7);
+    Int shift(2);
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        Int index(static_cast<typename Int::storage_type>(i & 0xFFFF));
+        acc = acc * step + index;
+        acc -= acc / divisor;
+        acc >>= shift;
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    ms = std::chrono::duration<double, std::milli>(end - start).count();
+    return static_cast<uint64_t>(acc.raw());
+}
+
+template<template<size_t, typename> class Int>
+static void benchmarkWidth(const char* name, int iterations) {
+    double unchecked = 0, basic = 0, trapping = 0, saturating = 0, reporting = 0;
+    using Unchecked64 = Int<64, Unchecked>;
+    using Basic64 = Int<64, Basic>;
+    using Trapping64 = Int<64, Trapping>;
+    using Saturating64 = Int<64, Saturating>;
+    using Reporting64 = Int<64, Reporting>;
+    const uint64_t results[] = {
+        arithmeticLoop<Unchecked64>(iterations, unchecked),
+        arithmeticLoop<Basic64>(iterations, basic),
+        arithmeticLoop<Trapping64>(iterations, trapping),
+        arithmeticLoop<Saturating64>(iterations, saturating),
+        arithmeticLoop<Reporting64>(iterations, reporting),
+    };
+    for (uint64_t result : results) {
+        assert(result == results[0]);
+    }
+    assert(ErrorManager::get().getErrors().empty());
+    std::cout << "  " << name << ": unchecked " << unchecked << " ms, basic " << basic
+              << " ms, trapping " << trapping << " ms, saturating " << saturating
+              << " ms, reporting " << reporting << " ms\n";
+}
+
+void benchmark_policies() {
+    std::cout << "\n🔹 Benchmarking policies on a tight arithmetic loop...\n";
+
+    const int iterations = 20000000;
+    ErrorManager::get().clear();
+
+    // Baseline: the same loop on a plain uint64_t
+    const uint64_t divisor = 7;
+    uint64_t acc = 1;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        acc = acc * 3 + static_cast<uint64_t>(i & 0xFFFF);
+        acc -= acc / divisor;
+        acc >>= 2;
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    double raw = std::chrono::duration<double, std::milli>(end - start).count();
+    double unchecked = 0;
+    using Unchecked64 = UInt<64, Unchecked>;
+    const uint64_t result = arithmeticLoop<Unchecked64>(iterations, unchecked);
+    assert(result == acc);
+
+    std::cout << "  " << iterations << " iterations of *, +, -=, /, >>=; raw uint64_t " << raw << " ms\n";
+    benchmarkWidth<UInt>("U64", iterations);
+    benchmarkWidth<SInt>("I64", iterations);
+}
@@ -4,9 +4,29 @@
 #include <cassert>
 #include <memory>
 #include <sstream>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+#include <thread>
 
 using namespace holycpp;
 
+// Counts heap allocations so the fast path can be shown to allocate nothing.
+// Kept out of line so GCC does not pair the inlined malloc/free with new/delete.
+static std::atomic<size_t> allocationCount{0};
+
+[[gnu::noinline]] void* operator new(size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+[[gnu::noinline]] void operator delete(void* p) noexcept { std::free(p); }
+[[gnu::noinline]] void operator delete(void* p, size_t) noexcept { std::free(p); }
+
 // Test function prototypes
 void test_basic_errors();
 void test_source_location();
@@ -16,6 +36,15 @@ void test_contextual_errors();
 void test_error_codes();
 void test_internal_error();
 void test_error_formatting();
+void test_manager_fast_path();
+void test_concurrent_reporting();
+void benchmark_suppressed_diagnostics();
+void test_dedup_and_rate_limits();
+void benchmark_noisy_input();
+void test_lazy_messages();
+void benchmark_discarded_diagnostics();
+void test_context_tree();
+void benchmark_shared_context();
 
 int main() {
     std::cout << "🧪 Running HolyC++ Error System Tests\n";
@@ -30,6 +59,15 @@ int main() {
         test_error_codes();
         test_internal_error();
         test_error_formatting();
+        test_manager_fast_path();
+        test_concurrent_reporting();
+        benchmark_suppressed_diagnostics();
+        test_dedup_and_rate_limits();
+        benchmark_noisy_input();
+        test_lazy_messages();
+        benchmark_discarded_diagnostics();
+        test_context_tree();
+        benchmark_shared_context();
         
         std::cout << "\n✅ All error system tests passed!\n";
         return 0;
@@ -428,4 +466,520 @@ void test_error_recovery() {
     ErrorManager::get().setMaxErrors(100);
     
     std::cout << "  ✓ Error recovery and suppression\n";
-}
\ No newline at end of file
+}
+
+void test_manager_fast_path() {
+    std::cout << "\n🔹 Testing filtered reports skip allocation...\n";
+
+    ErrorManager& manager = ErrorManager::get();
+    manager.clear();
+    manager.setSuppressWarnings(true);
+    assert(manager.isFiltered(ErrorSeverity::WARNING));
+    assert(!manager.isFiltered(ErrorSeverity::NOTE));
+
+    size_t before = allocationCount.load();
+    for (int i = 0; i < 1000; ++i) {
+        manager.warning("A warning long enough to need a heap buffer if it were copied");
+    }
+    assert(!manager.hasErrors());
+    assert(allocationCount.load() == before);
+    assert(manager.getTotalCount() == 0);
+
+    // Suppression wins over warnings-as-errors
+    manager.setWarningsAsErrors(true);
+    manager.warning("Still suppressed");
+    assert(manager.getErrorCount() == 0);
+    manager.setWarningsAsErrors(false);
+    manager.setSuppressWarnings(false);
+
+    // Minimum severity drops notes and warnings, never errors
+    manager.setMinSeverity(ErrorSeverity::FATAL);
+    assert(manager.isFiltered(ErrorSeverity::NOTE));
+    assert(!manager.isFiltered(ErrorSeverity::ERROR));
+    manager.note("Dropped");
+    manager.warning("Dropped");
+    manager.report(std::make_unique<CompilerError>(ErrorSeverity::WARNING, "Dropped"));
+    manager.error("Kept");
+    assert(manager.getNoteCount() == 0 && manager.getWarningCount() == 0);
+    assert(manager.getErrorCount() == 1);
+    assert(manager.getErrors().size() == 1);
+
+    // Lowering the minimum leaves an explicit suppression in place
+    manager.setSuppressWarnings(true);
+    manager.setMinSeverity(ErrorSeverity::NOTE);
+    assert(!manager.isFiltered(ErrorSeverity::NOTE));
+    assert(manager.isFiltered(ErrorSeverity::WARNING));
+    manager.setSuppressWarnings(false);
+    assert(!manager.isFiltered(ErrorSeverity::WARNING));
+
+    manager.clear();
+    std::cout << "  ✓ Suppressed warnings cost no allocation\n";
+}
+
+void test_concurrent_reporting() {
+    std::cout << "\n🔹 Testing reports from several threads...\n";
+
+    ErrorManager& manager = ErrorManager::get();
+    manager.clear();
+    manager.setMaxErrors(1000000);
+
+    const int threads = 4;
+    const int perThread = 500;
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&manager, t] {
+            for (int i = 0; i < perThread; ++i) {
+                if (i % 2 == 0) {
+                    manager.error("Error from worker " + std::to_string(t));
+                } else {
+                    manager.warning("Warning from worker " + std::to_string(t));
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    assert(manager.getErrorCount() == threads * perThread / 2);
+    assert(manager.getWarningCount() == threads * perThread / 2);
+    assert(manager.getErrors().size() == static_cast<size_t>(threads * perThread));
+    assert(!manager.hasFatal());
+
+    manager.clear();
+    manager.setMaxErrors(100);
+    std::cout << "  ✓ Counters and storage agree under contention\n";
+}
+
+void benchmark_suppressed_diagnostics() {
+    std::cout << "\n🔹 Benchmarking the no-diagnostics fast path...\n";
+
+    ErrorManager& manager = ErrorManager::get();
+    manager.clear();
+    const int iterations = 2000000;
+
+    // Polling with nothing reported: what every compiler pass does
+    size_t before = allocationCount.load();
+    int seen = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        seen += manager.hasErrors();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    double pollNs = std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+    assert(seen == 0);
+
+    manager.setSuppressWarnings(true);
+    start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        manager.warning("Implicit conversion from I64 to U8 may truncate the value");
+    }
+    end = std::chrono::high_resolution_clock::now();
+    double suppressedNs = std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+    manager.setSuppressWarnings(false);
+    assert(allocationCount.load() == before);
+    assert(manager.getTotalCount() == 0);
+
+    // Reference: the cost of a warning that is actually kept
+    const int kept = 20000;
+    start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < kept; ++i) {
+        manager.warning("Implicit conversion from I64 to U8 may truncate the value");
+    }
+    end = std::chrono::high_resolution_clock::now();
+    double keptNs = std::chrono::duration<double, std::nano>(end - start).count() / kept;
+    assert(manager.getWarningCount() == kept);
+    manager.clear();
+
+    std::cout << "  hasErrors() poll: " << pollNs << " ns, suppressed warning: "
+              << suppressedNs << " ns, kept warning: " << keptNs << " ns\n";
+    std::cout << "  Suppressed warnings allocated nothing\n";
+}
+
+void test_dedup_and_rate_limits() {
+    std::cout << "\n🔹 Testing deduplication and rate limits...\n";
+
+    ErrorManager& manager = ErrorManager::get();
+    const ErrorCodeRegistry& registry = ErrorCodeRegistry::get();
+    manager.clear();
+    manager.setDeduplicate(true);
+
+    // Same code, location and message collapse to one
+    for (int i = 0; i < 1000; ++i) {
+        manager.report(registry.createError("T011", SourceLocation("gen.hc", 12, 1), "in 'F'"));
+    }
+    assert(manager.getWarningCount() == 1);
+    assert(manager.getErrors().size() == 1);
+    assert(manager.getDuplicateCount() == 999);
+
+    // Any differing component keeps the diagnostic
+    manager.report(registry.createError("T011", SourceLocation("gen.hc", 13, 1), "in 'F'"));
+    manager.report(registry.createError("T011", SourceLocation("other.hc", 12, 1), "in 'F'"));
+    manager.report(registry.createError("T011", SourceLocation("gen.hc", 12, 1), "in 'G'"));
+    manager.report(registry.createError("T010", SourceLocation("gen.hc", 12, 1), "in 'F'"));
+    assert(manager.getWarningCount() == 4);
+    assert(manager.getErrorCount() == 1);
+
+    // The fingerprint set grows past its initial capacity
+    for (int i = 0; i < 5000; ++i) {
+        manager.note("Distinct note", SourceLocation("grow.hc", i + 1, 1));
+        manager.note("Distinct note", SourceLocation("grow.hc", i + 1, 1));
+    }
+    assert(manager.getNoteCount() == 5000);
+    assert(manager.getDuplicateCount() == 999 + 5000);
+
+    // Fatal diagnostics are never dropped
+    manager.setMaxErrors(1000);
+    manager.fatal("Out of memory");
+    manager.fatal("Out of memory");
+    assert(manager.getErrorCount() == 3);
+    manager.setDeduplicate(false);
+    manager.clear();
+    manager.setMaxErrors(100);
+
+    // Per-code limits keep the first N and summarize the rest
+    manager.setRateLimit("T011", 3);
+    for (int line = 1; line <= 10; ++line) {
+        manager.report(registry.createError("T011", SourceLocation("gen.hc", line, 1)));
+    }
+    manager.report(registry.createError("T010", SourceLocation("gen.hc", 1, 1)));
+    manager.warning("Uncoded warnings are never limited");
+    assert(manager.getWarningCount() == 4);
+    assert(manager.getErrorCount() == 1);
+
+    auto suppressed = manager.getSuppressed();
+    assert(suppressed.size() == 1);
+    assert(suppressed[0].code == "T011" && suppressed[0].suppressed == 7);
+
+    std::stringstream dump;
+    manager.dumpAll(dump);
+    assert(dump.str().find("T011: 7 more suppressed") != std::string::npos);
+
+    manager.reportSuppressed();
+    assert(manager.getSuppressed().empty());
+    const auto& last = manager.getErrors().back();
+    assert(last->isNote() && last->getErrorCode() == "T011");
+    assert(last->getMessage() == "7 more diagnostic(s) suppressed");
+
+    // A default limit applies to every coded diagnostic; clear() resets counts
+    manager.clear();
+    manager.setRateLimit("T011", 0);
+    manager.setDefaultRateLimit(2);
+    for (int line = 1; line <= 5; ++line) {
+        manager.report(registry.createError("T011", SourceLocation("gen.hc", line, 1)));
+        manager.report(registry.createError("T010", SourceLocation("gen.hc", line, 1)));
+    }
+    assert(manager.getWarningCount() == 5);   // Explicit 0 overrides the default
+    assert(manager.getErrorCount() == 2);
+    manager.setDefaultRateLimit(0);
+    manager.clear();
+
+    std::cout << "  ✓ Duplicates dropped, noisy codes capped and summarized\n";
+}
+
+void benchmark_noisy_input() {
+    std::cout << "\n🔹 Benchmarking a noisy generated file...\n";
+
+    // 200k missing-return warnings from 50 generated functions
+    const int reports = 200000;
+    const ErrorCodeRegistry& registry = ErrorCodeRegistry::get();
+    ErrorManager& manager = ErrorManager::get();
+    manager.setMaxErrors(reports + 1);
+
+    auto run = [&](bool bounded) {
+        manager.clear();
+        manager.setDeduplicate(bounded);
+        manager.setRateLimit("T011", bounded ? 20 : 0);
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < reports; ++i) {
+            manager.report(registry.createError("T011", SourceLocation("gen.hc", 10 + i % 50, 1)));
+        }
+        std::stringstream out;
+        manager.dumpAll(out);
+        auto end = std::chrono::high_resolution_clock::now();
+        return std::make_pair(std::chrono::duration<double, std::milli>(end - start).count(),
+                              manager.getErrors().size());
+    };
+
+    auto [plainMs, plainStored] = run(false);
+    auto [boundedMs, boundedStored] = run(true);
+    assert(plainStored == static_cast<size_t>(reports));
+    assert(boundedStored == 20);
+    assert(manager.getDuplicateCount() == reports - 50);
+
+    manager.setDeduplicate(false);
+    manager.setRateLimit("T011", 0);
+    manager.clear();
+    manager.setMaxErrors(100);
+
+    std::cout << "  Unbounded: " << plainMs << " ms, " << plainStored << " stored; dedup + limit 20: "
+              << boundedMs << " ms, " << boundedStored << " stored\n";
+}
+
+// Stands in for TypeTable: anything with name(id) can spell TYPE arguments
+struct FakeTypeNames {
+    std::string name(uint32_t id) const { return id == 4 ? "I64" : "U" + std::to_string(id * 8); }
+};
+
+void test_lazy_messages() {
+    std::cout << "\n🔹 Testing lazy message rendering...\n";
+
+    FakeTypeNames types;
+    const std::string ident = "counter";
+    SourceLocation loc("lazy.hc", 7, 3);
+
+    TypeError typed(TypeError::Code::TYPE_MISMATCH, loc,
+                    DiagArg::type(4, types), DiagArg::type(1, types), DiagArg::name(&ident));
+    assert(!typed.isRendered());
+    assert(typed.getErrorCode() == "T001");
+    assert(typed.getMessage() == "Type mismatch (I64 vs U8): counter");
+    assert(typed.isRendered());
+
+    // Typed and string arguments render identically
+    TypeError spelled(TypeError::Code::TYPE_MISMATCH, loc, "I64", "U8", "counter");
+    assert(spelled.getMessage() == typed.getMessage());
+    assert(spelled.format() == typed.format());
+
+    // TEXT arguments are owned: the source may die and copies stay valid
+    std::unique_ptr<TypeError> copy;
+    {
+        std::string temporary = "array of " + std::to_string(-3) + " elements";
+        TypeError original(TypeError::Code::INVALID_ARRAY_SIZE, loc,
+                           DiagArg::integer(-3), DiagArg(), DiagArg::text(temporary));
+        copy = std::make_unique<TypeError>(original);
+    }
+    assert(copy->getMessage() == "Invalid array size (-3): array of -3 elements");
+
+    assert(ParserError(ParserError::Code::EXPECTED_TOKEN, loc,
+                       DiagArg::literal("in call"), DiagArg::literal("')'")).getMessage()
+           == "Expected token, expected: ')' (in call)");
+    assert(LexerError(LexerError::Code::NUMBER_TOO_LARGE, loc, DiagArg::integer(300)).getMessage()
+           == "Number too large for type: 300");
+    assert(SemanticError(SemanticError::Code::MISSING_MAIN, loc).getMessage() == "Missing main function");
+    assert(CodeGenError(CodeGenError::Code::INVALID_IR, loc, DiagArg::name(nullptr)).getMessage()
+           == "Invalid IR generated");
+
+    // Severity comes from the registry without rendering anything
+    TypeError missing(TypeError::Code::MISSING_RETURN, loc, DiagArg::name(&ident));
+    assert(missing.isWarning() && !missing.isRendered());
+
+    // Context is appended after the rendered message
+    missing.pushContext("In function 'Main'");
+    assert(missing.format() == "T011: warning: Missing return statement (counter)\n"
+                               "  at lazy.hc:7:3\n  In function 'Main'");
+
+    // Reported diagnostics own their names and type spellings
+    ErrorManager& manager = ErrorManager::get();
+    manager.clear();
+    {
+        auto scopedTypes = std::make_unique<FakeTypeNames>();
+        auto scopedName = std::make_unique<std::string>("shortLived");
+        manager.report(std::make_unique<TypeError>(TypeError::Code::TYPE_MISMATCH, loc,
+                                                   DiagArg::type(4, *scopedTypes), DiagArg::literal("U8"),
+                                                   DiagArg::name(scopedName.get())));
+    }
+    assert(!manager.getErrors().back()->isRendered());
+    assert(manager.getErrors().back()->getMessage() == "Type mismatch (I64 vs U8): shortLived");
+    manager.clear();
+
+    // Deduplication fingerprints typed arguments without rendering them
+    manager.setDeduplicate(true);
+    const std::string other = "total";
+    for (int i = 0; i < 3; ++i) {
+        manager.report(std::make_unique<TypeError>(TypeError::Code::TYPE_MISMATCH, loc,
+                                                   DiagArg::type(4, types), DiagArg::type(1, types),
+                                                   DiagArg::name(&ident)));
+    }
+    manager.report(std::make_unique<TypeError>(TypeError::Code::TYPE_MISMATCH, loc,
+                                               DiagArg::type(4, types), DiagArg::type(1, types),
+                                               DiagArg::name(&other)));
+    // A TEXT argument hashes like the same NAME
+    manager.report(std::make_unique<TypeError>(TypeError::Code::TYPE_MISMATCH, loc,
+                                               DiagArg::type(4, types), DiagArg::type(1, types),
+                                               DiagArg::text("total")));
+    assert(manager.getErrors().size() == 2);
+    assert(manager.getDuplicateCount() == 3);
+    for (const auto& error : manager.getErrors()) {
+        assert(!error->isRendered());
+    }
+    manager.setDeduplicate(false);
+    manager.clear();
+
+    std::cout << "  ✓ Messages render on first use, identical to eager text\n";
+}
+
+void benchmark_discarded_diagnostics() {
+    std::cout << "\n🔹 Benchmarking discarded speculative diagnostics...\n";
+
+    // Overload resolution tries candidates and throws most diagnostics away
+    const int candidates = 200000;
+    FakeTypeNames types;
+    const std::string callee = "Print";
+    const char* typeNames[] = {"U8", "I16", "I64", "F64"};
+    SourceLocation loc("call.hc", 42, 9);
+
+    auto measure = [&](auto&& makeDiagnostic) {
+        size_t allocationsBefore = allocationCount.load();
+        size_t sink = 0;
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < candidates; ++i) {
+            sink += makeDiagnostic(i);
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        assert(sink > 0);
+        double ns = std::chrono::duration<double, std::nano>(end - start).count() / candidates;
+        double allocations = static_cast<double>(allocationCount.load() - allocationsBefore) / candidates;
+        return std::make_pair(ns, allocations);
+    };
+
+    // Eager: what every diagnostic used to cost, text built at construction
+    auto eager = measure([&](int i) {
+        TypeError error(TypeError::Code::INVALID_FUNCTION_CALL, loc, typeNames[i % 4], "I64",
+                        "no overload of '" + callee + "' accepts argument " + std::to_string(i % 3));
+        return error.getMessage().size();
+    });
+    auto stringArgs = measure([&](int i) {
+        TypeError error(TypeError::Code::INVALID_FUNCTION_CALL, loc, typeNames[i % 4], "I64", callee);
+        return static_cast<size_t>(!error.isRendered());
+    });
+    auto typedArgs = measure([&](int i) {
+        TypeError error(TypeError::Code::INVALID_FUNCTION_CALL, loc, DiagArg::type(i % 4 + 1, types),
+                        DiagArg::literal("I64"), DiagArg::name(&callee));
+        return static_cast<size_t>(!error.isRendered());
+    });
+
+    std::cout << "  Rendered at construction: " << eager.first << " ns, " << eager.second << " allocs\n";
+    std::cout << "  Lazy, string arguments:   " << stringArgs.first << " ns, " << stringArgs.second << " allocs\n";
+    std::cout << "  Lazy, typed arguments:    " << typedArgs.first << " ns, " << typedArgs.second << " allocs\n";
+}
+
+void test_context_tree() {
+    std::cout << "\n🔹 Testing the shared context tree...\n";
+
+    ErrorManager& manager = ErrorManager::get();
+    manager.clear();
+    std::shared_ptr<ContextTree> owner = manager.contextTree();
+    ContextTree& tree = *owner;
+    const ContextFrame* function = tree.push(nullptr, "In function 'Tree'");
+    const ContextFrame* loop = tree.push(function, "In loop at line 4");
+    assert(tree.push(nullptr, "In function 'Tree'") == function);   // Interned
+    assert(loop->parent == function && loop->depth == 2);
+    assert(tree.push(nullptr, "In loop at line 4") != loop);        // Different parent
+
+    // Every diagnostic in the function points at the same chain
+    ContextualError first(ErrorSeverity::ERROR, "First");
+    ContextualError second(ErrorSeverity::WARNING, "Second");
+    first.setContext(owner, loop);
+    second.pushContext("In function 'Tree'");
+    second.pushContext("In loop at line 4");
+    assert(first.contextFrame() == second.contextFrame());
+
+    size_t frames = tree.size();
+    for (int i = 0; i < 1000; ++i) {
+        ContextualError repeated(ErrorSeverity::NOTE, "Repeated");
+        repeated.pushContext("In function 'Tree'");
+        repeated.pushContext("In loop at line 4");
+    }
+    assert(tree.size() == frames);
+
+    auto lines = first.getContext();
+    assert(lines.size() == 2);
+    assert(lines[0] == "In function 'Tree'" && lines[1] == "In loop at line 4");
+    assert(first.format() == "error: First\n  In function 'Tree'\n  In loop at line 4");
+
+    // Popping and copying never touch the shared frames
+    ContextualError copy = first;
+    first.popContext();
+    assert(first.contextDepth() == 1 && copy.contextDepth() == 2);
+    first.popContext();
+    first.popContext();
+    assert(first.getContext().empty());
+    assert(copy.format().find("In loop at line 4") != std::string::npos);
+
+    // Concurrent pushes of the same frame agree
+    std::vector<const ContextFrame*> seen(4);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < 4; ++t) {
+        workers.emplace_back([&seen, &tree, t] {
+            for (int i = 0; i < 1000; ++i) {
+                seen[t] = tree.push(nullptr, "In function 'Threaded'");
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    for (const ContextFrame* frame : seen) {
+        assert(frame == seen[0]);
+    }
+
+    // clear() starts a new tree; diagnostics keep the old one alive
+    std::weak_ptr<ContextTree> old = owner;
+    owner.reset();
+    manager.clear();
+    assert(manager.contextTree()->size() == 0);
+    ContextualError fresh(ErrorSeverity::ERROR, "Fresh");
+    fresh.pushContext("In function 'Tree'");
+    assert(fresh.contextFrame() != copy.contextFrame()->parent);
+    assert(!old.expired());
+    assert(copy.format() == "error: First\n  In function 'Tree'\n  In loop at line 4");
+    {
+        ContextualError last = copy;
+        copy = ContextualError(ErrorSeverity::ERROR, "Replaced");
+        first = ContextualError(ErrorSeverity::ERROR, "Replaced");
+        second = ContextualError(ErrorSeverity::ERROR, "Replaced");
+        assert(!old.expired() && last.contextDepth() == 2);
+    }
+    assert(old.expired());
+    manager.clear();
+
+    std::cout << "  ✓ Frames are interned, shared and immutable\n";
+}
+
+void benchmark_shared_context() {
+    std::cout << "\n🔹 Benchmarking context for 10k diagnostics in one function...\n";
+
+    const int diagnostics = 10000;
+    const std::vector<std::string> lines = {"In function 'GeneratedTable'",
+                                            "In initializer of 'entries'",
+                                            "In element 17 of the initializer list"};
+
+    // Old representation: every diagnostic owns a copy of each line
+    size_t allocationsBefore = allocationCount.load();
+    auto start = std::chrono::high_resolution_clock::now();
+    std::vector<std::vector<std::string>> copied;
+    copied.reserve(diagnostics);
+    for (int i = 0; i < diagnostics; ++i) {
+        std::vector<std::string> stack;
+        for (const std::string& line : lines) {
+            stack.push_back(line);
+        }
+        copied.push_back(std::move(stack));
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    double copyUs = std::chrono::duration<double, std::micro>(end - start).count();
+    size_t copyAllocations = allocationCount.load() - allocationsBefore;
+
+    // Frames: the chain is built once, each diagnostic stores one pointer
+    allocationsBefore = allocationCount.load();
+    start = std::chrono::high_resolution_clock::now();
+    std::vector<ContextualError> shared;
+    shared.reserve(diagnostics);
+    std::shared_ptr<ContextTree> tree = ErrorManager::get().contextTree();
+    const ContextFrame* chain = nullptr;
+    for (const std::string& line : lines) {
+        chain = tree->push(chain, line);
+    }
+    for (int i = 0; i < diagnostics; ++i) {
+        shared.emplace_back(ErrorSeverity::ERROR);
+        shared.back().setContext(tree, chain);
+    }
+    end = std::chrono::high_resolution_clock::now();
+    double frameUs = std::chrono::duration<double, std::micro>(end - start).count();
+    size_t frameAllocations = allocationCount.load() - allocationsBefore;
+    assert(shared.back().getContext() == copied.back());
+
+    std::cout << "  vector<string> per diagnostic: " << copyUs << " us, " << copyAllocations
+              << " allocations; shared frames: " << frameUs << " us, " << frameAllocations
+              << " allocations\n";
+}
@@ -0,0 +1,379 @@
+#include "../types/fixed.hpp"
+#include "../types/reduce.hpp"
+#include "test_helpers.hpp"
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace holycpp;
+using namespace holycpp::testing;
+
+// Test function prototypes
+void test_conversion();
+void test_rounding();
+void test_multiplication();
+void test_division();
+void test_overflow_policies();
+void test_rescaling();
+void test_bulk_kernels();
+void benchmark_dsp_loops();
+
+int main() {
+    std::cout << "🧪 Running HolyC++ Fixed-Point Tests\n";
+    std::cout << "====================================\n";
+
+    try {
+        test_conversion();
+        test_rounding();
+        test_multiplication();
+        test_division();
+        test_overflow_policies();
+        test_rescaling();
+        test_bulk_kernels();
+        benchmark_dsp_loops();
+
+        std::cout << "\n✅ All fixed-point tests passed!\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ Test failed: " << e.what() << "\n";
+        return 1;
+    }
+}
+
+// Rounds an exactly representable double as the mode says
+static double roundAs(Rounding mode, double value) {
+    switch (mode) {
+        case Rounding::TRUNCATE:     return std::floor(value);
+        case Rounding::NEAREST:      return std::floor(value + 0.5);
+        case Rounding::NEAREST_EVEN: return std::nearbyint(value);
+    }
+    return value;
+}
+
+void test_conversion() {
+    std::cout << "\n🔹 Testing conversion...\n";
+
+    assert(Q15(0.5).raw() == 16384);
+    assert(Q15(-1.0).raw() == -32768);
+    assert(Q15(0.5f).to_f64() == F64(0.5));
+    assert(Q31(F64(-0.25)).raw() == -(1 << 29));
+    assert(Q16_16(F32(2.5f)).to_f32() == F32(2.5f));
+    assert(Q16_16(-3).raw() == -3 * 65536);
+    assert(Q16_16(7).integer_part() == 7 && Q16_16(-2.5).integer_part() == -3);
+    assert(double(Q16_16(1.25)) == 1.25 && float(Q15(0.75)) == 0.75f);
+
+    // 64-bit storage keeps integers F64 cannot
+    using Q32_32 = Fixed<32, 32>;
+    assert(Q32_32(int64_t(2147483647)).raw() == int64_t(2147483647) << 32);
+    assert(Q32_32::max().raw() == INT64_MAX && Q32_32::lowest().raw() == INT64_MIN);
+    assert(Q32_32::epsilon().to_f64() == F64(std::ldexp(1.0, -32)));
+
+    // Out of range: the unsaturated types throw, as SInt/UInt do
+    assert(throws<std::out_of_range>([] { Fixed<8, 8>(128.0); }));
+    assert(throws<std::out_of_range>([] { Fixed<8, 8>(200); }));
+    assert(throws<std::out_of_range>([] { Fixed<8, 8>(std::nan("")); }));
+    assert(throws<std::out_of_range>([] { Q32_32{INFINITY}; }));
+    assert(throws<std::out_of_range>([] { UFixed<8, 8>(-1.0); }));
+    using Q8_8 = Fixed<8, 8>;
+    assert(Q8_8(127.99609375).raw() == INT16_MAX);
+    assert(Q8_8(-128.0).raw() == INT16_MIN);
+
+    // ...and the saturating ones clamp
+    assert(Q15(1.0) == Q15::max() && Q15(3) == Q15::max() && Q15(-7.5) == Q15::lowest());
+    assert(Q15(std::nan("")).is_zero());
+    using Sat8_8 = SatFixed<8, 8>;
+    assert(Sat8_8(-INFINITY) == Sat8_8::lowest());
+
+    UFixed<8, 8> unsignedValue(200.5);
+    assert(unsignedValue.raw() == 200 * 256 + 128 && !unsignedValue.is_negative());
+    assert(is_fixed_holyc_v<Q15> && !is_fixed_holyc_v<F32> && Q15::FRAC_BITS == 15 && Q16_16::INT_BITS == 16);
+
+    std::cout << "  ✓ Floats, FInt and integers convert in and out; out-of-range values throw or clamp\n";
+}
+
+template<Rounding Mode>
+static void checkRounding() {
+    using Q = Fixed<8, 8, Mode>;
+    // Multiples of 1/4096: the ties, and the values either side. The top
+    // values would round up out of range
+    for (int n = -128 * 4096; n < 127 * 4096; n += 7) {
+        const double value = n / 4096.0;
+        assert(Q(value).raw() == roundAs(Mode, value * 256));
+        assert(Q(float(value)).raw() == roundAs(Mode, value * 256));
+    }
+}
+
+void test_rounding() {
+    std::cout << "\n🔹 Testing rounding modes...\n";
+
+    using Truncating = Fixed<8, 8, Rounding::TRUNCATE>;
+    using Nearest = Fixed<8, 8, Rounding::NEAREST>;
+    using NearestEven = Fixed<8, 8, Rounding::NEAREST_EVEN>;
+    const double half = 1.0 / 512, threeHalves = 3.0 / 512;
+    assert(Truncating(half).raw() == 0);
+    assert(Nearest(half).raw() == 1);
+    assert(NearestEven(half).raw() == 0);
+    assert(NearestEven(threeHalves).raw() == 2);
+    assert(Truncating(-half).raw() == -1);
+    assert(Nearest(-half).raw() == 0);
+    assert(Nearest(-threeHalves).raw() == -1);
+
+    // Just below a half: adding 0.5 in floating point would round up
+    assert(Q16_16(std::nextafter(0.5, 0.0) / 65536).raw() == 0);
+
+    checkRounding<Rounding::TRUNCATE>();
+    checkRounding<Rounding::NEAREST>();
+    checkRounding<Rounding::NEAREST_EVEN>();
+
+    std::cout << "  ✓ TRUNCATE floors, NEAREST rounds halves up, NEAREST_EVEN to even\n";
+}
+
+template<Rounding Mode>
+static void checkProducts(std::mt19937& rng) {
+    using Q = Fixed<8, 8, Mode>;
+    std::uniform_int_distribution<int> raw(INT16_MIN, INT16_MAX);
+    for (int i = 0; i < 200000; ++i) {
+        const Q a = Q::from_bits(static_cast<int16_t>(raw(rng)));
+        const Q b = Q::from_bits(static_cast<int16_t>(raw(rng)));
+        const double exact = roundAs(Mode, double(a.raw()) * b.raw() / 256);   // Exact: under 2^31
+        if (exact >= INT16_MIN && exact <= INT16_MAX) {
+            assert((a * b).raw() == exact);
+        }
+    }
+}
+
+void test_multiplication() {
+    std::cout << "\n🔹 Testing multiplication...\n";
+
+    assert(Q16_16(1.5) * Q16_16(-2.25) == Q16_16(-3.375));
+    assert(Q15(0.5) * Q15(0.5) == Q15(0.25));
+    assert(Q15(-1.0) * Q15(-1.0) == Q15::max());                    // Saturates
+    assert(Q31(-1.0) * Q31(-1.0) == Q31::max());
+    assert(Q15(-1.0) * Q15(0.5) == Q15(-0.5));
+
+    // 64-bit values need the 128-bit product
+    using Q32_32 = Fixed<32, 32>;
+    const Q32_32 big(123456.75), small(0.000244140625);               // 2^-12
+    assert((big * small).to_f64() == F64(123456.75 / 4096));
+    assert((Q32_32(65536) * Q32_32(-32767.5)).to_f64() == F64(-65536.0 * 32767.5));
+    assert((Q32_32::epsilon() * Q32_32(0.5)).raw() == 1);             // Half of 2^-32 rounds up
+    assert((Fixed<32, 32, Rounding::NEAREST_EVEN>::epsilon() * Fixed<32, 32, Rounding::NEAREST_EVEN>(0.5)).raw() == 0);
+
+    UFixed<8, 8> u(3.5), v(2.25);
+    assert((u * v).to_f64() == F64(7.875));
+
+    std::mt19937 rng(48);
+    checkProducts<Rounding::TRUNCATE>(rng);
+    checkProducts<Rounding::NEAREST>(rng);
+    checkProducts<Rounding::NEAREST_EVEN>(rng);
+
+    Q16_16 x(1.5);
+    x *= Q16_16(4);
+    x += Q16_16(0.5);
+    x -= Q16_16(1);
+    assert(x == Q16_16(5.5) && -x == Q16_16(-5.5) && x > Q16_16(5) && x <= Q16_16(5.5));
+
+    std::cout << "  ✓ Products round once from the exact value, in every mode\n";
+}
+
+template<Rounding Mode>
+static void checkQuotients(std::mt19937& rng) {
+    using Q = Fixed<8, 8, Mode>;
+    std::uniform_int_distribution<int> raw(INT16_MIN, INT16_MAX);
+    for (int i = 0; i < 200000; ++i) {
+        const Q a = Q::from_bits(static_cast<int16_t>(raw(rng)));
+        const Q b = Q::from_bits(static_cast<int16_t>(raw(rng) >> (i % 12)));
+        if (b.is_zero()) {
+            continue;
+        }
+        // Numerator below 2^24 and divisor below 2^16: no quotient lands
+        // within a rounding of a tie it is not
+        const double exact = roundAs(Mode, double(a.raw()) * 256 / b.raw());
+        if (exact >= INT16_MIN && exact <= INT16_MAX) {
+            assert((a / b).raw() == exact);
+        }
+    }
+}
+
+void test_division() {
+    std::cout << "\n🔹 Testing division...\n";
+
+    assert(Q16_16(1) / Q16_16(3) == Q16_16::from_bits(21845));
+    assert((Fixed<16, 16, Rounding::TRUNCATE>(-1) / Fixed<16, 16, Rounding::TRUNCATE>(3)).raw() == -21846);
+    assert((Q16_16(-1) / Q16_16(3)).raw() == -21845);
+    assert(Q16_16(7.5) / Q16_16(-2.5) == Q16_16(-3));
+    assert(Q15(0.25) / Q15(0.5) == Q15(0.5));
+
+    using Q32_32 = Fixed<32, 32>;
+    assert((Q32_32(1) / Q32_32(3)).raw() == 1431655765);              // 2^32 / 3 = 1431655765.33
+    assert((Q32_32(-1000000) / Q32_32(0.0009765625)).to_f64() == F64(-1024000000.0));
+
+    std::mt19937 rng(480);
+    checkQuotients<Rounding::TRUNCATE>(rng);
+    checkQuotients<Rounding::NEAREST>(rng);
+    checkQuotients<Rounding::NEAREST_EVEN>(rng);
+
+    // Division by zero is the policy's: Basic throws, Saturating clamps
+    assert(throws<std::domain_error>([] { Q16_16(1) / Q16_16(0); }));
+    assert(Q15(0.5) / Q15(0.0) == Q15::max());
+    assert(Q15(-0.5) / Q15(0.0) == Q15::lowest());
+    assert((Q15(0.0) / Q15(0.0)).is_zero());
+
+    std::cout << "  ✓ Quotients round once from the exact value; division by zero follows the policy\n";
+}
+
+void test_overflow_policies() {
+    std::cout << "\n🔹 Testing overflow policies...\n";
+
+    using Wrapping = Fixed<8, 8, Rounding::NEAREST, checking::Basic>;
+    using Trapping = Fixed<8, 8, Rounding::NEAREST, checking::Trapping>;
+    using Saturating = SatFixed<8, 8>;
+
+    // 100 * 2 = 200 is out of range: 25600 * 512 / 256 = 51200 wraps to -14336
+    assert((Wrapping(100) * Wrapping(2)).raw() == -14336);
+    assert(throws<std::overflow_error>([] { Trapping(100) * Trapping(2); }));
+    assert(Saturating(100) * Saturating(2) == Saturating::max());
+    assert(Saturating(100) * Saturating(-2) == Saturating::lowest());
+
+    assert(throws<std::overflow_error>([] { Trapping(100) + Trapping(100); }));
+    assert(Saturating(100) + Saturating(100) == Saturating::max());
+    assert(Saturating(-100) - Saturating(100) == Saturating::lowest());
+    assert((Wrapping(100) + Wrapping(100)).raw() == static_cast<int16_t>(51200));
+
+    assert(throws<std::overflow_error>([] { Trapping(100) / Trapping(0.25); }));
+    assert(Saturating(-100) / Saturating(0.25) == Saturating::lowest());
+    assert(-Saturating::lowest() == Saturating::max());
+
+    // Unsigned saturation stops at zero
+    using USat = UFixed<8, 8, Rounding::NEAREST, checking::Saturating>;
+    assert((USat(1) - USat(2)).is_zero());
+    assert(USat(200) * USat(2) == USat::max());
+
+    std::cout << "  ✓ Wide results wrap, throw or clamp through the integer's policy\n";
+}
+
+void test_rescaling() {
+    std::cout << "\n🔹 Testing conversion between formats...\n";
+
+    const Q31 widened = Q15(0.5);
+    assert(widened.raw() == (1 << 30));
+    assert(Q15(Q31::from_bits(0x40008000)).raw() == 0x4001);          // Halfway rounds up
+    assert(Q15(Q31::from_bits(0x40007FFF)).raw() == 0x4000);
+    assert((Fixed<1, 15, Rounding::NEAREST_EVEN>(Q31::from_bits(0x40008000))).raw() == 0x4000);
+    assert((Fixed<1, 15, Rounding::TRUNCATE>(Q31::from_bits(-1))).raw() == -1);
+
+    assert(Q16_16(Q15(-0.75)) == Q16_16(-0.75));
+    assert(Q15(Q16_16(3)) == Q15::max());                             // Q15 saturates
+    assert(throws<std::out_of_range>([] { Fixed<1, 15>(Q16_16(3)); }));
+    assert(throws<std::out_of_range>([] { UFixed<8, 8>(Q16_16(-1)); }));
+
+    // The exact accumulator converts back with one rounding
+    const Q15Accumulator accumulated = Q15Accumulator(Q15(0.5).to_f64()) + Q15Accumulator(0.25);
+    assert(Q15(accumulated) == Q15(0.75));
+
+    std::cout << "  ✓ Formats convert into each other with one rounding\n";
+}
+
+static std::vector<Q15> randomQ15(size_t count, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> raw(INT16_MIN, INT16_MAX);
+    std::vector<Q15> values;
+    values.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        values.push_back(Q15::from_bits(static_cast<int16_t>(raw(rng))));
+    }
+    return values;
+}
+
+void test_bulk_kernels() {
+    std::cout << "\n🔹 Testing bulk kernels...\n";
+
+    std::vector<Q15> a = randomQ15(10000, 1);
+    std::vector<Q15> b = randomQ15(10000, 2);
+    // The one overflowing product, in and around the vector steps
+    for (size_t i : {0, 5, 16, 17, 31, 9999}) {
+        a[i] = Q15::lowest();
+        b[i] = Q15::lowest();
+    }
+
+    for (size_t count : {size_t(0), size_t(1), size_t(15), size_t(16), size_t(33), a.size()}) {
+        std::vector<Q15> out(count);
+        multiplyArray(a.data(), b.data(), out.data(), count);
+        int64_t exact = 0;
+        for (size_t i = 0; i < count; ++i) {
+            assert(out[i] == a[i] * b[i]);
+            exact += int64_t(a[i].raw()) * b[i].raw();
+        }
+        assert(dot(a.data(), b.data(), count).raw() == exact);
+    }
+
+    // Every pair is -1 * -1: the largest sum the accumulator sees
+    const std::vector<Q15> lows(4096, Q15::lowest());
+    assert(dot(lows.data(), lows.data(), lows.size()).raw() == int64_t(4096) << 30);
+    assert(dot(lows.data(), lows.data(), lows.size()).to_f64() == F64(4096.0));
+
+    std::cout << "  ✓ multiplyArray and dot match the scalar operators, including saturation\n";
+}
+
+void benchmark_dsp_loops() {
+    std::cout << "\n🔹 Benchmarking DSP loops (in cache)...\n";
+
+    const size_t count = 1 << 14;
+    const int rounds = 2000;
+    const std::vector<Q15> a = randomQ15(count, 3);
+    const std::vector<Q15> b = randomQ15(count, 4);
+    std::vector<F32> af, bf;
+    std::vector<F64> ad, bd;
+    for (size_t i = 0; i < count; ++i) {
+        af.push_back(a[i].to_f32());
+        bf.push_back(b[i].to_f32());
+        ad.push_back(a[i].to_f64());
+        bd.push_back(b[i].to_f64());
+    }
+
+    // Gain stage: out[i] = a[i] * b[i]
+    std::vector<Q15> outQ(count);
+    std::vector<F32> outF(count);
+    std::vector<F64> outD(count);
+    const double kernelMul = nanosPerValue(count, rounds, [&] { multiplyArray(a.data(), b.data(), outQ.data(), count); });
+    const double scalarMul = nanosPerValue(count, rounds / 10, [&] {
+        for (size_t i = 0; i < count; ++i) {
+            outQ[i] = a[i] * b[i];
+        }
+    });
+    const double floatMul = nanosPerValue(count, rounds, [&] {
+        for (size_t i = 0; i < count; ++i) {
+            outF[i] = af[i] * bf[i];
+        }
+    });
+    const double doubleMul = nanosPerValue(count, rounds, [&] {
+        for (size_t i = 0; i < count; ++i) {
+            outD[i] = ad[i] * bd[i];
+        }
+    });
+    std::cout << "  multiply: Q15 multiplyArray " << kernelMul << " ns/value, Q15 operator* " << scalarMul
+              << ", F32 " << floatMul << ", F64 " << doubleMul << "\n";
+
+    // FIR tap sum: dot over the window
+    double sink = 0;
+    const double kernelDot = nanosPerValue(count, rounds, [&] { sink += dot(a.data(), b.data(), count).to_f64().raw(); });
+    const double floatDot = nanosPerValue(count, rounds, [&] {
+        sink += dot(af.data(), bf.data(), count, Summation::NAIVE).raw();
+    });
+    const double doubleDot = nanosPerValue(count, rounds, [&] {
+        sink += dot(ad.data(), bd.data(), count, Summation::NAIVE).raw();
+    });
+    const double serialDot = nanosPerValue(count, rounds / 10, [&] {
+        F64 total(0.0);
+        for (size_t i = 0; i < count; ++i) {
+            total += ad[i] * bd[i];
+        }
+        sink += total.raw();
+    });
+    assert(std::isfinite(sink));
+    std::cout << "  dot: Q15 " << kernelDot << " ns/value, F32 (reduce, NAIVE) " << floatDot << ", F64 (reduce, NAIVE) "
+              << doubleDot << ", F64 serial " << serialDot << "\n";
+}
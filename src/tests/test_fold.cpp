@@ -0,0 +1,433 @@
+#include "../compiler/const_fold.hpp"
+#include "../runtime/bytecode.hpp"
+#include "../runtime/tiered.hpp"
+#include "../lib/error.hpp"
+#include "../lib/error_types.hpp"
+#include <iostream>
+#include <cassert>
+#include <cstring>
+
+using namespace holycpp;
+
+// Test function prototypes
+void test_typed_folding();
+void test_fold_diagnostics();
+void test_const_conversions();
+void test_bytecode_folding();
+void test_branch_resolution();
+void test_bytecode_fold_diagnostics();
+void test_min_modulo_agreement();
+void benchmark_fold_corpus();
+
+int main() {
+    std::cout << "🧪 Running HolyC++ Constant Folding Tests\n";
+    std::cout << "==========================================\n";
+
+    try {
+        test_typed_folding();
+        test_fold_diagnostics();
+        test_const_conversions();
+        test_bytecode_folding();
+        test_branch_resolution();
+        test_bytecode_fold_diagnostics();
+        test_min_modulo_agreement();
+        benchmark_fold_corpus();
+
+        std::cout << "\n✅ All constant folding tests passed!\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ Test failed: " << e.what() << "\n";
+        return 1;
+    }
+}
+
+void test_typed_folding() {
+    std::cout << "\n🔹 Testing folding with HolyC type semantics...\n";
+
+    ConstantFolder folder;
+    ConstValue result;
+
+    // Unsigned wrap-around matches UInt::operator+
+    assert(folder.fold(ConstOp::ADD, ConstValue::of(U8(200)), ConstValue::of(U8(100)), result));
+    assert(result == ConstValue::of(U8(200) + U8(100)));
+    assert(result.as<U8>() == 44);
+
+    assert(folder.fold(ConstOp::SUB, ConstValue::of(U32(0u)), ConstValue::of(U32(1u)), result));
+    assert(result.as<U32>() == U32::MAX);
+
+    // Signed wrap-around, including I64 where the raw + would be UB
+    assert(folder.fold(ConstOp::ADD, ConstValue::of(I8(int8_t(127))), ConstValue::of(I8(int8_t(1))), result));
+    assert(result.as<I8>() == -128);
+    assert(folder.fold(ConstOp::ADD, ConstValue::of(I64(INT64_MAX)), ConstValue::of(I64(int64_t(1))), result));
+    assert(result.as<I64>() == INT64_MIN);
+    assert(folder.fold(ConstOp::MUL, ConstValue::of(I32(int32_t(65536))), ConstValue::of(I32(int32_t(65536))), result));
+    assert(result.as<I32>() == 0);
+
+    // Shifts, division and bitwise operators
+    assert(folder.fold(ConstOp::SHL, ConstValue::of(U16(uint16_t(1))), ConstValue::of(U16(uint16_t(15))), result));
+    assert(result.as<U16>() == 0x8000);
+    assert(folder.fold(ConstOp::SHR, ConstValue::of(I32(int32_t(-16))), ConstValue::of(I32(int32_t(2))), result));
+    assert(result.as<I32>() == (I32(int32_t(-16)) >> I32(int32_t(2))));
+    assert(folder.fold(ConstOp::DIV, ConstValue::of(I16(int16_t(-7))), ConstValue::of(I16(int16_t(2))), result));
+    assert(result.as<I16>() == -3);
+    assert(folder.fold(ConstOp::XOR, ConstValue::of(U64(0xFF00ULL)), ConstValue::of(U64(0x0FF0ULL)), result));
+    assert(result.as<U64>() == 0xF0F0ULL);
+
+    // Floating point keeps exact IEEE results
+    assert(folder.fold(ConstOp::DIV, ConstValue::of(F64(1.0)), ConstValue::of(F64(3.0)), result));
+    const double third = (F64(1.0) / F64(3.0)).raw();
+    assert(std::memcmp(&result.bits, &third, sizeof(double)) == 0);
+    assert(folder.fold(ConstOp::MUL, ConstValue::of(F32(0.1f)), ConstValue::of(F32(3.0f)), result));
+    assert(result.as<F32>() == F32(0.1f) * F32(3.0f));
+
+    assert(folder.diagnostics.empty());
+    assert(ConstValue::of(I8(int8_t(-5))).toString() == "I8 -5");
+
+    std::cout << "  ✓ Folded values match the runtime operators bit for bit\n";
+}
+
+void test_fold_diagnostics() {
+    std::cout << "\n🔹 Testing compile-time diagnostics...\n";
+
+    ConstantFolder folder;
+    ConstValue result;
+    SourceLocation loc("const.hc", 3, 14);
+
+    // Division and modulo by zero -> T012
+    assert(!folder.fold(ConstOp::DIV, ConstValue::of(U32(7u)), ConstValue::of(U32(0u)), result, loc));
+    assert(!folder.fold(ConstOp::MOD, ConstValue::of(I64(int64_t(7))), ConstValue::of(I64(int64_t(0))), result, loc));
+    assert(!folder.fold(ConstOp::DIV, ConstValue::of(F64(1.0)), ConstValue::of(F64(0.0)), result, loc));
+    assert(folder.diagnostics.size() == 3);
+    for (const auto& diag : folder.diagnostics) {
+        assert(diag->getErrorCode() == "T012");
+        assert(diag->getLocation().line == 3);
+    }
+
+    // Shift out of range and MIN / -1 -> S008
+    assert(!folder.fold(ConstOp::SHL, ConstValue::of(U8(uint8_t(1))), ConstValue::of(U8(uint8_t(8))), result, loc));
+    assert(!folder.fold(ConstOp::SHR, ConstValue::of(I32(int32_t(1))), ConstValue::of(I32(int32_t(-1))), result, loc));
+    assert(!folder.fold(ConstOp::DIV, ConstValue::of(I32(INT32_MIN)), ConstValue::of(I32(int32_t(-1))), result, loc));
+    assert(folder.diagnostics.size() == 6);
+    for (size_t i = 3; i < 6; ++i) {
+        assert(folder.diagnostics[i]->getErrorCode() == "S008");
+    }
+
+    // Operand type errors -> T005
+    assert(!folder.fold(ConstOp::AND, ConstValue::of(F64(1.0)), ConstValue::of(F64(2.0)), result, loc));
+    assert(!folder.fold(ConstOp::ADD, ConstValue::of(U8(uint8_t(1))), ConstValue::of(I8(int8_t(1))), result, loc));
+    assert(folder.diagnostics[6]->getErrorCode() == "T005");
+    assert(folder.diagnostics[7]->getMessage().find("U8 vs I8") != std::string::npos);
+
+    // Flushing hands everything to the ErrorManager in order
+    ErrorManager::get().clear();
+    folder.flush();
+    assert(folder.diagnostics.empty());
+    assert(ErrorManager::get().getErrorCount() == 8);
+    assert(ErrorManager::get().getErrors().front()->getErrorCode() == "T012");
+    ErrorManager::get().clear();
+
+    std::cout << "  ✓ Runtime errors become compile-time diagnostics\n";
+}
+
+void test_const_conversions() {
+    std::cout << "\n🔹 Testing constant conversions...\n";
+
+    ConstantFolder folder;
+    ConstValue result;
+
+    assert(folder.convert(ConstValue::of(U16(uint16_t(200))), ConstType::U8, result));
+    assert(result.as<U8>() == 200);
+    assert(folder.convert(ConstValue::of(I8(int8_t(-1))), ConstType::I64, result));
+    assert(result.as<I64>() == -1);
+    assert(folder.convert(ConstValue::of(F64(3.9)), ConstType::I32, result));
+    assert(result.as<I32>() == 3);
+    assert(folder.convert(ConstValue::of(U32(7u)), ConstType::F64, result));
+    assert(result.as<F64>() == 7.0);
+    assert(folder.diagnostics.empty());
+
+    // Same bounds checks as the converting constructors -> T004
+    assert(!folder.convert(ConstValue::of(U16(uint16_t(300))), ConstType::U8, result));
+    assert(!folder.convert(ConstValue::of(I32(int32_t(-1))), ConstType::U32, result));
+    assert(!folder.convert(ConstValue::of(U64(UINT64_MAX)), ConstType::I64, result));
+    assert(!folder.convert(ConstValue::of(F64(1e20)), ConstType::I32, result));
+    assert(folder.diagnostics.size() == 4);
+    for (const auto& diag : folder.diagnostics) {
+        assert(diag->getErrorCode() == "T004");
+    }
+    assert(folder.diagnostics[0]->getMessage().find("U16 vs U8") != std::string::npos);
+
+    std::cout << "  ✓ Conversions apply runtime bounds checks at compile time\n";
+}
+
+// I64 Const() { I64 a = 6; I64 b = 7; I64 c = a * b; I64 d = c - 2; return d / 4 + a; }
+Function makeArithmetic() {
+    Function fn;
+    fn.name = "Const";
+    fn.numRegs = 6;
+    int six = fn.addConstant(Reg::ofInt(6));
+    int seven = fn.addConstant(Reg::ofInt(7));
+    int two = fn.addConstant(Reg::ofInt(2));
+    int four = fn.addConstant(Reg::ofInt(4));
+    fn.emit(OpCode::LOAD_CONST, 0, 0, 0, six)
+      .emit(OpCode::LOAD_CONST, 1, 0, 0, seven)
+      .emit(OpCode::MUL_I64, 2, 0, 1)
+      .emit(OpCode::LOAD_CONST, 3, 0, 0, two)
+      .emit(OpCode::SUB_I64, 2, 2, 3)
+      .emit(OpCode::LOAD_CONST, 4, 0, 0, four)
+      .emit(OpCode::DIV_I64, 2, 2, 4)
+      .emit(OpCode::ADD_I64, 5, 2, 0)
+      .emit(OpCode::RETURN, 0, 5);
+    return fn;
+}
+
+// I64 Scale(I64 x) { I64 k = 3 << 2; return x * k + (k - 12); }
+Function makeScale() {
+    Function fn;
+    fn.name = "Scale";
+    fn.numParams = 1;
+    fn.numRegs = 5;
+    int three = fn.addConstant(Reg::ofInt(3));
+    int two = fn.addConstant(Reg::ofInt(2));
+    int twelve = fn.addConstant(Reg::ofInt(12));
+    fn.emit(OpCode::LOAD_CONST, 1, 0, 0, three)
+      .emit(OpCode::LOAD_CONST, 2, 0, 0, two)
+      .emit(OpCode::SHL_I64, 1, 1, 2)
+      .emit(OpCode::MUL_I64, 3, 0, 1)
+      .emit(OpCode::LOAD_CONST, 2, 0, 0, twelve)
+      .emit(OpCode::SUB_I64, 4, 1, 2)
+      .emit(OpCode::ADD_I64, 3, 3, 4)
+      .emit(OpCode::RETURN, 0, 3);
+    return fn;
+}
+
+void test_bytecode_folding() {
+    std::cout << "\n🔹 Testing bytecode constant folding...\n";
+
+    std::vector<std::unique_ptr<CompilerError>> diags;
+
+    Function arith = makeArithmetic();
+    const int64_t expected = Interpreter::run(arith, nullptr, 0).i;
+    FoldStats stats = foldConstants(arith, diags);
+    assert(diags.empty());
+    assert(stats.instructionsBefore == 9);
+    assert(arith.code.size() == 2);   // LOAD_CONST + RETURN
+    assert(arith.code[0].op == OpCode::LOAD_CONST);
+    assert(arith.constants.size() == 1);
+    assert(Interpreter::run(arith, nullptr, 0).i == expected);
+    assert(expected == 16);
+
+    Function scale = makeScale();
+    Function original = scale;
+    stats = foldConstants(scale, diags);
+    assert(diags.empty());
+    assert(stats.foldedOps >= 2);
+    assert(scale.code.size() < original.code.size());
+    for (int64_t x : {0, 1, -5, 1000000}) {
+        Reg arg = Reg::ofInt(x);
+        assert(Interpreter::run(scale, &arg, 1).i == Interpreter::run(original, &arg, 1).i);
+    }
+
+    std::cout << "  ✓ Constants are propagated and folded\n";
+}
+
+void test_branch_resolution() {
+    std::cout << "\n🔹 Testing branch resolution and dead code...\n";
+
+    // I64 Pick(I64 x) { if (2 < 1) return x * 100; return x + 1; }
+    Function fn;
+    fn.name = "Pick";
+    fn.numParams = 1;
+    fn.numRegs = 5;
+    int two = fn.addConstant(Reg::ofInt(2));
+    int one = fn.addConstant(Reg::ofInt(1));
+    int hundred = fn.addConstant(Reg::ofInt(100));
+    fn.emit(OpCode::LOAD_CONST, 1, 0, 0, two)       // 0
+      .emit(OpCode::LOAD_CONST, 2, 0, 0, one)       // 1
+      .emit(OpCode::LT_I64, 3, 1, 2)                // 2
+      .emit(OpCode::JUMP_IF_NOT, 0, 3, 0, 7)        // 3
+      .emit(OpCode::LOAD_CONST, 4, 0, 0, hundred)   // 4
+      .emit(OpCode::MUL_I64, 4, 0, 4)               // 5
+      .emit(OpCode::RETURN, 0, 4)                   // 6
+      .emit(OpCode::LOAD_CONST, 4, 0, 0, one)       // 7
+      .emit(OpCode::ADD_I64, 4, 0, 4)               // 8
+      .emit(OpCode::RETURN, 0, 4);                  // 9
+    Function original = fn;
+
+    std::vector<std::unique_ptr<CompilerError>> diags;
+    FoldStats stats = foldConstants(fn, diags);
+    assert(stats.resolvedBranches == 1);
+    assert(stats.removedDead > 0);
+    assert(fn.code.size() == 3);   // LOAD_CONST, ADD_I64, RETURN
+    for (const auto& ins : fn.code) {
+        assert(!isBranch(ins.op));
+    }
+    for (int64_t x : {-3, 0, 41}) {
+        Reg arg = Reg::ofInt(x);
+        assert(Interpreter::run(fn, &arg, 1).i == Interpreter::run(original, &arg, 1).i);
+    }
+
+    // Loops keep their structure: values are not carried across back-edges
+    Function loop;
+    loop.name = "Count";
+    loop.numParams = 1;
+    loop.numRegs = 4;
+    int k = loop.addConstant(Reg::ofInt(1));
+    loop.emit(OpCode::LOAD_CONST, 2, 0, 0, k)       // 0: one = 1
+        .emit(OpCode::LT_I64, 3, 1, 0)              // 1: c = i < n
+        .emit(OpCode::JUMP_IF_NOT, 0, 3, 0, 4)      // 2
+        .emit(OpCode::ADD_I64, 1, 1, 2)             // 3: i++
+        .emit(OpCode::JUMP, 0, 0, 0, 1)             // 4 is retargeted below
+        .emit(OpCode::RETURN, 0, 1);
+    loop.code[2].imm = 5;
+    Function loopOriginal = loop;
+    foldConstants(loop, diags);
+    Reg n = Reg::ofInt(25);
+    assert(Interpreter::run(loop, &n, 1).i == Interpreter::run(loopOriginal, &n, 1).i);
+    assert(diags.empty());
+
+    std::cout << "  ✓ Known branches are resolved and dead code removed\n";
+}
+
+void test_bytecode_fold_diagnostics() {
+    std::cout << "\n🔹 Testing diagnostics from the folding pass...\n";
+
+    // I64 Bad() { I64 z = 0; return 10 / z; }
+    Function fn;
+    fn.name = "Bad";
+    fn.numRegs = 3;
+    fn.location = SourceLocation("bad.hc", 12, 3);
+    int ten = fn.addConstant(Reg::ofInt(10));
+    fn.emit(OpCode::LOAD_CONST, 0, 0, 0, ten)
+      .emit(OpCode::DIV_I64, 2, 0, 1)               // r1 is zero-initialized
+      .emit(OpCode::RETURN, 0, 2);
+
+    // A clean function builds no context frames
+    std::vector<std::unique_ptr<CompilerError>> diags;
+    ErrorManager::get().clear();
+    Function clean = makeArithmetic();
+    foldConstants(clean, diags);
+    assert(diags.empty() && ErrorManager::get().contextTree()->size() == 0);
+
+    foldConstants(fn, diags);
+    assert(diags.size() == 1);
+    assert(diags[0]->getErrorCode() == "T012");
+    assert(diags[0]->getLocation().filename == "bad.hc");
+    std::string formatted = diags[0]->format();
+    assert(formatted.find("In function 'Bad'") != std::string::npos);
+    assert(formatted.find("pc 1") != std::string::npos);
+
+    // The division stays, so runtime still raises the same error
+    assert(fn.code.size() == 3);
+    bool threw = false;
+    try {
+        Interpreter::run(fn, nullptr, 0);
+    } catch (const std::domain_error&) {
+        threw = true;
+    }
+    assert(threw);
+
+    std::cout << "  ✓ Faulting operations are diagnosed and preserved\n";
+}
+
+void test_min_modulo_agreement() {
+    std::cout << "\n🔹 Testing MIN % -1 across every tier...\n";
+
+    // The runtime type defines it as 0 (no hardware trap)
+    const int64_t expected = (I64(I64::MIN) % I64(int64_t(-1))).raw();
+    assert(expected == 0);
+
+    // Typed folder
+    ConstantFolder folder;
+    ConstValue result;
+    assert(folder.fold(ConstOp::MOD, ConstValue::of(I64(I64::MIN)), ConstValue::of(I64(int64_t(-1))), result));
+    assert(result.as<I64>() == expected);
+    assert(folder.fold(ConstOp::MOD, ConstValue::of(I32(INT32_MIN)), ConstValue::of(I32(int32_t(-1))), result));
+    assert(result.as<I32>() == (I32(INT32_MIN) % I32(int32_t(-1))).raw());
+    assert(folder.diagnostics.empty());
+
+    // I64 Mod(I64 a) { return a % -1; } run by the interpreter and the threaded tier
+    Function fn;
+    fn.name = "Mod";
+    fn.numParams = 1;
+    fn.numRegs = 2;
+    int minusOne = fn.addConstant(Reg::ofInt(-1));
+    fn.emit(OpCode::LOAD_CONST, 1, 0, 0, minusOne)
+      .emit(OpCode::MOD_I64, 1, 0, 1)
+      .emit(OpCode::RETURN, 0, 1);
+
+    Reg arg = Reg::ofInt(I64::MIN);
+    assert(Interpreter::run(fn, &arg, 1).i == expected);
+
+    ThreadedBackend backend;
+    CompileResult compiled = backend.compile(fn);
+    assert(compiled.code);
+    assert(compiled.code->run(&arg, 1).i == expected);
+
+    // Bytecode folder: MIN % -1 with both operands constant
+    Function constant;
+    constant.name = "ModConst";
+    constant.numRegs = 2;
+    int minValue = constant.addConstant(Reg::ofInt(I64::MIN));
+    int negOne = constant.addConstant(Reg::ofInt(-1));
+    constant.emit(OpCode::LOAD_CONST, 0, 0, 0, minValue)
+            .emit(OpCode::LOAD_CONST, 1, 0, 0, negOne)
+            .emit(OpCode::MOD_I64, 0, 0, 1)
+            .emit(OpCode::RETURN, 0, 0);
+
+    std::vector<std::unique_ptr<CompilerError>> diags;
+    foldConstants(constant, diags);
+    assert(diags.empty());
+    assert(Interpreter::run(constant, nullptr, 0).i == expected);
+
+    std::cout << "  ✓ Runtime type, interpreter, threaded code and folder agree\n";
+}
+
+void benchmark_fold_corpus() {
+    std::cout << "\n🔹 Measuring instruction-count reduction on a corpus...\n";
+
+    // Generated functions in the shape front ends emit: constant
+    // subexpressions, configuration flags and a live parameter path.
+    std::vector<Function> corpus{makeArithmetic(), makeScale()};
+    for (int seed = 1; seed <= 50; ++seed) {
+        Function fn;
+        fn.name = "Gen" + std::to_string(seed);
+        fn.numParams = 1;
+        fn.numRegs = 8;
+        int a = fn.addConstant(Reg::ofInt(seed));
+        int b = fn.addConstant(Reg::ofInt(seed * 3 + 1));
+        int flag = fn.addConstant(Reg::ofInt(seed % 2));
+        fn.emit(OpCode::LOAD_CONST, 1, 0, 0, a)
+          .emit(OpCode::LOAD_CONST, 2, 0, 0, b)
+          .emit(OpCode::MUL_I64, 3, 1, 2)
+          .emit(OpCode::ADD_I64, 3, 3, 1)
+          .emit(OpCode::XOR_I64, 4, 3, 2)
+          .emit(OpCode::LOAD_CONST, 5, 0, 0, flag)
+          .emit(OpCode::JUMP_IF, 0, 5, 0, 10)
+          .emit(OpCode::MUL_I64, 6, 0, 4)
+          .emit(OpCode::ADD_I64, 6, 6, 3)
+          .emit(OpCode::RETURN, 0, 6)
+          .emit(OpCode::SUB_I64, 6, 0, 4)
+          .emit(OpCode::I64_TO_F64, 7, 6)
+          .emit(OpCode::F64_TO_I64, 6, 7)
+          .emit(OpCode::RETURN, 0, 6);
+        corpus.push_back(fn);
+    }
+
+    size_t before = 0, after = 0;
+    std::vector<std::unique_ptr<CompilerError>> diags;
+    for (Function& fn : corpus) {
+        Function original = fn;
+        FoldStats stats = foldConstants(fn, diags);
+        before += stats.instructionsBefore;
+        after += stats.instructionsAfter;
+        Reg arg = Reg::ofInt(17);
+        if (fn.numParams == 1) {
+            assert(Interpreter::run(fn, &arg, 1).i == Interpreter::run(original, &arg, 1).i);
+        }
+    }
+    assert(diags.empty());
+    assert(after < before);
+
+    std::cout << "  Corpus: " << corpus.size() << " functions, " << before << " -> " << after
+              << " instructions (" << (100.0 * (before - after) / before) << "% removed)\n";
+}
@@ -0,0 +1,280 @@
+#include "../runtime/gc.hpp"
+#include "../runtime/value_pool.hpp"
+#include "../types/union_type.hpp"
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <vector>
+
+using namespace holycpp;
+
+// Test function prototypes
+void test_reachability();
+void test_cycles_and_foreign_pointers();
+void test_incremental_barrier();
+void test_allocation_during_sweep();
+void test_automatic_collection();
+void benchmark_pause_and_throughput();
+
+int main() {
+    std::cout << "🧪 Running HolyC++ Garbage Collector Tests\n";
+    std::cout << "==========================================\n";
+
+    try {
+        test_reachability();
+        test_cycles_and_foreign_pointers();
+        test_incremental_barrier();
+        test_allocation_during_sweep();
+        test_automatic_collection();
+        benchmark_pause_and_throughput();
+
+        std::cout << "\n✅ All garbage collector tests passed!\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ Test failed: " << e.what() << "\n";
+        return 1;
+    }
+}
+
+// A list of `length` Values ending in an I32 payload
+static Value* buildList(GcHeap& heap, int length, int payload) {
+    GcRoot head(heap, heap.make(I32(payload)));
+    for (int i = 1; i < length; ++i) {
+        head = heap.make(head.get());
+    }
+    return head;
+}
+
+static int listLength(const Value* head) {
+    int length = 1;
+    while (head->is_value_ptr()) {
+        head = head->val;
+        ++length;
+    }
+    return length;
+}
+
+static GcHeap::Config manualConfig(size_t stepBudget = 2048) {
+    GcHeap::Config config;
+    config.initialTrigger = static_cast<size_t>(-1);   // Collect only when asked
+    config.stepBudget = stepBudget;
+    return config;
+}
+
+void test_reachability() {
+    std::cout << "\n🔹 Testing reachability from roots...\n";
+
+    GcHeap heap(manualConfig());
+    GcRoot kept(heap, buildList(heap, 100, 7));
+    buildList(heap, 50, 8);   // Garbage
+    assert(heap.liveObjects() == 150);
+
+    heap.collect();
+    assert(heap.liveObjects() == 100);
+    assert(heap.stats().freed == 50);
+    assert(listLength(kept) == 100);
+
+    {
+        GcRoot scoped(heap, buildList(heap, 30, 9));
+        heap.collect();
+        assert(heap.liveObjects() == 130);
+    }
+    heap.collect();
+    assert(heap.liveObjects() == 100);
+
+    kept = nullptr;
+    heap.collect();
+    assert(heap.liveObjects() == 0);
+
+    // Freed slots are reused before new segments
+    const size_t reserved = heap.reservedBytes();
+    buildList(heap, 150, 1);
+    assert(heap.reservedBytes() == reserved);
+
+    std::cout << "  ✓ Rooted lists survive, unrooted ones are freed\n";
+}
+
+void test_cycles_and_foreign_pointers() {
+    std::cout << "\n🔹 Testing cycles and pointers outside the heap...\n";
+
+    GcHeap heap(manualConfig());
+    Value* a = heap.make(F64(1.0));
+    Value* b = heap.make(a);
+    heap.setValuePtr(a, b);   // a <-> b, unreachable
+    heap.collect();
+    assert(heap.liveObjects() == 0);
+
+    // Values elsewhere are neither traced nor freed
+    Value outside(I32(5));
+    Value* foreign = MAllocValue();
+    *foreign = Value(&outside);
+    GcRoot root(heap, heap.make(foreign));
+    GcRoot direct(heap, &outside);
+    assert(!heap.owns(foreign) && heap.owns(root));
+    heap.collect();
+    assert(heap.liveObjects() == 1);
+    assert(root->as_value_ptr()->as_value_ptr()->i == 5);
+    Free(foreign);
+
+    std::cout << "  ✓ Cycles are collected; foreign Values are ignored\n";
+}
+
+void test_incremental_barrier() {
+    std::cout << "\n🔹 Testing incremental marking and the write barrier...\n";
+
+    GcHeap heap(manualConfig(1));   // One object per step
+    Value* hidden = heap.make(I32(2));
+    GcRoot holder(heap, heap.make(hidden));   // holder -> hidden
+    GcRoot black(heap, heap.make(I32(1)));
+    buildList(heap, 10, 3);                   // Garbage
+
+    // Both roots are shaded; the last one pushed is scanned first
+    assert(heap.step());
+
+    // Hide `hidden` under the scanned object and cut its only other edge.
+    // Without the barrier the sweep would free it.
+    heap.setValuePtr(black, hidden);
+    holder->set_int(I32(0));
+
+    GcRoot fresh(heap, heap.make(U8('x')));   // Allocated during marking
+    heap.make(F64(0.5));                      // Garbage, but allocated black
+
+    size_t steps = 1;
+    while (heap.step()) {
+        ++steps;
+    }
+    assert(steps > 20);   // Bounded increments, not one pass
+
+    assert(heap.liveObjects() == 5);
+    assert(black->as_value_ptr() == hidden && hidden->i == 2);
+    assert(fresh->as_char() == 'x');
+
+    // The floating garbage goes in the next cycle
+    heap.collect();
+    assert(heap.liveObjects() == 4);
+
+    std::cout << "  ✓ Stores during marking keep their targets alive (" << steps << " steps)\n";
+}
+
+void test_allocation_during_sweep() {
+    std::cout << "\n🔹 Testing allocation during sweeping...\n";
+
+    GcHeap heap(manualConfig(64));
+    for (int i = 0; i < 100; ++i) {
+        buildList(heap, 100, i);   // Garbage across three segments
+    }
+    GcRoot kept(heap, buildList(heap, 10, 1));
+
+    // Mark everything, then stop partway through the sweep
+    while (heap.step() && heap.stats().freed == 0) {}
+    assert(heap.isCollecting());
+
+    GcRoot late(heap, buildList(heap, 500, 2));
+    while (heap.step()) {}
+    assert(heap.liveObjects() == 510);
+    assert(listLength(kept) == 10 && listLength(late) == 500);
+
+    std::cout << "  ✓ Objects allocated mid-sweep survive it\n";
+}
+
+void test_automatic_collection() {
+    std::cout << "\n🔹 Testing automatic collection...\n";
+
+    GcHeap::Config config;
+    config.initialTrigger = 4096;
+    config.stepBudget = 512;
+    config.stepEvery = 64;
+    GcHeap heap(config);
+
+    GcRoot kept(heap, buildList(heap, 1000, 1));
+    for (int i = 0; i < 1000; ++i) {
+        buildList(heap, 200, i);   // 200K short-lived Values
+    }
+    heap.collect();
+    assert(heap.liveObjects() == 1000);
+    assert(listLength(kept) == 1000);
+    assert(heap.stats().cycles > 10);
+    // The heap stays near live * growth instead of holding all 201K Values
+    assert(heap.reservedBytes() < 16 * GcHeap::SEGMENT_BYTES);
+
+    std::cout << "  ✓ " << heap.stats().cycles << " cycles, " << heap.reservedBytes() / 1024
+              << " KiB reserved for 201K allocations\n";
+}
+
+// A script keeping its last `window` lists of `length` Values alive
+struct WorkloadResult {
+    double ms = 0;
+    double maxPauseUs = 0;
+    size_t peakBytes = 0;
+};
+
+static WorkloadResult runGc(bool incremental, int lists, int length, int window) {
+    GcHeap::Config config;
+    config.incremental = incremental;
+    GcHeap heap(config);
+
+    std::vector<Value*> live(window, nullptr);
+    for (Value*& slot : live) {
+        heap.addRoot(&slot);
+    }
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < lists; ++i) {
+        live[i % window] = buildList(heap, length, i);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    for (int i = 0; i < window; ++i) {
+        assert(listLength(live[i]) == length);
+    }
+    WorkloadResult result;
+    result.ms = std::chrono::duration<double, std::milli>(end - start).count();
+    result.maxPauseUs = heap.stats().maxPauseNanos / 1000.0;
+    result.peakBytes = heap.reservedBytes();
+    return result;
+}
+
+// The arena version frees nothing until the whole window dies together
+static WorkloadResult runArena(int lists, int length, int window) {
+    ValuePool pool;
+    WorkloadResult result;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < lists; ++i) {
+        if (i % window == 0) {
+            auto resetStart = std::chrono::high_resolution_clock::now();
+            pool.reset();
+            auto resetEnd = std::chrono::high_resolution_clock::now();
+            result.maxPauseUs = std::max(result.maxPauseUs,
+                                         std::chrono::duration<double, std::micro>(resetEnd - resetStart).count());
+        }
+        Value* head = pool.create<Value>(I32(i));
+        for (int j = 1; j < length; ++j) {
+            head = pool.create<Value>(head);
+        }
+        assert(listLength(head) == length);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    result.ms = std::chrono::duration<double, std::milli>(end - start).count();
+    result.peakBytes = pool.reservedBytes();
+    return result;
+}
+
+void benchmark_pause_and_throughput() {
+    std::cout << "\n🔹 Benchmarking pauses and throughput against the arena...\n";
+
+    const int lists = 5000;
+    const int length = 1000;
+    const int window = 64;   // ~64K live Values at any time
+
+    WorkloadResult incremental = runGc(true, lists, length, window);
+    WorkloadResult stopTheWorld = runGc(false, lists, length, window);
+    WorkloadResult arena = runArena(lists, length, window);
+
+    auto report = [](const char* name, const WorkloadResult& r) {
+        std::cout << "  " << name << r.ms << " ms, max pause " << r.maxPauseUs << " us, peak "
+                  << r.peakBytes / 1024 << " KiB\n";
+    };
+    std::cout << "  " << lists << " lists of " << length << " Values, last " << window << " kept:\n";
+    report("GC, incremental:     ", incremental);
+    report("GC, stop-the-world:  ", stopTheWorld);
+    report("ValuePool + reset(): ", arena);
+}
@@ -0,0 +1,392 @@
+#include "../types/half.hpp"
+#include "../types/bits.hpp"
+#include "test_helpers.hpp"
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace holycpp;
+using namespace holycpp::testing;
+
+// Test function prototypes
+void test_widening();
+void test_narrowing_f16();
+void test_narrowing_bf16();
+void test_double_rounding();
+void test_arithmetic();
+void benchmark_conversion();
+void benchmark_bandwidth();
+
+int main() {
+    std::cout << "🧪 Running HolyC++ F16/BF16 Tests\n";
+    std::cout << "=================================\n";
+
+    try {
+        test_widening();
+        test_narrowing_f16();
+        test_narrowing_bf16();
+        test_double_rounding();
+        test_arithmetic();
+        benchmark_conversion();
+        benchmark_bandwidth();
+
+        std::cout << "\n✅ All F16/BF16 tests passed!\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ Test failed: " << e.what() << "\n";
+        return 1;
+    }
+}
+
+// Rounds a double to nearest-even with `fraction` stored bits and the
+// given exponent bias, by scaling instead of bit tricks
+static uint16_t referenceNarrow(double value, int fraction, int bias) {
+    const uint32_t sign = std::signbit(value) ? 0x8000 : 0;
+    const uint32_t infinity = ((2u * bias + 1) << fraction);
+    const double magnitude = std::fabs(value);
+    if (std::isnan(value)) {
+        return static_cast<uint16_t>(sign | infinity | (1u << (fraction - 1)));
+    }
+    if (magnitude == 0 || std::isinf(magnitude)) {
+        return static_cast<uint16_t>(sign | (magnitude == 0 ? 0 : infinity));
+    }
+    const int exponent = std::max(std::ilogb(magnitude), 1 - bias);
+    const double scaled = std::nearbyint(std::ldexp(magnitude, fraction - exponent));
+    uint32_t bits = static_cast<uint32_t>(scaled);
+    if (std::ilogb(magnitude) >= 1 - bias) {
+        bits += static_cast<uint32_t>(exponent + bias - 1) << fraction;   // Leading 1 carries into the exponent
+    }
+    return static_cast<uint16_t>(sign | std::min(bits, infinity));
+}
+
+static uint16_t referenceF16(double value) { return referenceNarrow(value, 10, 15); }
+static uint16_t referenceBF16(double value) { return referenceNarrow(value, 7, 127); }
+
+static uint32_t bitsOf(float value) { return halfbits::floatBits(value); }
+
+static uint64_t bitsOf(double value) {
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+template<typename Half>
+static std::vector<Half> allPatterns() {
+    std::vector<Half> values;
+    for (uint32_t bits = 0; bits < 0x10000; ++bits) {
+        values.push_back(Half::from_bits(static_cast<uint16_t>(bits)));
+    }
+    return values;
+}
+
+void test_widening() {
+    std::cout << "\n🔹 Testing widening of every bit pattern...\n";
+
+    const auto halves = allPatterns<F16>();
+    const auto brains = allPatterns<BF16>();
+    std::vector<F32> singles(0x10000);
+    std::vector<F64> doubles(0x10000);
+
+    convertArray(halves.data(), singles.data(), halves.size());
+    for (uint32_t i = 0; i < 0x10000; ++i) {
+        assert(bitsOf(singles[i].raw()) == bitsOf(float(halves[i])));
+    }
+    convertArray(halves.data(), doubles.data(), halves.size());
+    for (uint32_t i = 0; i < 0x10000; ++i) {
+        const float value = float(halves[i]);
+        assert(bitsOf(doubles[i].raw()) == bitsOf(static_cast<double>(value)));
+        if (!std::isnan(value)) {
+            assert(referenceF16(value) == i);   // The widened value is exact
+        }
+    }
+    assert(float(F16::from_bits(0x0001)) == std::ldexp(1.0f, -24));   // Smallest subnormal
+    assert(float(F16::from_bits(0x7BFF)) == 65504.0f);
+    assert(std::isinf(float(F16::from_bits(0xFC00))) && float(F16::from_bits(0xFC00)) < 0);
+
+    convertArray(brains.data(), singles.data(), brains.size());
+    for (uint32_t i = 0; i < 0x10000; ++i) {
+        assert(bitsOf(singles[i].raw()) == (i << 16));
+    }
+    convertArray(brains.data(), doubles.data(), brains.size());
+    for (uint32_t i = 0; i < 0x10000; ++i) {
+        assert(bitsOf(doubles[i].raw()) == bitsOf(static_cast<double>(halfbits::bitsFloat(i << 16))));
+    }
+
+    std::cout << "  ✓ All 65536 F16 and BF16 values widen exactly on "
+              << (bits::cpuHasF16c() ? "F16C" : "scalar") << " and scalar paths\n";
+}
+
+// Floats to check narrowing on: random bit patterns, every F16 value and
+// the midpoints around it, and the edges of each range
+static std::vector<float> narrowingInputs() {
+    std::vector<float> inputs;
+    std::mt19937 rng(7);
+    for (int i = 0; i < 2000000; ++i) {
+        inputs.push_back(halfbits::bitsFloat(rng()));
+    }
+    for (uint32_t bits = 0; bits < 0x7C00; ++bits) {
+        const float value = float(F16::from_bits(static_cast<uint16_t>(bits)));
+        const float next = float(F16::from_bits(static_cast<uint16_t>(bits + 1)));
+        const float middle = value + (next - value) / 2;   // Exact: a tie
+        for (float v : {value, middle, std::nextafter(middle, 0.0f), std::nextafter(middle, 1e9f)}) {
+            inputs.push_back(v);
+            inputs.push_back(-v);
+        }
+    }
+    for (float v : {65504.0f, 65519.996f, 65520.0f, 1e10f, 5.9604645e-8f, 2.9802322e-8f, 2.9802326e-8f,
+                    1e-40f, std::numeric_limits<float>::infinity(), std::numeric_limits<float>::max()}) {
+        inputs.push_back(v);
+        inputs.push_back(-v);
+    }
+    return inputs;
+}
+
+void test_narrowing_f16() {
+    std::cout << "\n🔹 Testing narrowing to F16...\n";
+
+    const std::vector<float> inputs = narrowingInputs();
+    std::vector<F32> singles(inputs.begin(), inputs.end());
+    std::vector<F16> halves(inputs.size());
+    convertArray(singles.data(), halves.data(), singles.size());
+
+    size_t nans = 0;
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        const uint16_t scalar = F16(inputs[i]).raw();
+        assert(halves[i].raw() == scalar);
+        if (std::isnan(inputs[i])) {
+            // Quiet, same sign, top payload bits kept
+            assert((scalar & 0x7E00) == 0x7E00 && (scalar >> 15) == (bitsOf(inputs[i]) >> 31));
+            assert((scalar & 0x1FF) == ((bitsOf(inputs[i]) >> 13) & 0x1FF));
+            ++nans;
+        } else {
+            assert(scalar == referenceF16(inputs[i]));
+        }
+    }
+    assert(F16(65519.996f).raw() == 0x7BFF && F16(65520.0f).raw() == 0x7C00);
+    assert(F16(2.9802322e-8f).raw() == 0x0000);   // 2^-25 ties to even: zero
+    assert(F16(2.9802326e-8f).raw() == 0x0001);   // Just above: the smallest subnormal
+
+    // Doubles: every input widened, plus random doubles
+    std::vector<F64> doubles;
+    std::mt19937_64 rng(8);
+    for (float v : inputs) {
+        doubles.push_back(F64(static_cast<double>(v)));
+    }
+    for (int i = 0; i < 1000000; ++i) {
+        uint64_t bits = rng();
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        doubles.push_back(F64(value));
+        doubles.push_back(F64(std::ldexp(static_cast<double>(rng() >> 11), -53 - static_cast<int>(rng() % 40) + 17)));
+    }
+    halves.resize(doubles.size());
+    convertArray(doubles.data(), halves.data(), doubles.size());
+    for (size_t i = 0; i < doubles.size(); ++i) {
+        const double value = doubles[i].raw();
+        assert(halves[i].raw() == F16(value).raw());
+        assert(std::isnan(value) || F16(value).raw() == referenceF16(value));
+    }
+
+    std::cout << "  ✓ " << inputs.size() << " floats and " << doubles.size()
+              << " doubles round to nearest-even (" << nans << " NaNs stay quiet NaNs)\n";
+}
+
+void test_narrowing_bf16() {
+    std::cout << "\n🔹 Testing narrowing to BF16...\n";
+
+    std::vector<float> inputs = narrowingInputs();
+    for (uint32_t bits = 0; bits < 0x7F80; bits += 3) {
+        const uint32_t high = bits << 16;
+        for (uint32_t low : {0x0000u, 0x7FFFu, 0x8000u, 0x8001u, 0xFFFFu}) {
+            inputs.push_back(halfbits::bitsFloat(high | low));   // Ties and their neighbours
+        }
+    }
+    std::vector<F32> singles(inputs.begin(), inputs.end());
+    std::vector<BF16> brains(inputs.size());
+    convertArray(singles.data(), brains.data(), singles.size());
+
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        const uint16_t scalar = BF16(inputs[i]).raw();
+        assert(brains[i].raw() == scalar);
+        if (std::isnan(inputs[i])) {
+            assert((scalar & 0x7FC0) == 0x7FC0 && (scalar >> 6) == ((bitsOf(inputs[i]) >> 22) | 1));
+        } else {
+            assert(scalar == referenceBF16(inputs[i]));
+        }
+    }
+
+    std::vector<F64> doubles;
+    std::mt19937_64 rng(9);
+    for (int i = 0; i < 1000000; ++i) {
+        const double value = std::ldexp(static_cast<double>(rng() >> 11), static_cast<int>(rng() % 300) - 200);
+        doubles.push_back(F64(rng() & 1 ? value : -value));
+    }
+    doubles.push_back(F64(std::nan("")));
+    doubles.push_back(F64(1e300));
+    std::vector<BF16> narrowed(doubles.size());
+    convertArray(doubles.data(), narrowed.data(), doubles.size());
+    for (size_t i = 0; i < doubles.size(); ++i) {
+        const double value = doubles[i].raw();
+        assert(narrowed[i].raw() == BF16(value).raw());
+        assert(std::isnan(value) || narrowed[i].raw() == referenceBF16(value));
+    }
+
+    std::cout << "  ✓ " << inputs.size() << " floats and " << doubles.size() << " doubles round to nearest-even\n";
+}
+
+void test_double_rounding() {
+    std::cout << "\n🔹 Testing F64 narrowing without double rounding...\n";
+
+    // Just above the midpoint of 1 and the next F16. Through a plain F32 it
+    // becomes the midpoint itself, which ties down to 1.
+    const double justAbove = 1.0 + std::ldexp(1.0, -11) + std::ldexp(1.0, -40);
+    assert(F16(static_cast<float>(justAbove)).raw() == 0x3C00);   // What double rounding gives
+    assert(F16(justAbove).raw() == 0x3C01);
+    F64 wide[4] = {F64(justAbove), F64(-justAbove), F64(1.0), F64(0.0)};
+    F16 narrow[4];
+    convertArray(wide, narrow, 4);
+    assert(narrow[0].raw() == 0x3C01 && narrow[1].raw() == 0xBC01);
+
+    const double bfAbove = 1.0 + std::ldexp(1.0, -8) + std::ldexp(1.0, -40);
+    assert(BF16(static_cast<float>(bfAbove)).raw() == 0x3F80);
+    assert(BF16(bfAbove).raw() == 0x3F81);
+
+    std::cout << "  ✓ Round-to-odd through F32 matches direct rounding\n";
+}
+
+void test_arithmetic() {
+    std::cout << "\n🔹 Testing arithmetic...\n";
+
+    static_assert(is_half_holyc_v<F16> && is_half_holyc_v<BF16> && !is_half_holyc_v<F32>);
+    static_assert(sizeof(F16) == 2 && sizeof(BF16) == 2);
+
+    F16 a = 1.5f;
+    F16 b(2);
+    assert(a + b == 3.5f && b - a == 0.5f && a * b == 3 && b / F16(4) == 0.5f);
+    assert(a + 1 == F16(2.5f) && a * 2.0 == 3.0f);
+    assert(F16(2048) + F16(1) == 2048);   // 2049 is not an F16; ties to even
+    assert((F16(65504) + F16(65504)).is_inf());
+    assert(F16(0.0f) == F16(-0.0f) && F16(-0.0f).raw() == 0x8000);
+    assert((-a).raw() == (a.raw() ^ 0x8000));
+    assert(F16(std::nanf("")).is_nan() && !(F16(std::nanf("")) == F16(std::nanf(""))));
+    assert(a < b && b >= a && a != b);
+
+    F16 sum;
+    for (int i = 0; i < 10; ++i) {
+        sum += F16(0.1f);
+    }
+    assert(std::fabs(float(sum) - 1.0f) < 0.002f);
+
+    bool threw = false;
+    try {
+        a / F16(0.0f);
+    } catch (const std::domain_error&) {
+        threw = true;
+    }
+    assert(threw);
+
+    BF16 big = 3e38f;
+    assert(big.is_finite() && (big * BF16(2)).is_inf());
+    assert(BF16(1) + BF16(0.00390625f) == 1);   // 2^-8 is half a BF16 ulp at 1: a tie, to even
+    assert(BF16(256) + BF16(1) == 256 && BF16(256) + BF16(2) == 258);
+    assert(float(BF16(1e-40f)) != 0.0f);   // BF16 keeps F32's subnormal range
+
+    assert(a.to_f32() == F32(1.5f) && a.to_f64() == F64(1.5));
+    assert(F16(F64(0.25)) == 0.25f && BF16(F32(-2.0f)) == -2);
+
+    std::cout << "  ✓ Results round once from F32; specials and division by zero behave like FInt\n";
+}
+
+template<typename In, typename Out, typename Scalar>
+static void compareConversion(const char* name, const std::vector<In>& in, std::vector<Out>& out, Scalar scalar) {
+    const int rounds = 10;
+    const double simd = nanosPerValue(in.size(), rounds, [&] { convertArray(in.data(), out.data(), in.size()); });
+    const double plain = nanosPerValue(in.size(), rounds, [&] {
+        for (size_t i = 0; i < in.size(); ++i) {
+            out[i] = scalar(in[i]);
+        }
+    });
+    const double bytes = sizeof(In) + sizeof(Out);
+    std::cout << "  " << name << ": convertArray " << simd << " ns/value (" << bytes / simd << " GB/s), scalar "
+              << plain << " ns/value, " << plain / simd << "x\n";
+}
+
+void benchmark_conversion() {
+    std::cout << "\n🔹 Benchmarking bulk conversion (4M values)...\n";
+
+    const size_t count = 1 << 22;
+    std::mt19937 rng(10);
+    std::normal_distribution<float> normal(0.0f, 100.0f);
+    std::vector<F32> singles(count);
+    std::vector<F64> doubles(count);
+    for (size_t i = 0; i < count; ++i) {
+        singles[i] = normal(rng);
+        doubles[i] = static_cast<double>(singles[i].raw()) * 1.0000001;
+    }
+    std::vector<F16> halves(count);
+    std::vector<BF16> brains(count);
+    convertArray(singles.data(), halves.data(), count);
+    convertArray(singles.data(), brains.data(), count);
+
+    compareConversion("F16 -> F32 ", halves, singles, [](F16 h) { return F32(halfbits::f16ToFloat(h.raw())); });
+    compareConversion("F32 -> F16 ", singles, halves, [](F32 f) { return F16::from_bits(halfbits::floatToF16(f.raw())); });
+    compareConversion("F16 -> F64 ", halves, doubles, [](F16 h) { return F64(halfbits::f16ToFloat(h.raw())); });
+    compareConversion("F64 -> F16 ", doubles, halves, [](F64 d) { return F16::from_bits(halfbits::doubleToF16(d.raw())); });
+    compareConversion("BF16 -> F32", brains, singles, [](BF16 b) { return F32(halfbits::bf16ToFloat(b.raw())); });
+    compareConversion("F32 -> BF16", singles, brains, [](F32 f) { return BF16::from_bits(halfbits::floatToBF16(f.raw())); });
+    compareConversion("BF16 -> F64", brains, doubles, [](BF16 b) { return F64(halfbits::bf16ToFloat(b.raw())); });
+    compareConversion("F64 -> BF16", doubles, brains, [](F64 d) { return BF16::from_bits(halfbits::doubleToBF16(d.raw())); });
+}
+
+void benchmark_bandwidth() {
+    std::cout << "\n🔹 Benchmarking a sum over 16M values...\n";
+
+    // Summing from F16 storage, widened in cache-sized blocks, against
+    // summing the F32 array directly
+    const size_t count = 1 << 24;
+    std::vector<F32> singles(count);
+    for (size_t i = 0; i < count; ++i) {
+        singles[i] = static_cast<float>(i % 1000) / 1000.0f;
+    }
+    std::vector<F16> halves(count);
+    convertArray(singles.data(), halves.data(), count);
+
+    // Eight running sums, so the loop waits on memory rather than on adds
+    auto sumInto = [](const F32* values, size_t n, float* sums) {
+        for (size_t i = 0; i < n; i += 8) {
+            for (size_t lane = 0; lane < 8; ++lane) {
+                sums[lane] += values[i + lane].raw();
+            }
+        }
+    };
+    auto total = [](const float* sums) {
+        double sum = 0;
+        for (size_t lane = 0; lane < 8; ++lane) {
+            sum += sums[lane];
+        }
+        return sum;
+    };
+
+    double fromSingles = 0, fromHalves = 0;
+    const double singleNanos = nanosPerValue(count, 5, [&] {
+        float sums[8] = {};
+        sumInto(singles.data(), count, sums);
+        fromSingles += total(sums);
+    });
+    std::vector<F32> block(4096);
+    const double halfNanos = nanosPerValue(count, 5, [&] {
+        float sums[8] = {};
+        for (size_t start = 0; start < count; start += block.size()) {
+            convertArray(halves.data() + start, block.data(), block.size());
+            sumInto(block.data(), block.size(), sums);
+        }
+        fromHalves += total(sums);
+    });
+    assert(std::fabs(fromSingles - fromHalves) / fromSingles < 1e-2);
+
+    std::cout << "  F32 array (64 MiB): " << singleNanos << " ns/value; F16 array (32 MiB) widened per block: "
+              << halfNanos << " ns/value\n";
+}
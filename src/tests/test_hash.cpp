@@ -0,0 +1,289 @@
+#include "../lib/hash.hpp"
+#include "../types/bits.hpp"
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+using namespace holycpp;
+
+// Test function prototypes
+void test_byte_hashing();
+void test_simd_path();
+void test_value_hashing();
+void test_containers();
+void benchmark_quality();
+void benchmark_throughput();
+
+int main() {
+    std::cout << "🧪 Running HolyC++ Hash Tests\n";
+    std::cout << "=============================\n";
+
+    try {
+        test_byte_hashing();
+        test_simd_path();
+        test_value_hashing();
+        test_containers();
+        benchmark_quality();
+        benchmark_throughput();
+
+        std::cout << "\n✅ All hash tests passed!\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ Test failed: " << e.what() << "\n";
+        return 1;
+    }
+}
+
+static std::vector<uint8_t> randomBytes(size_t count, uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    std::vector<uint8_t> bytes(count);
+    for (auto& byte : bytes) {
+        byte = static_cast<uint8_t>(rng());
+    }
+    return bytes;
+}
+
+void test_byte_hashing() {
+    std::cout << "\n🔹 Testing byte hashing...\n";
+
+    const std::vector<uint8_t> data = randomBytes(2100, 1);
+    std::set<uint64_t> seen;
+    for (size_t length = 0; length <= 2100; ++length) {
+        const uint64_t h = hashBytes(data.data(), length);
+        assert(h == hashBytes(data.data(), length));   // Deterministic
+        seen.insert(h);
+
+        // Every byte matters, on every path
+        if (length > 0 && (length < 80 || length % 97 == 0)) {
+            std::vector<uint8_t> changed(data.begin(), data.begin() + length);
+            for (size_t i = 0; i < length; ++i) {
+                changed[i] ^= 0x01;
+                assert(hashBytes(changed.data(), length) != h);
+                changed[i] ^= 0x01;
+            }
+        }
+    }
+    assert(seen.size() == 2101);   // Prefixes of one buffer all differ
+
+    assert(hashBytes(data.data(), 100, 1) != hashBytes(data.data(), 100, 2));
+    assert(hashBytes(data.data(), 1000, 1) != hashBytes(data.data(), 1000, 2));
+    assert(hashBytes(std::string_view("HolyC")) == hashBytes("HolyC", 5));
+    assert(hash(std::string_view("")) != hash(std::string_view("\0", 1)));
+
+    std::cout << "  ✓ Lengths 0..2100 are deterministic and sensitive to every byte\n";
+}
+
+void test_simd_path() {
+    std::cout << "\n🔹 Testing the long-input paths...\n";
+
+    const std::vector<uint8_t> data = randomBytes(70000, 2);
+    for (size_t length = 64; length < 70000; length += (length < 3000 ? 1 : 997)) {
+        for (uint64_t seed : {uint64_t(0), uint64_t(0x1234)}) {
+            assert(hashing::hashLong(data.data(), length, seed) == hashing::hashLongScalar(data.data(), length, seed));
+        }
+    }
+
+    std::cout << "  ✓ " << (bits::cpuHasAvx2() ? "AVX2" : "Dispatched") << " and scalar lanes agree\n";
+}
+
+void test_value_hashing() {
+    std::cout << "\n🔹 Testing HolyC value hashing...\n";
+
+    // Floats: equal values hash equally
+    assert(hash(F64(0.0)) == hash(F64(-0.0)));
+    assert(hash(F32(0.0f)) == hash(F32(-0.0f)));
+    double payloadNaN;
+    uint64_t nanBits = 0x7FF0000000000ABCull;
+    std::memcpy(&payloadNaN, &nanBits, sizeof(payloadNaN));
+    assert(hash(F64(payloadNaN)) == hash(F64(std::nan(""))));
+    assert(hash(F64(-std::nan(""))) == hash(F64(std::nan(""))));
+    assert(hash(F32(std::nanf("1"))) == hash(F32(-std::nanf(""))));
+    assert(hash(F64(1.0)) != hash(F64(-1.0)));
+
+    // Integers mix every width; signed values hash their pattern
+    assert(hash(U8(1)) != hash(U8(2)));
+    assert(hash(I32(-1)) == hash(U32(0xFFFFFFFFu)));
+    assert(hash(U64(1), 7) != hash(U64(1), 8));
+
+    // Value and Union hash the active type with the value
+    assert(hash(Value(I32(5))) == hash(Value(I32(5))));
+    assert(hash(Value(I32(5))) != hash(Value(U32(5))));
+    Value assigned;
+    assigned.set_uint(U32(5));
+    assert(assigned.is_uint() && hash(assigned) == hash(Value(U32(5))));
+    assert(hash(Value(F64(0.0))) == hash(Value(F64(-0.0))));
+    Value target;
+    assert(hash(Value(&target)) == hash(Value(&target)));
+    assert(hash(Value()) == hash(Value()));
+
+    using Number = Union<I32, F64, U0>;
+    Number integer(I32(1));
+    Number real(F64(1.0));
+    Number empty;
+    assert(hash(integer) != hash(real));
+    assert(hash(integer) == hash(Number(I32(1))));
+    assert(hash(empty) == hash(Number()));
+    assert(hash(Number(U0())) != hash(empty));
+
+    std::cout << "  ✓ -0.0 == 0.0, NaNs are canonical, unions hash by active type\n";
+}
+
+void test_containers() {
+    std::cout << "\n🔹 Testing standard containers...\n";
+
+    std::unordered_set<U64> words;
+    for (uint64_t i = 0; i < 1000; ++i) {
+        words.insert(U64(i * 3));
+    }
+    assert(words.size() == 1000 && words.count(U64(300)) && !words.count(U64(301)));
+
+    std::unordered_map<F64, int> table;
+    table[F64(0.0)] = 1;
+    table[F64(-0.0)] += 1;
+    assert(table.size() == 1 && table[F64(0.0)] == 2);
+
+    std::unordered_map<I16, std::string, Hash> names;
+    names[I16(-3)] = "minus three";
+    assert(names.at(I16(-3)) == "minus three");
+
+    std::cout << "  ✓ std::hash and holycpp::Hash work as container hashers\n";
+}
+
+// Worst |P(output bit flips) - 1/2| over all input/output bit pairs
+template<typename F>
+static double avalancheBias(size_t inputBits, int samples, F hashOf) {
+    std::mt19937_64 rng(11);
+    std::vector<int> flips(inputBits * 64, 0);
+    std::vector<uint8_t> input((inputBits + 7) / 8);
+    for (int s = 0; s < samples; ++s) {
+        for (auto& byte : input) {
+            byte = static_cast<uint8_t>(rng());
+        }
+        const uint64_t base = hashOf(input);
+        for (size_t bit = 0; bit < inputBits; ++bit) {
+            input[bit / 8] ^= static_cast<uint8_t>(1u << (bit % 8));
+            uint64_t diff = base ^ hashOf(input);
+            input[bit / 8] ^= static_cast<uint8_t>(1u << (bit % 8));
+            for (int out = 0; out < 64; ++out) {
+                flips[bit * 64 + out] += (diff >> out) & 1;
+            }
+        }
+    }
+    double worst = 0;
+    for (int count : flips) {
+        worst = std::max(worst, std::fabs(static_cast<double>(count) / samples - 0.5));
+    }
+    return worst;
+}
+
+// Largest bucket over the average, for keys i << 20 in 4096 buckets
+template<typename F>
+static double strideLoad(F hashOf) {
+    const size_t buckets = 4096, keys = 1 << 16;
+    std::vector<size_t> load(buckets, 0);
+    for (uint64_t i = 0; i < keys; ++i) {
+        ++load[hashOf(i << 20) & (buckets - 1)];
+    }
+    return static_cast<double>(*std::max_element(load.begin(), load.end())) / (keys / buckets);
+}
+
+void benchmark_quality() {
+    std::cout << "\n🔹 Measuring hash quality...\n";
+
+    const int samples = 2000;
+    auto read32 = [](const std::vector<uint8_t>& in) {
+        uint32_t v;
+        std::memcpy(&v, in.data(), 4);
+        return v;
+    };
+    auto read64 = [](const std::vector<uint8_t>& in) {
+        uint64_t v;
+        std::memcpy(&v, in.data(), 8);
+        return v;
+    };
+    const double int32Bias = avalancheBias(32, samples, [&](const auto& in) { return hashInt(read32(in)); });
+    const double int64Bias = avalancheBias(64, samples, [&](const auto& in) { return hashInt(read64(in)); });
+    const double bytes16Bias = avalancheBias(128, samples, [](const auto& in) { return hashBytes(in.data(), in.size()); });
+    const double bytes100Bias = avalancheBias(800, 500, [](const auto& in) { return hashBytes(in.data(), in.size()); });
+    const double bytes600Bias = avalancheBias(4800, 200, [](const auto& in) { return hashBytes(in.data(), in.size()); });
+    // Sampling noise alone has a standard deviation of 0.5 / sqrt(samples)
+    auto noise = [](int n) { return 3.0 / std::sqrt(static_cast<double>(n)); };
+    assert(int32Bias < noise(samples) && int64Bias < noise(samples) && bytes16Bias < noise(samples));
+    assert(bytes100Bias < noise(500) && bytes600Bias < noise(200));
+
+    std::cout << "  Worst avalanche bias (0 is ideal, 6 sigma of noise is " << noise(samples) << " / " << noise(500)
+              << " / " << noise(200) << "): hashInt(U32) "
+              << int32Bias << ", hashInt(U64) " << int64Bias << ", 16 bytes " << bytes16Bias << ", 100 bytes "
+              << bytes100Bias << ", 600 bytes " << bytes600Bias << "\n";
+
+    const double ours = strideLoad([](uint64_t key) { return hash(U64(key)); });
+    const double standard = strideLoad([](uint64_t key) { return std::hash<uint64_t>()(key); });
+    assert(ours < 2.5);   // A random spread of 16 per bucket peaks near 2
+    std::cout << "  Keys i << 20 in 4096 buckets, fullest bucket / average: holycpp::hash " << ours
+              << ", std::hash<uint64_t> " << standard << "\n";
+}
+
+static uint64_t fnv1a(const uint8_t* data, size_t length) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < length; ++i) {
+        hash ^= data[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+template<typename F>
+static double nanosPerHash(const std::vector<uint8_t>& data, size_t length, size_t count, F hashOf) {
+    uint64_t sink = 0;
+    const size_t span = data.size() - length;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < count; ++i) {
+        sink += hashOf(data.data() + (i * 64) % (span + 1), length);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    volatile uint64_t keep = sink;
+    (void)keep;
+    return std::chrono::duration<double, std::nano>(end - start).count() / count;
+}
+
+void benchmark_throughput() {
+    std::cout << "\n🔹 Benchmarking throughput...\n";
+
+    const std::vector<uint8_t> data = randomBytes(4 << 20, 3);
+    for (size_t length : {size_t(8), size_t(16), size_t(64), size_t(256), size_t(1024), size_t(65536), size_t(1 << 20)}) {
+        const size_t count = std::max<size_t>(64, (64u << 20) / (length + 32));
+        const double ours = nanosPerHash(data, length, count, [](const uint8_t* p, size_t n) { return hashBytes(p, n); });
+        const double standard = nanosPerHash(data, length, count, [](const uint8_t* p, size_t n) {
+            return static_cast<uint64_t>(std::hash<std::string_view>()(std::string_view(reinterpret_cast<const char*>(p), n)));
+        });
+        const double fnv = nanosPerHash(data, length, count / 4 + 1, fnv1a);
+        std::cout << "  " << length << " bytes: hashBytes " << ours << " ns (" << length / ours
+                  << " GB/s), std::hash<string_view> " << standard << " ns (" << length / standard
+                  << " GB/s), FNV-1a " << fnv << " ns (" << length / fnv << " GB/s)\n";
+    }
+
+    std::vector<uint64_t> keys(1 << 20);
+    std::mt19937_64 rng(4);
+    for (auto& key : keys) {
+        key = rng();
+    }
+    uint64_t sink = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int round = 0; round < 20; ++round) {
+        for (uint64_t key : keys) {
+            sink += hash(U64(key));
+        }
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    volatile uint64_t keep = sink;
+    (void)keep;
+    std::cout << "  hash(U64): " << std::chrono::duration<double, std::nano>(end - start).count() / (20.0 * keys.size())
+              << " ns per key\n";
+}
@@ -0,0 +1,324 @@
+#include "../lib/hash_map.hpp"
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace holycpp;
+
+// Test function prototypes
+void test_basic_operations();
+void test_wrapper_keys();
+void test_string_keys();
+void test_value_lifetimes();
+void test_against_unordered_map();
+void test_copy_and_move();
+void benchmark_integer_keys();
+void benchmark_string_keys();
+
+int main() {
+    std::cout << "🧪 Running HolyC++ HashMap Tests\n";
+    std::cout << "================================\n";
+
+    try {
+        test_basic_operations();
+        test_wrapper_keys();
+        test_string_keys();
+        test_value_lifetimes();
+        test_against_unordered_map();
+        test_copy_and_move();
+        benchmark_integer_keys();
+        benchmark_string_keys();
+
+        std::cout << "\n✅ All HashMap tests passed!\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ Test failed: " << e.what() << "\n";
+        return 1;
+    }
+}
+
+void test_basic_operations() {
+    std::cout << "\n🔹 Testing basic operations...\n";
+
+    HashMap<U64, int> map;
+    assert(map.empty() && map.capacity() == 0 && !map.find(U64(1)));
+
+    assert(map.insert(U64(1), 10).second);
+    assert(!map.insert(U64(1), 20).second);   // Present: left alone
+    assert(*map.find(U64(1)) == 10);
+    map.assign(U64(1), 30);
+    assert(map.at(U64(1)) == 30);
+    map[U64(2)] += 5;
+    assert(map[U64(2)] == 5 && map.size() == 2);
+
+    bool threw = false;
+    try {
+        map.at(U64(3));
+    } catch (const std::out_of_range&) {
+        threw = true;
+    }
+    assert(threw);
+
+    assert(map.erase(U64(1)) && !map.erase(U64(1)));
+    assert(!map.contains(U64(1)) && map.contains(U64(2)) && map.size() == 1);
+
+    // Growth keeps every entry
+    for (uint64_t i = 0; i < 10000; ++i) {
+        map[U64(i * 7919)] = static_cast<int>(i);
+    }
+    for (uint64_t i = 0; i < 10000; ++i) {
+        assert(map.at(U64(i * 7919)) == static_cast<int>(i));
+    }
+    assert(map.capacity() >= map.size() && (map.capacity() & (map.capacity() - 1)) == 0);
+
+    map.clear();
+    assert(map.empty() && !map.contains(U64(7919)));
+    map[U64(5)] = 1;
+    assert(map.size() == 1);
+
+    HashMap<U32, int> reserved(1000);
+    const size_t capacity = reserved.capacity();
+    for (uint32_t i = 0; i < 1000; ++i) {
+        reserved[U32(i)] = 0;
+    }
+    assert(reserved.capacity() == capacity);   // reserve() avoided every rehash
+
+    std::cout << "  ✓ insert, assign, [], at, erase, clear and reserve\n";
+}
+
+void test_wrapper_keys() {
+    std::cout << "\n🔹 Testing HolyC wrapper keys...\n";
+
+    // Keys are stored as their storage_type
+    static_assert(std::is_same_v<hashmap::KeySlot<I32>::Stored, int32_t>);
+    static_assert(std::is_same_v<hashmap::KeySlot<U16>::Stored, uint16_t>);
+    static_assert(std::is_same_v<hashmap::KeySlot<F64>::Stored, double>);
+
+    HashMap<I32, int> signedKeys;
+    for (int i = -500; i <= 500; ++i) {
+        signedKeys[I32(i)] = i * 2;
+    }
+    assert(signedKeys.size() == 1001 && signedKeys.at(I32(-500)) == -1000);
+
+    HashMap<F64, int> floats;
+    floats[F64(0.0)] = 1;
+    assert(floats.contains(F64(-0.0)));
+    floats[F64(std::nan(""))] = 2;
+    assert(!floats.contains(F64(std::nan(""))));   // NaN != NaN, as with FInt
+
+    HashMap<U8, int> bytes;
+    for (int i = 0; i < 256; ++i) {
+        bytes[U8(static_cast<uint8_t>(i))] = i;
+    }
+    int sum = 0;
+    bytes.forEach([&](U8 key, int value) {
+        assert(key.raw() == value);
+        sum += value;
+    });
+    assert(bytes.size() == 256 && sum == 255 * 256 / 2);
+
+    HashMap<Value*, int> pointers;
+    Value a, b;
+    pointers[&a] = 1;
+    pointers[&b] = 2;
+    assert(pointers.at(&a) == 1 && pointers.at(&b) == 2);
+
+    std::cout << "  ✓ UInt, SInt, FInt and pointer keys\n";
+}
+
+void test_string_keys() {
+    std::cout << "\n🔹 Testing string keys...\n";
+
+    HashMap<std::string, int> words;
+    words["Print"] = 1;
+    words[std::string("MAlloc")] = 2;
+    std::string_view probe = "PrintX";
+    assert(words.contains(probe.substr(0, 5)));   // No std::string built
+    assert(!words.contains(probe));
+    assert(words.at("MAlloc") == 2);
+
+    // Long keys take the hashing long path
+    const std::string longKey(2000, 'x');
+    words[longKey] = 3;
+    assert(words.at(longKey) == 3 && !words.contains(std::string(1999, 'x')));
+
+    size_t totalLength = 0;
+    words.forEach([&](std::string_view key, int) { totalLength += key.size(); });
+    assert(totalLength == 5 + 6 + 2000);
+
+    std::cout << "  ✓ std::string keys looked up by std::string_view\n";
+}
+
+struct Counted {
+    static int live;
+    int value;
+    explicit Counted(int v = 0) : value(v) { ++live; }
+    Counted(const Counted& other) : value(other.value) { ++live; }
+    Counted(Counted&& other) noexcept : value(other.value) { ++live; }
+    Counted& operator=(const Counted&) = default;
+    Counted& operator=(Counted&&) = default;
+    ~Counted() { --live; }
+};
+int Counted::live = 0;
+
+void test_value_lifetimes() {
+    std::cout << "\n🔹 Testing value lifetimes...\n";
+
+    {
+        HashMap<U32, Counted> map;
+        for (uint32_t i = 0; i < 5000; ++i) {
+            map.emplace(U32(i), static_cast<int>(i));
+        }
+        assert(Counted::live == 5000);
+        for (uint32_t i = 0; i < 5000; i += 2) {
+            map.erase(U32(i));
+        }
+        assert(Counted::live == 2500);
+        HashMap<U32, Counted> copy = map;
+        assert(Counted::live == 5000 && copy.at(U32(1)).value == 1);
+        map.clear();
+        assert(Counted::live == 2500);
+    }
+    assert(Counted::live == 0);
+
+    std::cout << "  ✓ Every constructed value is destroyed exactly once\n";
+}
+
+void test_against_unordered_map() {
+    std::cout << "\n🔹 Cross-checking against std::unordered_map...\n";
+
+    // A small key range keeps inserts and erases colliding, which fills
+    // groups with tombstones and forces in-place rehashes
+    std::mt19937_64 rng(5);
+    HashMap<U64, uint64_t> map;
+    std::unordered_map<uint64_t, uint64_t> reference;
+    for (int op = 0; op < 400000; ++op) {
+        const uint64_t key = rng() % 3000;
+        switch (rng() % 4) {
+            case 0:
+            case 1:
+                map.assign(U64(key), static_cast<uint64_t>(op));
+                reference[key] = static_cast<uint64_t>(op);
+                break;
+            case 2:
+                assert(map.erase(U64(key)) == (reference.erase(key) == 1));
+                break;
+            default: {
+                const uint64_t* found = map.find(U64(key));
+                auto it = reference.find(key);
+                assert((found == nullptr) == (it == reference.end()));
+                assert(!found || *found == it->second);
+            }
+        }
+        assert(map.size() == reference.size());
+    }
+    size_t visited = 0;
+    map.forEach([&](U64 key, uint64_t value) {
+        assert(reference.at(key.raw()) == value);
+        ++visited;
+    });
+    assert(visited == reference.size());
+    assert(map.capacity() <= 8192);   // Tombstones did not make the table grow without bound
+
+    std::cout << "  ✓ 400000 random operations agree, capacity " << map.capacity() << "\n";
+}
+
+void test_copy_and_move() {
+    std::cout << "\n🔹 Testing copy and move...\n";
+
+    HashMap<std::string, std::string> original;
+    original["a"] = "alpha";
+    original["b"] = "beta";
+
+    HashMap<std::string, std::string> copy(original);
+    copy["a"] = "changed";
+    assert(original.at("a") == "alpha" && copy.at("a") == "changed");
+
+    HashMap<std::string, std::string> moved(std::move(copy));
+    assert(moved.size() == 2 && copy.empty() && copy.capacity() == 0);
+    copy["c"] = "gamma";   // A moved-from map is usable
+    assert(copy.size() == 1);
+
+    moved = original;
+    assert(moved.at("a") == "alpha");
+    moved = std::move(original);
+    assert(moved.at("b") == "beta" && original.empty());
+
+    std::cout << "  ✓ Copies are independent; moved-from maps are empty and usable\n";
+}
+
+template<typename F>
+static double nanosPer(size_t operations, F run) {
+    auto start = std::chrono::high_resolution_clock::now();
+    run();
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / operations;
+}
+
+void benchmark_integer_keys() {
+    std::cout << "\n🔹 Benchmarking U64 keys...\n";
+
+    for (size_t n : {size_t(1000), size_t(100000), size_t(2000000)}) {
+        std::mt19937_64 rng(6);
+        std::vector<uint64_t> keys(n), misses(n);
+        for (size_t i = 0; i < n; ++i) {
+            keys[i] = rng();
+            misses[i] = rng();
+        }
+        const size_t rounds = std::max<size_t>(1, 2000000 / n);
+        uint64_t sink = 0;
+
+        double ours[4] = {}, standard[4] = {};
+        for (size_t round = 0; round < rounds; ++round) {
+            HashMap<U64, uint64_t> map;
+            ours[0] += nanosPer(n, [&] { for (uint64_t k : keys) map[U64(k)] = k; });
+            ours[1] += nanosPer(n, [&] { for (uint64_t k : keys) sink += *map.find(U64(k)); });
+            ours[2] += nanosPer(n, [&] { for (uint64_t k : misses) sink += map.contains(U64(k)); });
+            ours[3] += nanosPer(n, [&] { for (uint64_t k : keys) sink += map.erase(U64(k)); });
+
+            std::unordered_map<uint64_t, uint64_t> reference;
+            standard[0] += nanosPer(n, [&] { for (uint64_t k : keys) reference[k] = k; });
+            standard[1] += nanosPer(n, [&] { for (uint64_t k : keys) sink += reference.find(k)->second; });
+            standard[2] += nanosPer(n, [&] { for (uint64_t k : misses) sink += reference.count(k); });
+            standard[3] += nanosPer(n, [&] { for (uint64_t k : keys) sink += reference.erase(k); });
+        }
+        volatile uint64_t keep = sink;
+        (void)keep;
+
+        const char* names[4] = {"insert", "hit", "miss", "erase"};
+        std::cout << "  " << n << " keys (ns/op, HashMap vs std::unordered_map):";
+        for (int i = 0; i < 4; ++i) {
+            std::cout << " " << names[i] << " " << ours[i] / rounds << "/" << standard[i] / rounds;
+        }
+        std::cout << "\n";
+    }
+}
+
+void benchmark_string_keys() {
+    std::cout << "\n🔹 Benchmarking string keys...\n";
+
+    const size_t n = 200000;
+    std::vector<std::string> keys(n);
+    for (size_t i = 0; i < n; ++i) {
+        keys[i] = "identifier_" + std::to_string(i * 2654435761u);
+    }
+    uint64_t sink = 0;
+
+    HashMap<std::string, uint32_t> map;
+    const double ourInsert = nanosPer(n, [&] { for (size_t i = 0; i < n; ++i) map[keys[i]] = static_cast<uint32_t>(i); });
+    const double ourFind = nanosPer(n, [&] { for (const auto& k : keys) sink += *map.find(k); });
+
+    std::unordered_map<std::string, uint32_t> reference;
+    const double stdInsert = nanosPer(n, [&] { for (size_t i = 0; i < n; ++i) reference[keys[i]] = static_cast<uint32_t>(i); });
+    const double stdFind = nanosPer(n, [&] { for (const auto& k : keys) sink += reference.find(k)->second; });
+    volatile uint64_t keep = sink;
+    (void)keep;
+
+    std::cout << "  " << n << " identifiers (ns/op, HashMap vs std::unordered_map): insert " << ourInsert << "/"
+              << stdInsert << " find " << ourFind << "/" << stdFind << "\n";
+}
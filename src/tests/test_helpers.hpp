@@ -0,0 +1,31 @@
+#pragma once
+#include <chrono>
+#include <cstddef>
+
+namespace holycpp {
+namespace testing {
+
+// True when run() throws E
+template<typename E, typename F>
+bool throws(F run) {
+    try {
+        run();
+    } catch (const E&) {
+        return true;
+    }
+    return false;
+}
+
+// Average time per value of `rounds` calls to run(), each over `count` values
+template<typename F>
+double nanosPerValue(size_t count, int rounds, F run) {
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int round = 0; round < rounds; ++round) {
+        run();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / (static_cast<double>(count) * rounds);
+}
+
+} // namespace testing
+} // namespace holycpp
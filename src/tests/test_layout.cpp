@@ -0,0 +1,307 @@
+#include "../types/layout.hpp"
+#include "../types/type_table.hpp"
+#include "../types/unsigned_int.hpp"
+#include "../types/signed_int.hpp"
+#include "../types/float.hpp"
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+using namespace holycpp;
+
+// Test function prototypes
+void test_natural_matches_abi();
+void test_packed_layout();
+void test_alignment_and_unions();
+void test_bit_field_access();
+void test_type_table_layouts();
+void benchmark_struct_heavy();
+
+int main() {
+    std::cout << "🧪 Running HolyC++ Class Layout Tests\n";
+    std::cout << "======================================\n";
+
+    try {
+        test_natural_matches_abi();
+        test_packed_layout();
+        test_alignment_and_unions();
+        test_bit_field_access();
+        test_type_table_layouts();
+        benchmark_struct_heavy();
+
+        std::cout << "\n✅ All class layout tests passed!\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ Test failed: " << e.what() << "\n";
+        return 1;
+    }
+}
+
+// What GCC does with the same declaration
+struct CFlags {
+    uint32_t a : 3;
+    uint32_t b : 7;
+    uint8_t c;
+    uint16_t d : 9;
+    uint64_t e : 40;
+    int8_t f : 4;
+    int32_t g;
+};
+
+using FlagsLayout = ClassLayout<LayoutMode::NATURAL,
+    BitField<U32, 3>, BitField<U32, 7>, Member<U8>, BitField<U16, 9>,
+    BitField<U64, 40>, BitField<I8, 4>, Member<I32>>;
+
+void test_natural_matches_abi() {
+    std::cout << "\n🔹 Testing natural layout against the C ABI...\n";
+
+    static_assert(FlagsLayout::SIZE == sizeof(CFlags));
+    static_assert(FlagsLayout::ALIGN == alignof(CFlags));
+    static_assert(FlagsLayout::SLOTS[2].offset == offsetof(CFlags, c));
+    static_assert(FlagsLayout::SLOTS[6].offset == offsetof(CFlags, g));
+
+    CFlags c{};
+    c.a = 5;
+    c.b = 100;
+    c.c = 200;
+    c.d = 300;
+    c.e = 0xABCDE12345ULL;
+    c.f = -3;
+    c.g = -123456;
+
+    PackedRecord<FlagsLayout> record;
+    std::memcpy(record.data(), &c, sizeof(c));
+    assert(record.get<0>() == 5u);
+    assert(record.get<1>() == 100u);
+    assert(record.get<2>() == 200u);
+    assert(record.get<3>() == 300u);
+    assert(record.get<4>() == 0xABCDE12345ULL);
+    assert(record.get<5>() == -3);
+    assert(record.get<6>() == -123456);
+
+    // And back: writes land where GCC reads them
+    record.set<1>(U32(77));
+    record.set<5>(I8(int8_t(7)));
+    std::memcpy(&c, record.data(), sizeof(c));
+    assert(c.a == 5 && c.b == 77 && c.c == 200 && c.f == 7 && c.e == 0xABCDE12345ULL);
+
+    std::cout << "  ✓ Offsets, size and bit positions match GCC\n";
+}
+
+struct __attribute__((packed)) CPacked {
+    uint8_t kind;
+    uint32_t line;
+    uint16_t column;
+    double value;
+};
+
+using PackedLayout = ClassLayout<LayoutMode::PACKED,
+    Member<U8>, Member<U32>, Member<U16>, Member<F64>>;
+
+void test_packed_layout() {
+    std::cout << "\n🔹 Testing packed layout...\n";
+
+    static_assert(PackedLayout::SIZE == sizeof(CPacked));
+    static_assert(PackedLayout::ALIGN == 1);
+    static_assert(PackedLayout::SLOTS[1].offset == offsetof(CPacked, line));
+    static_assert(PackedLayout::SLOTS[3].offset == offsetof(CPacked, value));
+
+    // Bit-fields pack at bit granularity and straddle bytes
+    using Bits = ClassLayout<LayoutMode::PACKED,
+        BitField<U8, 3>, BitField<U16, 11>, BitField<U64, 60>, Member<U8>>;
+    static_assert(Bits::SLOTS[1].offset == 0 && Bits::SLOTS[1].bitOffset == 3 && Bits::SLOTS[1].size == 2);
+    // 14 bits used; a 60-bit field at bit 6 of byte 1 would need a 9-byte
+    // load, so it moves to byte 2
+    static_assert(Bits::SLOTS[2].offset == 2 && Bits::SLOTS[2].bitOffset == 0);
+    static_assert(Bits::SLOTS[3].offset == 10);
+    static_assert(Bits::SIZE == 11);
+
+    PackedRecord<Bits> record;
+    record.set<0>(U8(6));
+    record.set<1>(U16(2047));
+    record.set<2>(U64(0x0FEDCBA987654321ULL));
+    record.set<3>(U8(9));
+    assert(record.get<0>() == 6u && record.get<1>() == 2047u);
+    assert(record.get<2>() == 0x0FEDCBA987654321ULL && record.get<3>() == 9u);
+
+    std::cout << "  ✓ Members at byte, bit-fields at bit granularity\n";
+}
+
+void test_alignment_and_unions() {
+    std::cout << "\n🔹 Testing explicit alignment and unions...\n";
+
+    using Aligned = ClassLayout<LayoutMode::PACKED, Member<U8>, Member<U32, 4>, Member<U8>>;
+    static_assert(Aligned::SLOTS[1].offset == 4 && Aligned::SLOTS[2].offset == 8);
+    static_assert(Aligned::SIZE == 12 && Aligned::ALIGN == 4);
+
+    using Cache = ClassLayout<LayoutMode::NATURAL, Member<U8>, Member<U64, 64>>;
+    static_assert(Cache::SLOTS[1].offset == 64 && Cache::SIZE == 128 && Cache::ALIGN == 64);
+
+    // Zero-width bit-fields close the unit, as in C
+    LayoutBuilder closing;
+    closing.bitField(4, 3);
+    closing.bitField(4, 0);
+    assert(closing.bitField(4, 3).offset == 4);
+
+    using Overlay = ClassLayout<LayoutMode::UNION, Member<U8>, Member<F64>, BitField<U32, 12>>;
+    static_assert(Overlay::SIZE == 8 && Overlay::ALIGN == 8);
+    static_assert(Overlay::SLOTS[1].offset == 0 && Overlay::SLOTS[2].offset == 0);
+
+    bool threw = false;
+    try {
+        LayoutBuilder bad;
+        bad.member(4, 4, 3);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+
+    std::cout << "  ✓ Alignment raises offsets; unions overlay\n";
+}
+
+void test_bit_field_access() {
+    std::cout << "\n🔹 Testing bit-field reads and writes...\n";
+
+    using Signed = ClassLayout<LayoutMode::PACKED,
+        BitField<I8, 3>, BitField<I32, 17>, BitField<I64, 64>, BitField<U8, 1>>;
+    PackedRecord<Signed> record;
+    record.set<0>(I8(int8_t(-4)));
+    record.set<1>(I32(-65536));
+    record.set<2>(I64(INT64_MIN));
+    record.set<3>(U8(1));
+    assert(record.get<0>() == -4);
+    assert(record.get<1>() == -65536);
+    assert(record.get<2>() == INT64_MIN);
+    assert(record.get<3>() == 1u);
+
+    // Out-of-range values keep their low bits, and neighbours are untouched
+    record.set<0>(I8(int8_t(5)));   // 101 -> -3
+    assert(record.get<0>() == -3);
+    assert(record.get<1>() == -65536 && record.get<3>() == 1u);
+
+    std::cout << "  ✓ Signed fields sign-extend; writes stay in their bits\n";
+}
+
+void test_type_table_layouts() {
+    std::cout << "\n🔹 Testing TypeTable class layouts...\n";
+
+    TypeTable types;
+    TypeId flags = types.declareClass("CFlags");
+    types.defineClass(flags, {{"a", BuiltinTypes::U32, 3}, {"b", BuiltinTypes::U32, 7},
+                              {"c", BuiltinTypes::U8}, {"d", BuiltinTypes::U16, 9},
+                              {"e", BuiltinTypes::U64, 40}, {"f", BuiltinTypes::I8, 4},
+                              {"g", BuiltinTypes::I32}}, LayoutMode::NATURAL);
+    assert(types.size(flags) == sizeof(CFlags));
+    const auto& fields = types.fields(flags);
+    for (size_t i = 0; i < fields.size(); ++i) {
+        assert(fields[i].offset == FlagsLayout::SLOTS[i].offset);
+        assert(fields[i].loadSize == FlagsLayout::SLOTS[i].size);
+        assert(fields[i].bitOffset == FlagsLayout::SLOTS[i].bitOffset);
+        assert(fields[i].bitWidth == FlagsLayout::SLOTS[i].bitWidth);
+    }
+
+    TypeId packed = types.declareClass("Token");
+    types.defineClass(packed, {{"kind", BuiltinTypes::U8}, {"line", BuiltinTypes::U32},
+                               {"column", BuiltinTypes::U16}, {"value", BuiltinTypes::F64}},
+                      LayoutMode::PACKED);
+    assert(types.size(packed) == sizeof(CPacked));
+    assert(types.fields(packed)[3].offset == offsetof(CPacked, value));
+
+    // The pair form still lays out naturally
+    TypeId plain = types.declareClass("Plain");
+    types.defineClass(plain, {{"a", BuiltinTypes::U8}, {"b", BuiltinTypes::I64}});
+    assert(types.fields(plain)[1].offset == 8 && types.fields(plain)[1].loadSize == 8);
+
+    auto throwsInvalid = [&](std::vector<ClassFieldSpec> specs) {
+        TypeId cls = types.declareClass("Bad" + std::to_string(types.typeCount()));
+        try {
+            types.defineClass(cls, specs, LayoutMode::NATURAL);
+        } catch (const std::invalid_argument&) {
+            return true;
+        }
+        return false;
+    };
+    assert(throwsInvalid({{"x", BuiltinTypes::F64, 3}}));
+    assert(throwsInvalid({{"x", BuiltinTypes::U8, 9}}));
+    assert(throwsInvalid({{"x", BuiltinTypes::U8, 0, 6}}));
+    assert(throwsInvalid({{"x", types.pointerTo(BuiltinTypes::U8), 4}}));
+
+    std::cout << "  ✓ Declared classes carry load/shift/mask metadata\n";
+}
+
+// A lexer token as it is usually declared, one full-width field each
+struct NaturalToken {
+    U8 kind;
+    U32 line;
+    U16 column;
+    U8 isKeyword;
+    U8 hasSpaceBefore;
+    U8 radix;
+    I64 value;
+};
+
+// The same token packed: line fits 24 bits, column 12, kind 6
+using PackedToken = ClassLayout<LayoutMode::PACKED,
+    BitField<U32, 24>, BitField<U16, 12>, BitField<U8, 6>, BitField<U8, 1>,
+    BitField<U8, 1>, BitField<U8, 5>, Member<I64>>;
+
+void benchmark_struct_heavy() {
+    std::cout << "\n🔹 Benchmarking a struct-heavy token stream...\n";
+
+    const size_t count = 2000000;
+    const int passes = 10;
+
+    std::vector<NaturalToken> natural(count);
+    std::vector<PackedRecord<PackedToken>> packed(count);
+    for (size_t i = 0; i < count; ++i) {
+        NaturalToken& n = natural[i];
+        n.kind = U8(static_cast<uint8_t>(i % 50));
+        n.line = U32(static_cast<uint32_t>(i / 40));
+        n.column = U16(static_cast<uint16_t>(i % 4000));
+        n.isKeyword = U8(static_cast<uint8_t>(i % 3 == 0));
+        n.hasSpaceBefore = U8(static_cast<uint8_t>(i % 2));
+        n.radix = U8(static_cast<uint8_t>(i % 7 == 0 ? 16 : 10));
+        n.value = I64(static_cast<int64_t>(i) * 31 - 1000);
+
+        PackedRecord<PackedToken>& p = packed[i];
+        p.set<0>(n.line);
+        p.set<1>(n.column);
+        p.set<2>(n.kind);
+        p.set<3>(n.isKeyword);
+        p.set<4>(n.hasSpaceBefore);
+        p.set<5>(n.radix);
+        p.set<6>(n.value);
+    }
+
+    uint64_t naturalSum = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int pass = 0; pass < passes; ++pass) {
+        for (const NaturalToken& n : natural) {
+            naturalSum += n.line.raw() + n.column.raw() + n.kind.raw() + n.isKeyword.raw() +
+                          n.radix.raw() + static_cast<uint64_t>(n.value.raw());
+        }
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    double naturalMs = std::chrono::duration<double, std::milli>(end - start).count();
+
+    uint64_t packedSum = 0;
+    start = std::chrono::high_resolution_clock::now();
+    for (int pass = 0; pass < passes; ++pass) {
+        for (const PackedRecord<PackedToken>& p : packed) {
+            packedSum += p.get<0>().raw() + p.get<1>().raw() + p.get<2>().raw() + p.get<3>().raw() +
+                         p.get<5>().raw() + static_cast<uint64_t>(p.get<6>().raw());
+        }
+    }
+    end = std::chrono::high_resolution_clock::now();
+    double packedMs = std::chrono::duration<double, std::milli>(end - start).count();
+    assert(naturalSum == packedSum);
+
+    const double naturalMb = static_cast<double>(sizeof(NaturalToken) * count) / (1024 * 1024);
+    const double packedMb = static_cast<double>(sizeof(PackedRecord<PackedToken>) * count) / (1024 * 1024);
+    std::cout << "  " << count << " tokens: natural " << sizeof(NaturalToken) << " B each ("
+              << naturalMb << " MB, " << naturalMs << " ms for " << passes << " scans), packed "
+              << sizeof(PackedRecord<PackedToken>) << " B each (" << packedMb << " MB, "
+              << packedMs << " ms)\n";
+}
@@ -0,0 +1,184 @@
+#include "../compiler/compile_unit.hpp"
+#include "../compiler/thread_pool.hpp"
+#include "../runtime/bytecode.hpp"
+#include "../runtime/tiered.hpp"
+#include "../lib/error.hpp"
+#include "../lib/error_types.hpp"
+#include "bytecode_fixture.hpp"
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <stdexcept>
+
+using namespace holycpp;
+using namespace holycpp::testing;
+
+// Test function prototypes
+void test_pool_runs_every_task();
+void test_pool_exceptions();
+void test_parallel_compile();
+void test_deterministic_diagnostics();
+void benchmark_scaling();
+
+int main() {
+    std::cout << "🧪 Running HolyC++ Parallel Compilation Tests\n";
+    std::cout << "==============================================\n";
+
+    try {
+        test_pool_runs_every_task();
+        test_pool_exceptions();
+        test_parallel_compile();
+        test_deterministic_diagnostics();
+        benchmark_scaling();
+
+        std::cout << "\n✅ All parallel compilation tests passed!\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ Test failed: " << e.what() << "\n";
+        return 1;
+    }
+}
+
+void test_pool_runs_every_task() {
+    std::cout << "\n🔹 Testing work-stealing pool...\n";
+
+    for (size_t threads : {1, 2, 4, 8}) {
+        WorkStealingPool pool(threads);
+        assert(pool.threadCount() == threads);
+
+        // Reused across batches of different sizes, including empty ones
+        for (size_t count : {0, 1, 7, 1000}) {
+            std::vector<std::atomic<int>> hits(count);
+            pool.parallelFor(count, [&](size_t i) {
+                // Uneven work so idle participants have something to steal
+                volatile uint64_t spin = 0;
+                for (size_t k = 0; k < (i % 16 == 0 ? 20000 : 10); ++k) {
+                    spin = spin + k;
+                }
+                hits[i].fetch_add(1);
+            });
+            for (size_t i = 0; i < count; ++i) {
+                assert(hits[i].load() == 1);
+            }
+        }
+        std::cout << "  " << threads << " thread(s): " << pool.stolenTasks() << " tasks stolen\n";
+    }
+
+    std::cout << "  ✓ Every task runs exactly once\n";
+}
+
+void test_pool_exceptions() {
+    std::cout << "\n🔹 Testing exception propagation...\n";
+
+    WorkStealingPool pool(4);
+    std::atomic<int> ran{0};
+    bool threw = false;
+    try {
+        pool.parallelFor(100, [&](size_t i) {
+            ran.fetch_add(1);
+            if (i == 42) {
+                throw std::runtime_error("task 42 failed");
+            }
+        });
+    } catch (const std::runtime_error& e) {
+        threw = std::string(e.what()) == "task 42 failed";
+    }
+    assert(threw);
+    assert(ran.load() == 100);   // The batch still drains
+
+    // The pool stays usable afterwards
+    std::atomic<int> after{0};
+    pool.parallelFor(10, [&](size_t) { after.fetch_add(1); });
+    assert(after.load() == 10);
+
+    std::cout << "  ✓ First exception is rethrown after the batch\n";
+}
+
+void test_parallel_compile() {
+    std::cout << "\n🔹 Testing per-function parallel compilation...\n";
+
+    ErrorManager::get().clear();
+    std::vector<Function> unit = makeUnit(64, false);
+    std::vector<Function> original = unit;
+
+    WorkStealingPool pool(4);
+    UnitResult result = compileUnit(unit, pool);
+    assert(result.functions.size() == unit.size());
+    assert(result.failed == 0);
+    assert(ErrorManager::get().getTotalCount() == 0);
+
+    for (size_t i = 0; i < unit.size(); ++i) {
+        const CompiledFunction& compiled = result.functions[i];
+        assert(compiled.ok);
+        assert(compiled.code);
+        assert(compiled.stats.foldedOps >= 1);
+        Reg arg = Reg::ofInt(25);
+        const int64_t expected = Interpreter::run(original[i], &arg, 1).i;
+        assert(compiled.code->run(&arg, 1).i == expected);
+        assert(Interpreter::run(unit[i], &arg, 1).i == expected);
+    }
+
+    std::cout << "  ✓ Every function is folded and compiled\n";
+}
+
+std::string compileAndDump(size_t threads) {
+    ErrorManager::get().clear();
+    std::vector<Function> unit = makeUnit(300, true);
+    WorkStealingPool pool(threads);
+    compileUnit(unit, pool);
+
+    std::string out;
+    for (const auto& error : ErrorManager::get().getErrors()) {
+        out += error->format() + "\n";
+    }
+    return out;
+}
+
+void test_deterministic_diagnostics() {
+    std::cout << "\n🔹 Testing deterministic diagnostic order...\n";
+
+    const std::string serial = compileAndDump(1);
+    const int serialErrors = ErrorManager::get().getErrorCount();
+    assert(serialErrors > 0);
+    assert(serial.find("T012") != std::string::npos);
+    assert(serial.find("C005") != std::string::npos);
+    // First failing function in the unit comes first
+    assert(serial.find("'Div5'") < serial.find("'Bad11'"));
+
+    for (size_t threads : {2, 3, 8, 16}) {
+        for (int run = 0; run < 5; ++run) {
+            assert(compileAndDump(threads) == serial);
+            assert(ErrorManager::get().getErrorCount() == serialErrors);
+        }
+    }
+    ErrorManager::get().clear();
+
+    std::cout << "  ✓ Output matches the serial build for every thread count\n";
+}
+
+void benchmark_scaling() {
+    std::cout << "\n🔹 Benchmarking scaling...\n";
+
+    const size_t functions = 20000;
+    const std::vector<Function> source = makeUnit(functions, false);
+
+    double baseline = 0;
+    for (size_t threads : {1, 2, 4, 8, 16, 32}) {
+        std::vector<Function> unit = source;
+        WorkStealingPool pool(threads);
+        ErrorManager::get().clear();
+
+        auto start = std::chrono::high_resolution_clock::now();
+        UnitResult result = compileUnit(unit, pool);
+        auto end = std::chrono::high_resolution_clock::now();
+        assert(result.failed == 0);
+
+        double ms = std::chrono::duration<double, std::milli>(end - start).count();
+        if (threads == 1) {
+            baseline = ms;
+        }
+        std::cout << "  " << threads << " thread(s): " << ms << " ms ("
+                  << baseline / ms << "x, " << pool.stolenTasks() << " steals)\n";
+    }
+    std::cout << "  Hardware threads available: " << std::thread::hardware_concurrency() << "\n";
+}
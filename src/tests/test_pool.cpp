@@ -0,0 +1,306 @@
+#include "../runtime/value_pool.hpp"
+#include "../types/union_type.hpp"
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace holycpp;
+
+// Test function prototypes
+void test_size_classes();
+void test_value_graphs();
+void test_reset();
+void test_thread_caches();
+void benchmark_list_building();
+void benchmark_tree_building();
+
+int main() {
+    std::cout << "🧪 Running HolyC++ Value Pool Tests\n";
+    std::cout << "====================================\n";
+
+    try {
+        test_size_classes();
+        test_value_graphs();
+        test_reset();
+        test_thread_caches();
+        benchmark_list_building();
+        benchmark_tree_building();
+
+        std::cout << "\n✅ All value pool tests passed!\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ Test failed: " << e.what() << "\n";
+        return 1;
+    }
+}
+
+static bool aligned16(const void* ptr) {
+    return reinterpret_cast<uintptr_t>(ptr) % ValuePool::SLOT_ALIGN == 0;
+}
+
+void test_size_classes() {
+    std::cout << "\n🔹 Testing size classes and free lists...\n";
+
+    ValuePool pool;
+    std::vector<std::pair<void*, size_t>> live;
+    for (size_t bytes = 1; bytes <= 80; ++bytes) {
+        void* ptr = pool.allocate(bytes);
+        assert(aligned16(ptr));
+        std::memset(ptr, 0xAB, bytes);
+        live.emplace_back(ptr, bytes);
+    }
+    std::set<void*> distinct;
+    for (const auto& entry : live) {
+        distinct.insert(entry.first);
+    }
+    assert(distinct.size() == live.size());
+    assert(pool.slabCount() == ValuePool::CLASS_COUNT);   // One slab per class
+
+    // Freed slots come back first, per class
+    void* slot = pool.allocate(24);
+    pool.deallocate(slot, 24);
+    assert(pool.allocate(32) == slot);
+    assert(pool.allocate(32) != slot);
+
+    for (const auto& entry : live) {
+        pool.deallocate(entry.first, entry.second);
+    }
+    pool.deallocate(nullptr, 16);
+
+    static_assert(sizeof(Value) <= 16);
+    static_assert(sizeof(Union<I32, F64, U8>) <= ValuePool::MAX_SLOT);
+
+    std::cout << "  ✓ 16/32/48/64-byte slots, aligned and reused\n";
+}
+
+void test_value_graphs() {
+    std::cout << "\n🔹 Testing linked Value graphs...\n";
+
+    ValuePool pool;
+    Value* head = nullptr;
+    std::vector<Value*> nodes;
+    for (int i = 0; i < 100; ++i) {
+        head = pool.create<Value>(head);
+        nodes.push_back(head);
+    }
+    // Consecutive allocations sit next to each other
+    for (size_t i = 1; i < nodes.size(); ++i) {
+        assert(reinterpret_cast<char*>(nodes[i]) - reinterpret_cast<char*>(nodes[i - 1]) == 16);
+    }
+
+    size_t length = 0;
+    for (Value* v = head; v; v = v->as_value_ptr()) {
+        ++length;
+    }
+    assert(length == 100);
+
+    auto* leaf = pool.create<Union<I32, F64, U8>>(F64(2.5));
+    assert(leaf->get<F64>() == 2.5);
+    pool.destroy(leaf);
+
+    for (Value* v : nodes) {
+        pool.destroy(v);
+    }
+    std::cout << "  ✓ Values and unions live in adjacent slots\n";
+}
+
+void test_reset() {
+    std::cout << "\n🔹 Testing bulk reset...\n";
+
+    ValuePool pool;
+    for (int round = 0; round < 5; ++round) {
+        for (int i = 0; i < 20000; ++i) {
+            pool.create<Value>(F64(i));
+        }
+        pool.reset();
+        assert(pool.slabCount() == 0);
+    }
+    // 20000 16-byte slots fill five slabs, and the rounds reuse them
+    assert(pool.reservedBytes() == 5 * ValuePool::SLAB_BYTES);
+
+    std::cout << "  ✓ reset() frees everything and keeps the slabs\n";
+}
+
+void test_thread_caches() {
+    std::cout << "\n🔹 Testing per-thread caches...\n";
+
+    ValuePool pool(true);
+    const int threads = 4;
+    const int perThread = 20000;
+    std::vector<std::vector<Value*>> made(threads);
+
+    // Each thread allocates, and frees half of what it made right away
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            for (int i = 0; i < perThread; ++i) {
+                Value* v = pool.create<Value>(I32(t * perThread + i));
+                if (i % 2) {
+                    pool.destroy(v);
+                } else {
+                    made[t].push_back(v);
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    std::set<Value*> live;
+    for (int t = 0; t < threads; ++t) {
+        for (size_t i = 0; i < made[t].size(); ++i) {
+            assert(made[t][i]->is_int());
+            assert(made[t][i]->i == t * perThread + static_cast<int>(i) * 2);
+            live.insert(made[t][i]);
+        }
+    }
+    assert(live.size() == static_cast<size_t>(threads * perThread / 2));
+
+    // Free everything from another thread than the one that allocated it
+    workers.clear();
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            for (Value* v : made[(t + 1) % threads]) {
+                pool.destroy(v);
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    Value* again = ValuePool::shared().create<Value>(U8('x'));
+    assert(again->as_char() == 'x');
+    ValuePool::shared().destroy(again);
+
+    std::cout << "  ✓ Threads allocate and free concurrently, across threads too\n";
+}
+
+template<typename Alloc, typename Free>
+static double buildLists(int length, int rounds, Alloc alloc, Free release) {
+    uint64_t checksum = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int r = 0; r < rounds; ++r) {
+        Value* head = nullptr;
+        for (int i = 0; i < length; ++i) {
+            Value* v = alloc();
+            v->set_value_ptr(head);
+            head = v;
+        }
+        while (head) {
+            Value* next = head->as_value_ptr();
+            ++checksum;
+            release(head);
+            head = next;
+        }
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    assert(checksum == static_cast<uint64_t>(length) * rounds);
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+void benchmark_list_building() {
+    std::cout << "\n🔹 Benchmarking Value list building...\n";
+
+    const int length = 1000000;
+    const int rounds = 5;
+
+    double mallocMs = buildLists(length, rounds, [] { return MAllocValue(); },
+                                 [](Value* v) { Free(v); });
+
+    ValuePool pool;
+    double poolMs = buildLists(length, rounds, [&] { return static_cast<Value*>(pool.allocate(sizeof(Value))); },
+                               [&](Value* v) { pool.deallocate(v, sizeof(Value)); });
+
+    ValuePool cached(true);
+    double cachedMs = buildLists(length, rounds, [&] { return static_cast<Value*>(cached.allocate(sizeof(Value))); },
+                                 [&](Value* v) { cached.deallocate(v, sizeof(Value)); });
+
+    const double ops = 2.0 * length * rounds;
+    std::cout << "  " << rounds << " x " << length << "-node lists: MAllocValue/Free " << mallocMs
+              << " ms (" << mallocMs * 1e6 / ops << " ns/op), pool " << poolMs << " ms ("
+              << poolMs * 1e6 / ops << " ns/op), pool with thread caches " << cachedMs << " ms ("
+              << cachedMs * 1e6 / ops << " ns/op)\n";
+}
+
+// A binary tree of Values, as an interpreter's expression trees are
+struct TreeNode {
+    Value value;
+    TreeNode* left;
+    TreeNode* right;
+};
+
+template<typename Alloc>
+static TreeNode* buildTree(int depth, int64_t& counter, Alloc& alloc) {
+    if (depth == 0) {
+        return nullptr;
+    }
+    TreeNode* node = alloc();
+    node->value = Value(I32(static_cast<int32_t>(counter++)));
+    node->left = buildTree(depth - 1, counter, alloc);
+    node->right = buildTree(depth - 1, counter, alloc);
+    return node;
+}
+
+static int64_t sumTree(const TreeNode* node) {
+    return node ? node->value.i.raw() + sumTree(node->left) + sumTree(node->right) : 0;
+}
+
+template<typename Free>
+static void freeTree(TreeNode* node, Free& release) {
+    if (node) {
+        freeTree(node->left, release);
+        freeTree(node->right, release);
+        release(node);
+    }
+}
+
+template<typename Alloc, typename Free>
+static double treeWorkload(int depth, int rounds, Alloc alloc, Free release) {
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int r = 0; r < rounds; ++r) {
+        int64_t counter = 0;
+        TreeNode* root = buildTree(depth, counter, alloc);
+        for (int pass = 0; pass < 3; ++pass) {
+            assert(sumTree(root) == counter * (counter - 1) / 2);
+        }
+        freeTree(root, release);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+void benchmark_tree_building() {
+    std::cout << "\n🔹 Benchmarking Value tree building...\n";
+
+    const int depth = 20;   // 1M nodes
+    const int rounds = 3;
+
+    double mallocMs = treeWorkload(depth, rounds, [] { return MAlloc<TreeNode>(); },
+                                   [](TreeNode* node) { Free(node); });
+
+    ValuePool pool;
+    double poolMs = treeWorkload(depth, rounds, [&] { return static_cast<TreeNode*>(pool.allocate(sizeof(TreeNode))); },
+                                 [&](TreeNode* node) { pool.deallocate(node, sizeof(TreeNode)); });
+
+    // Whole-graph teardown in one call instead of a walk
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int r = 0; r < rounds; ++r) {
+        int64_t counter = 0;
+        auto alloc = [&] { return static_cast<TreeNode*>(pool.allocate(sizeof(TreeNode))); };
+        TreeNode* root = buildTree(depth, counter, alloc);
+        for (int pass = 0; pass < 3; ++pass) {
+            assert(sumTree(root) == counter * (counter - 1) / 2);
+        }
+        pool.reset();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    double resetMs = std::chrono::duration<double, std::milli>(end - start).count();
+
+    std::cout << "  " << rounds << " x " << (1 << depth) - 1 << "-node trees (build, 3 walks, free): MAlloc/Free "
+              << mallocMs << " ms, pool " << poolMs << " ms, pool with reset() " << resetMs << " ms\n";
+}
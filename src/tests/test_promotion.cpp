@@ -0,0 +1,177 @@
+#include "../types/signed_int.hpp"
+#include "../types/unsigned_int.hpp"
+#include "test_helpers.hpp"
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+using namespace holycpp;
+using namespace holycpp::testing;
+
+// Test function prototypes
+void test_result_types();
+void test_mixed_arithmetic();
+void test_mixed_comparisons();
+void test_policies();
+void test_same_width_unchanged();
+void benchmark_mixed_width();
+
+int main() {
+    std::cout << "🧪 Running HolyC++ Mixed-Width Arithmetic Tests\n";
+    std::cout << "===============================================\n";
+
+    try {
+        test_result_types();
+        test_mixed_arithmetic();
+        test_mixed_comparisons();
+        test_policies();
+        test_same_width_unchanged();
+        benchmark_mixed_width();
+
+        std::cout << "\n✅ All mixed-width arithmetic tests passed!\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ Test failed: " << e.what() << "\n";
+        return 1;
+    }
+}
+
+template<typename A, typename B>
+using Sum = decltype(std::declval<A>() + std::declval<B>());
+
+void test_result_types() {
+    std::cout << "\n🔹 Testing promoted result types...\n";
+
+    static_assert(std::is_same_v<Sum<U8, U32>, U64>);
+    static_assert(std::is_same_v<Sum<U32, U8>, U64>);
+    static_assert(std::is_same_v<Sum<I8, I32>, I64>);
+    static_assert(std::is_same_v<Sum<I16, U8>, I64>);
+    static_assert(std::is_same_v<Sum<U32, I32>, I64>);
+    static_assert(std::is_same_v<Sum<I64, U32>, I64>);
+    static_assert(std::is_same_v<Sum<I8, U64>, U64>);
+    static_assert(std::is_same_v<Sum<U64, I64>, U64>);
+    static_assert(std::is_same_v<decltype(std::declval<U16>() * std::declval<I8>()), I64>);
+    static_assert(std::is_same_v<decltype(std::declval<U8>() ^ std::declval<U16>()), U64>);
+
+    // Same-type operands keep their own operators and width
+    static_assert(std::is_same_v<Sum<U8, U8>, U8>);
+    static_assert(std::is_same_v<Sum<I32, I32>, I32>);
+
+    // The left operand's policy carries over
+    using TrapI8 = SInt<8, checking::Trapping>;
+    using TrapI64 = SInt<64, checking::Trapping>;
+    static_assert(std::is_same_v<Sum<TrapI8, U16>, TrapI64>);
+    static_assert(std::is_same_v<Sum<U16, TrapI8>, I64>);
+
+    std::cout << "  ✓ Mixed operands widen to I64, or U64 when unsigned or U64 is involved\n";
+}
+
+void test_mixed_arithmetic() {
+    std::cout << "\n🔹 Testing mixed-width arithmetic...\n";
+
+    // These used to narrow the right operand and throw out_of_range
+    assert(U8(200) + U32(1000) == U64(1200));
+    assert(U16(5) + I8(-1) == I64(4));
+    assert(U8(3) - U32(5) == U64(UINT64_MAX - 1));   // unsigned stays modular
+    assert(I8(3) - U32(5) == I64(-2));
+    assert(I8(-100) * I16(300) == I64(-30000));
+    assert(I32(INT32_MAX) + I8(1) == I64(int64_t(INT32_MAX) + 1));
+    assert(U32(UINT32_MAX) * U8(2) == U64(uint64_t(UINT32_MAX) * 2));
+    assert(I16(-7) / U8(2) == I64(-3) && I16(-7) % U8(2) == I64(-1));
+    assert((U8(0xF0) | U16(0x0F00)) == U64(0x0FF0));
+    assert((I8(-1) & U32(0xFF)) == I64(0xFF));
+
+    // A negative value meeting U64 wraps, as in C
+    assert(I8(-1) + U64(1) == U64(0));
+
+    std::cout << "  ✓ Operands widen without range checks; values are exact\n";
+}
+
+void test_mixed_comparisons() {
+    std::cout << "\n🔹 Testing mixed-width comparisons...\n";
+
+    assert(U8(200) == U32(200) && U8(200) != U32(201));
+    assert(I8(-1) < U64(1) && !(U64(1) < I8(-1)));
+    assert(U64(UINT64_MAX) > I64(-1) && I64(-1) != U64(UINT64_MAX));
+    assert(I8(-5) < I32(-4) && I32(-4) >= I8(-5));
+    assert(I16(300) > U8(255) && U8(255) <= I16(300));
+    assert(I64(7) == U8(7) && U8(7) == I64(7) && I32(-7) != U32(uint32_t(-7)));
+
+    std::cout << "  ✓ Comparisons order by value across widths and signedness\n";
+}
+
+void test_policies() {
+    std::cout << "\n🔹 Testing policies at 64 bits...\n";
+
+    using TrapI8 = SInt<8, checking::Trapping>;
+    using TrapU32 = UInt<32, checking::Trapping>;
+    using SatU8 = UInt<8, checking::Saturating>;
+
+    // Widening never overflows where the narrow type would
+    assert(TrapI8(100) + I16(100) == I64(200));
+    assert(TrapU32(UINT32_MAX) * U8(16) == U64(uint64_t(UINT32_MAX) * 16));
+
+    // The policy still applies to the 64-bit operation itself
+    assert(throws<std::underflow_error>([] { return TrapU32(1) - U8(2); }));
+    assert(throws<std::overflow_error>([] { return SInt<32, checking::Trapping>(2) * U64(UINT64_MAX); }));
+    assert(SatU8(1) - U16(2) == U64(0));
+    assert(throws<std::domain_error>([] { return TrapI8(1) / U16(0); }));
+
+    std::cout << "  ✓ Results follow the left operand's policy at the promoted width\n";
+}
+
+void test_same_width_unchanged() {
+    std::cout << "\n🔹 Testing same-type operators...\n";
+
+    assert(U8(200) + U8(100) == U8(44));   // Basic wraps at 8 bits
+    assert(I16(-3) * I16(4) == I16(-12));
+    U16 accumulator = U16(10);
+    accumulator += U16(5);
+    assert(accumulator == U16(15));
+
+    std::cout << "  ✓ Same-type arithmetic keeps its width and behavior\n";
+}
+
+void benchmark_mixed_width() {
+    std::cout << "\n🔹 Benchmarking I32 * U16 accumulated in 64 bits (64K pairs, in cache)...\n";
+
+    const size_t count = 1 << 16;
+    const int rounds = 1000;
+    std::vector<I32> a(count);
+    std::vector<U16> b(count);
+    for (size_t i = 0; i < count; ++i) {
+        a[i] = I32(static_cast<int32_t>(i * 2654435761u) >> 8);
+        b[i] = U16(static_cast<uint16_t>(i * 40503u));
+    }
+
+    int64_t sink = 0;
+    const double rawNanos = nanosPerValue(count, rounds, [&] {
+        int64_t total = 0;
+        for (size_t i = 0; i < count; ++i) {
+            total += static_cast<int64_t>(a[i].raw()) * b[i].raw();
+        }
+        sink += total;
+    });
+    const double promotedNanos = nanosPerValue(count, rounds, [&] {
+        I64 total(0);
+        for (size_t i = 0; i < count; ++i) {
+            total += a[i] * b[i];
+        }
+        sink += total.raw();
+    });
+    // What the same loop needed before: checked conversions to I64
+    const double convertedNanos = nanosPerValue(count, rounds, [&] {
+        I64 total(0);
+        for (size_t i = 0; i < count; ++i) {
+            total += I64(a[i]) * I64(b[i]);
+        }
+        sink += total.raw();
+    });
+    assert(sink != 0);
+
+    std::cout << "  raw int64_t " << rawNanos << " ns/pair, promoted operator " << promotedNanos
+              << ", explicit checked conversions " << convertedNanos << "\n";
+}
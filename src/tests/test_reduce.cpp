@@ -0,0 +1,371 @@
+#include "../types/reduce.hpp"
+#include "test_helpers.hpp"
+#include <algorithm>
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace holycpp;
+using namespace holycpp::testing;
+
+// Test function prototypes
+void test_fma();
+void test_summation_order();
+void test_accuracy();
+void test_cancellation();
+void test_dot();
+void test_norm();
+void test_special_values();
+void benchmark_reductions();
+
+int main() {
+    std::cout << "🧪 Running HolyC++ Reduction Tests\n";
+    std::cout << "==================================\n";
+
+    try {
+        test_fma();
+        test_summation_order();
+        test_accuracy();
+        test_cancellation();
+        test_dot();
+        test_norm();
+        test_special_values();
+        benchmark_reductions();
+
+        std::cout << "\n✅ All reduction tests passed!\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ Test failed: " << e.what() << "\n";
+        return 1;
+    }
+}
+
+static const Summation MODES[] = {Summation::NAIVE, Summation::PAIRWISE, Summation::COMPENSATED};
+
+static const char* modeName(Summation mode) {
+    switch (mode) {
+        case Summation::NAIVE:       return "NAIVE";
+        case Summation::PAIRWISE:    return "PAIRWISE";
+        case Summation::COMPENSATED: return "COMPENSATED";
+    }
+    return "?";
+}
+
+static std::vector<F64> uniformDoubles(size_t count, double low, double high, unsigned seed) {
+    std::mt19937_64 rng(seed);
+    std::uniform_real_distribution<double> dist(low, high);
+    std::vector<F64> values;
+    values.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        values.push_back(F64(dist(rng)));
+    }
+    return values;
+}
+
+// Neumaier summation in long double: many bits beyond double for the
+// inputs used here
+static long double referenceSum(const std::vector<F64>& values) {
+    long double sum = 0, correction = 0;
+    for (const F64& value : values) {
+        const long double x = value.raw();
+        const long double total = sum + x;
+        correction += std::fabs(sum) >= std::fabs(x) ? (sum - total) + x : (x - total) + sum;
+        sum = total;
+    }
+    return sum + correction;
+}
+
+static double ulpOf(double value) {
+    const double magnitude = std::fabs(value);
+    return std::nextafter(magnitude, std::numeric_limits<double>::infinity()) - magnitude;
+}
+
+static double relativeError(double result, long double exact) {
+    return static_cast<double>(std::fabs((result - exact) / exact));
+}
+
+void test_fma() {
+    std::cout << "\n🔹 Testing FInt::fma...\n";
+
+    // (1 + 2^-30)(1 - 2^-30) - 1 = -2^-60: zero when the product rounds first
+    const F64 a(1.0 + std::ldexp(1.0, -30));
+    const F64 b(1.0 - std::ldexp(1.0, -30));
+    assert(a.fma(b, F64(-1.0)).raw() == -std::ldexp(1.0, -60));
+    volatile double rounded = a.raw() * b.raw();
+    assert(rounded - 1.0 == 0.0);
+
+    const F32 c(1.0f + std::ldexp(1.0f, -12));
+    const F32 d(1.0f - std::ldexp(1.0f, -12));
+    assert(c.fma(d, F32(-1.0f)).raw() == -std::ldexp(1.0f, -24));
+
+    assert(F64(2.0).fma(F64(3.0), F64(4.0)).raw() == 10.0);
+    assert(F64(std::numeric_limits<double>::infinity()).fma(F64(0.0), F64(1.0)).is_nan());
+
+    std::cout << "  ✓ fma rounds once, for F32 and F64\n";
+}
+
+// The documented order: element i into sum i % 16, then a tree fold
+static double laneOrderSum(const F64* data, size_t count) {
+    double sums[reduction::LANES] = {};
+    for (size_t i = 0; i < count; ++i) {
+        sums[i % reduction::LANES] += data[i].raw();
+    }
+    for (size_t width = reduction::LANES / 2; width > 0; width /= 2) {
+        for (size_t lane = 0; lane < width; ++lane) {
+            sums[lane] += sums[lane + width];
+        }
+    }
+    return sums[0];
+}
+
+void test_summation_order() {
+    std::cout << "\n🔹 Testing summation order...\n";
+
+    // Wide exponent range, so any change of order shows in the low bits
+    std::mt19937_64 rng(47);
+    std::vector<F64> values;
+    for (size_t i = 0; i < 5000; ++i) {
+        const double magnitude = std::ldexp(std::uniform_real_distribution<double>(1.0, 2.0)(rng), int(rng() % 60) - 30);
+        values.push_back(F64(rng() & 1 ? magnitude : -magnitude));
+    }
+
+    const size_t block = reduction::PAIRWISE_BLOCK;
+    for (size_t count : {size_t(0), size_t(1), size_t(15), size_t(16), size_t(17), size_t(255), block, size_t(4999)}) {
+        assert(sum(values.data(), count, Summation::NAIVE).raw() == laneOrderSum(values.data(), count));
+    }
+
+    // PAIRWISE runs NAIVE on each block and adds block totals as a tree
+    for (size_t count : {size_t(100), block}) {
+        assert(sum(values.data(), count, Summation::PAIRWISE).raw() == laneOrderSum(values.data(), count));
+    }
+    const double twoBlocks = laneOrderSum(values.data(), block) + laneOrderSum(values.data() + block, block);
+    assert(sum(values.data(), 2 * block, Summation::PAIRWISE).raw() == twoBlocks);
+    const double threeBlocks = twoBlocks + laneOrderSum(values.data() + 2 * block, block);
+    assert(sum(values.data(), 3 * block, Summation::PAIRWISE).raw() == threeBlocks);
+    const double fourBlocks = twoBlocks + (laneOrderSum(values.data() + 2 * block, block) +
+                                           laneOrderSum(values.data() + 3 * block, block));
+    assert(sum(values.data(), 4 * block, Summation::PAIRWISE).raw() == fourBlocks);
+
+    // Same result from every call, whatever alignment the data has
+    std::vector<F64> shifted(values.size() + 1);
+    std::copy(values.begin(), values.end(), shifted.begin() + 1);
+    for (Summation mode : MODES) {
+        assert(sum(values.data(), values.size(), mode).raw() == sum(shifted.data() + 1, values.size(), mode).raw());
+        assert(sum(values, mode).raw() == sum(values, mode).raw());
+    }
+
+    std::cout << "  ✓ NAIVE and PAIRWISE follow the documented 16-lane order bit for bit\n";
+}
+
+void test_accuracy() {
+    std::cout << "\n🔹 Testing accuracy on well-conditioned data...\n";
+
+    const std::vector<F64> values = uniformDoubles(1 << 20, 0.0, 1.0, 1);
+    const long double exact = referenceSum(values);
+
+    double errors[3];
+    for (size_t m = 0; m < 3; ++m) {
+        errors[m] = relativeError(sum(values, MODES[m]).raw(), exact);
+        std::cout << "  " << modeName(MODES[m]) << ": relative error " << errors[m] << "\n";
+    }
+    const double epsilon = std::numeric_limits<double>::epsilon();
+    assert(errors[0] < 1e-12);
+    assert(errors[1] < 64 * epsilon);
+    assert(std::fabs(sum(values, Summation::COMPENSATED).raw() - exact) <= ulpOf(static_cast<double>(exact)));
+
+    // F32 follows the same pattern at its own precision
+    std::vector<F32> singles;
+    for (const F64& value : values) {
+        singles.push_back(F32(static_cast<float>(value.raw())));
+    }
+    long double singlesExact = 0;
+    for (const F32& value : singles) {
+        singlesExact += value.raw();
+    }
+    const float compensated = sum(singles, Summation::COMPENSATED).raw();
+    const float naive = sum(singles, Summation::NAIVE).raw();
+    assert(std::fabs(compensated - singlesExact) <= singlesExact * std::numeric_limits<float>::epsilon());
+    assert(relativeError(naive, singlesExact) < 1e-4);
+
+    std::cout << "  ✓ COMPENSATED is within 1 ulp; PAIRWISE within a few ulps\n";
+}
+
+void test_cancellation() {
+    std::cout << "\n🔹 Testing ill-conditioned sums...\n";
+
+    // Large values and their negatives hide 1000 ones; the exact sum is 1000
+    std::vector<F64> values = uniformDoubles(100000, 1e8, 1e12, 2);
+    const size_t large = values.size();
+    for (size_t i = 0; i < large; ++i) {
+        values.push_back(F64(-values[i].raw()));
+    }
+    for (int i = 0; i < 1000; ++i) {
+        values.push_back(F64(1.0));
+    }
+    std::shuffle(values.begin(), values.end(), std::mt19937_64(3));
+
+    for (Summation mode : MODES) {
+        std::cout << "  " << modeName(mode) << ": " << sum(values, mode).raw() << " (exact 1000)\n";
+    }
+    assert(sum(values, Summation::COMPENSATED).raw() == 1000.0);
+    assert(sum(values, Summation::NAIVE).raw() != 1000.0);
+
+    // A term larger than the running sum: plain Kahan loses the 1s here
+    const std::vector<F64> neumaier = {F64(1.0), F64(1e100), F64(1.0), F64(-1e100)};
+    assert(sum(neumaier, Summation::COMPENSATED).raw() == 2.0);
+
+    std::cout << "  ✓ COMPENSATED recovers the exact result\n";
+}
+
+void test_dot() {
+    std::cout << "\n🔹 Testing dot...\n";
+
+    const std::vector<F64> a = uniformDoubles(10007, -1.0, 1.0, 4);
+    const std::vector<F64> ones(a.size(), F64(1.0));
+    for (Summation mode : MODES) {
+        assert(dot(a, ones, mode).raw() == sum(a, mode).raw());
+        assert(dot(ones, a, mode).raw() == sum(a, mode).raw());
+    }
+
+    // x * y against x * -y(1 + 1e-15): the result is about 1e-15 of the
+    // terms, so each product's rounding error matters. The reference sums
+    // the exact products, split by fma into value and error
+    std::vector<F64> x = uniformDoubles(20000, 1.0, 2.0, 5);
+    std::vector<F64> y = uniformDoubles(20000, 1e6, 1e7, 6);
+    for (size_t i = 0; i < 20000; ++i) {
+        x.push_back(x[i]);
+        y.push_back(F64(-y[i].raw() * (1 + 1e-15)));
+    }
+    std::vector<F64> parts;
+    for (size_t i = 0; i < x.size(); ++i) {
+        const double product = x[i].raw() * y[i].raw();
+        parts.push_back(F64(product));
+        parts.push_back(x[i].fma(y[i], F64(-product)));
+    }
+    const long double exact = referenceSum(parts);
+    const double compensated = dot(x, y, Summation::COMPENSATED).raw();
+    const double naive = dot(x, y, Summation::NAIVE).raw();
+    std::cout << "  cancelling dot: NAIVE error " << relativeError(naive, exact) << ", COMPENSATED error "
+              << relativeError(compensated, exact) << "\n";
+    assert(relativeError(compensated, exact) < 1e-12);
+    assert(relativeError(compensated, exact) <= relativeError(naive, exact));
+
+    // F32 dot, and the vector overload's length check
+    const std::vector<F32> u = {F32(1.0f), F32(2.0f), F32(3.0f)};
+    const std::vector<F32> v = {F32(4.0f), F32(5.0f), F32(6.0f)};
+    for (Summation mode : MODES) {
+        assert(dot(u, v, mode).raw() == 32.0f);
+    }
+    bool threw = false;
+    try {
+        dot(u, std::vector<F32>(2));
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+
+    std::cout << "  ✓ dot matches sum, corrects product rounding, and checks lengths\n";
+}
+
+void test_norm() {
+    std::cout << "\n🔹 Testing norm...\n";
+
+    const double inf = std::numeric_limits<double>::infinity();
+    const double denormMin = std::numeric_limits<double>::denorm_min();
+    for (Summation mode : MODES) {
+        assert(norm(std::vector<F64>{F64(3.0), F64(4.0)}, mode).raw() == 5.0);
+        assert(norm(std::vector<F64>{F64(-3.0), F64(4.0)}, mode).raw() == 5.0);
+
+        // Squares overflow or underflow; the result does not
+        const double big = norm(std::vector<F64>{F64(3e200), F64(4e200)}, mode).raw();
+        assert(std::fabs(big - 5e200) <= 2 * ulpOf(5e200));
+        const double small = norm(std::vector<F64>{F64(3e-200), F64(4e-200)}, mode).raw();
+        assert(std::fabs(small - 5e-200) <= 2 * ulpOf(5e-200));
+        assert(norm(std::vector<F64>{F64(denormMin)}, mode).raw() == denormMin);
+        assert(norm(std::vector<F64>{F64(3 * denormMin), F64(4 * denormMin)}, mode).raw() == 5 * denormMin);
+
+        assert(norm(std::vector<F64>(10, F64(0.0)), mode).raw() == 0.0);
+        assert(norm(std::vector<F64>{F64(1.0), F64(-inf)}, mode).raw() == inf);
+        assert(norm(std::vector<F64>{F64(1.0), F64(std::nan(""))}, mode).is_nan());
+
+        const float bigSingle = norm(std::vector<F32>{F32(3e30f), F32(4e30f)}, mode).raw();
+        assert(std::fabs(bigSingle - 5e30f) <= 5e30f * 2 * std::numeric_limits<float>::epsilon());
+    }
+
+    const std::vector<F64> values = uniformDoubles(100000, -1.0, 1.0, 7);
+    long double squares = 0;
+    for (const F64& value : values) {
+        squares += static_cast<long double>(value.raw()) * value.raw();
+    }
+    const double compensated = norm(values, Summation::COMPENSATED).raw();
+    assert(std::fabs(compensated - std::sqrt(squares)) <= ulpOf(compensated));
+
+    std::cout << "  ✓ norm rescales around overflow and underflow\n";
+}
+
+void test_special_values() {
+    std::cout << "\n🔹 Testing empty inputs and non-finite values...\n";
+
+    const double inf = std::numeric_limits<double>::infinity();
+    for (Summation mode : MODES) {
+        assert(sum(std::vector<F64>{}, mode).raw() == 0.0);
+        assert(dot(std::vector<F64>{}, std::vector<F64>{}, mode).raw() == 0.0);
+        assert(norm(std::vector<F64>{}, mode).raw() == 0.0);
+        assert(sum(std::vector<F32>{}, mode).raw() == 0.0f);
+
+        std::vector<F64> values(100, F64(1.0));
+        values[37] = F64(inf);
+        assert(sum(values, mode).raw() == inf);
+        values[60] = F64(-inf);
+        assert(sum(values, mode).is_nan());
+        values[60] = F64(std::nan(""));
+        assert(sum(values, mode).is_nan());
+
+        // Finite terms whose total overflows
+        const std::vector<F64> huge(4, F64(std::numeric_limits<double>::max()));
+        assert(sum(huge, mode).raw() == inf);
+    }
+
+    std::cout << "  ✓ Empty inputs give zero; infinities and NaNs propagate\n";
+}
+
+static void benchmarkSize(const char* label, size_t count, int rounds) {
+    const std::vector<F64> a = uniformDoubles(count, 0.0, 1.0, 8);
+    const std::vector<F64> b = uniformDoubles(count, 0.0, 1.0, 9);
+    const long double exact = referenceSum(a);
+    std::cout << "  " << label << " (" << count << " doubles):\n";
+
+    // Serial F64 loop, one add chain. The sink keeps each round's result live
+    double sink = 0;
+    const double serialNanos = nanosPerValue(count, rounds, [&] {
+        F64 total(0.0);
+        for (const F64& value : a) {
+            total += value;
+        }
+        sink += total.raw();
+    });
+    std::cout << "    serial F64 +=    sum " << serialNanos << " ns/value (" << 8 / serialNanos << " GB/s), error "
+              << relativeError(sink / rounds, exact) << "\n";
+
+    for (Summation mode : MODES) {
+        double result = 0;
+        const double sumNanos = nanosPerValue(count, rounds, [&] { result = sum(a, mode).raw(); });
+        const double dotNanos = nanosPerValue(count, rounds, [&] { sink += dot(a, b, mode).raw(); });
+        const double normNanos = nanosPerValue(count, rounds, [&] { sink += norm(a, mode).raw(); });
+        std::cout << "    " << modeName(mode) << std::string(12 - std::string(modeName(mode)).size(), ' ')
+                  << "sum " << sumNanos << " ns/value (" << 8 / sumNanos << " GB/s), error "
+                  << relativeError(result, exact) << "; dot " << dotNanos << " (" << 16 / dotNanos
+                  << " GB/s); norm " << normNanos << "\n";
+    }
+    assert(std::isfinite(sink));
+}
+
+void benchmark_reductions() {
+    std::cout << "\n🔹 Benchmarking reductions...\n";
+    benchmarkSize("in cache", 1 << 15, 400);
+    benchmarkSize("from memory", 1 << 23, 4);
+}
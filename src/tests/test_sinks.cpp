@@ -0,0 +1,260 @@
+#include "../lib/diagnostic_sink.hpp"
+#include "../lib/error.hpp"
+#include "../lib/error_types.hpp"
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <sys/resource.h>
+
+using namespace holycpp;
+namespace fs = std::filesystem;
+
+// Test function prototypes
+void test_json_escaping();
+void test_json_lines();
+void test_sarif();
+void test_manager_streaming();
+void benchmark_million_diagnostics();
+
+int main() {
+    std::cout << "🧪 Running HolyC++ Diagnostic Sink Tests\n";
+    std::cout << "=========================================\n";
+
+    try {
+        test_json_escaping();
+        test_json_lines();
+        test_sarif();
+        test_manager_streaming();
+        benchmark_million_diagnostics();
+
+        std::cout << "\n✅ All diagnostic sink tests passed!\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ Test failed: " << e.what() << "\n";
+        return 1;
+    }
+}
+
+static size_t countLines(const std::string& text) {
+    size_t lines = 0;
+    for (char c : text) {
+        lines += c == '\n';
+    }
+    return lines;
+}
+
+void test_json_escaping() {
+    std::cout << "\n🔹 Testing JSON string escaping...\n";
+
+    std::string out;
+    appendJsonString(out, "plain");
+    assert(out == "\"plain\"");
+
+    out.clear();
+    appendJsonString(out, "say \"hi\"\\n\n\ttab");
+    assert(out == "\"say \\\"hi\\\"\\\\n\\n\\ttab\"");
+
+    out.clear();
+    appendJsonString(out, std::string_view("\x01\x1f", 2));
+    assert(out == "\"\\u0001\\u001f\"");
+
+    // UTF-8 passes through untouched
+    out.clear();
+    appendJsonString(out, "caf\xc3\xa9");
+    assert(out == "\"caf\xc3\xa9\"");
+
+    std::cout << "  ✓ Quotes, backslashes and control characters are escaped\n";
+}
+
+void test_json_lines() {
+    std::cout << "\n🔹 Testing JSON-lines output...\n";
+
+    std::ostringstream out;
+    JsonLinesSink sink(out);
+
+    ContextualError located(ErrorSeverity::ERROR, "Unterminated string literal",
+                            SourceLocation("program.hc", 10, 5), "L002");
+    located.pushContext("string started here");
+    sink.emit(located);
+    sink.emit(CompilerError(ErrorSeverity::WARNING, "No location"));
+
+    // Nothing reaches the stream until the buffer fills or finish() runs
+    assert(out.str().empty());
+    sink.finish();
+    assert(sink.emitted() == 2);
+
+    std::string text = out.str();
+    assert(countLines(text) == 2);
+    std::string first = text.substr(0, text.find('\n'));
+    assert(first == "{\"error\":{\"code\":\"L002\",\"severity\":\"ERROR\","
+                    "\"message\":\"Unterminated string literal\","
+                    "\"location\":{\"file\":\"program.hc\",\"line\":10,\"column\":5,\"length\":1},"
+                    "\"context\":[\"string started here\"]}}");
+    std::string second = text.substr(first.size() + 1);
+    assert(second == "{\"error\":{\"code\":\"\",\"severity\":\"WARNING\","
+                     "\"message\":\"No location\",\"context\":[]}}\n");
+
+    std::cout << "  ✓ One spec-shaped object per line\n";
+}
+
+void test_sarif() {
+    std::cout << "\n🔹 Testing SARIF output...\n";
+
+    {
+        std::ostringstream out;
+        SarifSink sink(out);
+        sink.finish();
+        sink.finish();   // Idempotent
+        assert(out.str().find("\"version\":\"2.1.0\"") != std::string::npos);
+        assert(out.str().find("\"results\":[\n]}]}") != std::string::npos);
+    }
+
+    std::ostringstream out;
+    SarifSink sink(out, "holyc-test");
+    auto typeError = ErrorCodeRegistry::get().createError("T001", SourceLocation("a.hc", 3, 7, 4), "x");
+    sink.emit(*typeError);
+    sink.emit(CompilerError(ErrorSeverity::FATAL, "Out of memory"));
+    sink.emit(CompilerError(ErrorSeverity::NOTE, "Note \"quoted\""));
+    sink.finish();
+
+    std::string text = out.str();
+    assert(text.find("\"name\":\"holyc-test\"") != std::string::npos);
+    assert(text.find("{\"ruleId\":\"T001\",\"level\":\"error\"") != std::string::npos);
+    assert(text.find("\"region\":{\"startLine\":3,\"startColumn\":7,\"endColumn\":11}") != std::string::npos);
+    assert(text.find("\n{\"level\":\"error\",\"message\":{\"text\":\"Out of memory\"}},") != std::string::npos);
+    assert(text.find("\"level\":\"note\",\"message\":{\"text\":\"Note \\\"quoted\\\"\"}}\n]}]}") != std::string::npos);
+
+    bool threw = false;
+    try {
+        sink.emit(CompilerError(ErrorSeverity::ERROR, "Too late"));
+    } catch (const std::logic_error&) {
+        threw = true;
+    }
+    assert(threw);
+
+    std::cout << "  ✓ Results stream into a single SARIF run\n";
+}
+
+void test_manager_streaming() {
+    std::cout << "\n🔹 Testing ErrorManager streaming...\n";
+
+    ErrorManager& manager = ErrorManager::get();
+    manager.clear();
+
+    std::ostringstream out;
+    JsonLinesSink sink(out);
+    manager.setSink(&sink);
+    manager.setRetainDiagnostics(false);
+
+    manager.error("Undefined identifier 'foo'", SourceLocation("m.hc", 1, 1));
+    manager.note("Declared here");
+    manager.setSuppressWarnings(true);
+    manager.warning("Suppressed, never emitted");
+    manager.setSuppressWarnings(false);
+    manager.setWarningsAsErrors(true);
+    manager.warning("Promoted");
+    manager.setWarningsAsErrors(false);
+
+    // Counts only: nothing was kept
+    assert(manager.getErrors().empty());
+    assert(manager.getErrorCount() == 2);
+    assert(manager.getNoteCount() == 1);
+    assert(manager.getWarningCount() == 0);
+
+    manager.setSink(nullptr);
+    manager.setRetainDiagnostics(true);
+    manager.error("Not streamed");
+    sink.finish();
+
+    std::string text = out.str();
+    assert(countLines(text) == 3);
+    assert(text.find("Suppressed") == std::string::npos);
+    assert(text.find("\"severity\":\"ERROR\",\"message\":\"Promoted\"") != std::string::npos);
+    assert(text.find("Not streamed") == std::string::npos);
+    assert(manager.getErrors().size() == 1);
+
+    std::stringstream dump;
+    manager.dumpAll(dump);
+    assert(dump.str().find("3 error(s), 0 warning(s), 1 note(s)") != std::string::npos);
+
+    manager.clear();
+    std::cout << "  ✓ Sinks see kept diagnostics; retention is optional\n";
+}
+
+static long peakRssKb() {
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+template<typename Sink>
+static double streamDiagnostics(const fs::path& path, int count, long& rssGrowthKb) {
+    ErrorManager& manager = ErrorManager::get();
+    manager.clear();
+    std::ofstream file(path, std::ios::binary);
+    Sink sink(file);
+    manager.setSink(&sink);
+    manager.setRetainDiagnostics(false);
+
+    long rssBefore = peakRssKb();
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < count; ++i) {
+        manager.error("Cannot convert 'F64' to 'U8' without a cast",
+                      SourceLocation("huge_build.hc", i + 1, 9, 3));
+    }
+    sink.finish();
+    auto end = std::chrono::high_resolution_clock::now();
+    rssGrowthKb = peakRssKb() - rssBefore;
+
+    manager.setSink(nullptr);
+    manager.setRetainDiagnostics(true);
+    assert(manager.getErrorCount() == count);
+    assert(sink.emitted() == static_cast<size_t>(count));
+    manager.clear();
+    return std::chrono::duration<double>(end - start).count();
+}
+
+void benchmark_million_diagnostics() {
+    std::cout << "\n🔹 Benchmarking 1M streamed diagnostics...\n";
+
+    const int count = 1000000;
+    ErrorManager& manager = ErrorManager::get();
+    manager.setMaxErrors(count + 1);
+    fs::path dir = fs::temp_directory_path();
+
+    long jsonGrowth = 0;
+    fs::path jsonPath = dir / "holyc_sink_bench.jsonl";
+    double jsonSeconds = streamDiagnostics<JsonLinesSink>(jsonPath, count, jsonGrowth);
+    double jsonMb = static_cast<double>(fs::file_size(jsonPath)) / (1024 * 1024);
+
+    long sarifGrowth = 0;
+    fs::path sarifPath = dir / "holyc_sink_bench.sarif";
+    double sarifSeconds = streamDiagnostics<SarifSink>(sarifPath, count, sarifGrowth);
+    double sarifMb = static_cast<double>(fs::file_size(sarifPath)) / (1024 * 1024);
+    fs::remove(jsonPath);
+    fs::remove(sarifPath);
+
+    // Baseline: keep every diagnostic until the end, as dumpAll() needs
+    long rssBefore = peakRssKb();
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < count; ++i) {
+        manager.error("Cannot convert 'F64' to 'U8' without a cast",
+                      SourceLocation("huge_build.hc", i + 1, 9, 3));
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    long retainedGrowth = peakRssKb() - rssBefore;
+    double retainedSeconds = std::chrono::duration<double>(end - start).count();
+    assert(manager.getErrors().size() == static_cast<size_t>(count));
+    manager.clear();
+    manager.setMaxErrors(100);
+
+    std::cout << "  JSON lines: " << jsonSeconds << " s (" << count / jsonSeconds / 1e6
+              << " M diag/s, " << jsonMb / jsonSeconds << " MB/s), peak RSS +" << jsonGrowth << " KB\n";
+    std::cout << "  SARIF:      " << sarifSeconds << " s (" << count / sarifSeconds / 1e6
+              << " M diag/s, " << sarifMb / sarifSeconds << " MB/s), peak RSS +" << sarifGrowth << " KB\n";
+    std::cout << "  Retained in memory: " << retainedSeconds << " s, peak RSS +"
+              << retainedGrowth << " KB\n";
+}
@@ -0,0 +1,221 @@
+#include "../types/sort.hpp"
+#include "../compiler/thread_pool.hpp"
+#include <iostream>
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace holycpp;
+
+// Test function prototypes
+void test_integer_order();
+void test_float_order();
+void test_parallel_sort();
+void benchmark_sort();
+
+int main() {
+    std::cout << "🧪 Running HolyC++ Sort Tests\n";
+    std::cout << "=============================\n";
+
+    try {
+        test_integer_order();
+        test_float_order();
+        test_parallel_sort();
+        benchmark_sort();
+
+        std::cout << "\n✅ All sort tests passed!\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ Test failed: " << e.what() << "\n";
+        return 1;
+    }
+}
+
+static const size_t SIZES[] = {0, 1, 2, 7, 1000, 1024, 5000, 100000};
+
+template<typename T>
+static std::vector<T> randomIntegers(size_t count, std::mt19937_64& rng) {
+    using Raw = typename T::storage_type;
+    std::vector<T> values;
+    values.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        Raw raw = static_cast<Raw>(rng());
+        if (i % 4 == 0) {
+            raw = static_cast<Raw>(raw % 100);   // Duplicates and small magnitudes
+        }
+        values.push_back(T(raw));
+    }
+    return values;
+}
+
+template<typename T>
+static bool sameBits(const std::vector<T>& a, const std::vector<T>& b) {
+    return a.size() == b.size() && (a.empty() || std::memcmp(a.data(), b.data(), a.size() * sizeof(T)) == 0);
+}
+
+template<typename T>
+static void checkIntegers(std::mt19937_64& rng) {
+    for (size_t count : SIZES) {
+        std::vector<T> values = randomIntegers<T>(count, rng);
+        if (count > 2) {
+            values[0] = T::MIN;
+            values[1] = T::MAX;
+        }
+        std::vector<T> expected = values;
+        std::sort(expected.begin(), expected.end());
+        holycpp::sort(values);
+        assert(sameBits(values, expected));
+    }
+}
+
+void test_integer_order() {
+    std::cout << "\n🔹 Testing integer order...\n";
+
+    std::mt19937_64 rng(1);
+    checkIntegers<U8>(rng);
+    checkIntegers<U16>(rng);
+    checkIntegers<U32>(rng);
+    checkIntegers<U64>(rng);
+    checkIntegers<I8>(rng);
+    checkIntegers<I16>(rng);
+    checkIntegers<I32>(rng);
+    checkIntegers<I64>(rng);
+
+    // Keys that share their high bytes skip those passes
+    std::vector<U64> narrow;
+    for (int i = 0; i < 5000; ++i) {
+        narrow.push_back(U64(static_cast<uint64_t>((i * 7919) % 5000)));
+    }
+    holycpp::sort(narrow);
+    for (int i = 0; i < 5000; ++i) {
+        assert(narrow[i] == static_cast<uint64_t>(i));
+    }
+
+    std::cout << "  ✓ U8..U64 and I8..I64 match std::sort\n";
+}
+
+template<typename T>
+static void checkFloats(std::mt19937_64& rng) {
+    using Raw = typename T::storage_type;
+    const Raw nan = std::numeric_limits<Raw>::quiet_NaN();
+    const Raw specials[] = {Raw(0.0), Raw(-0.0), std::numeric_limits<Raw>::infinity(),
+                            -std::numeric_limits<Raw>::infinity(), std::numeric_limits<Raw>::denorm_min(),
+                            -std::numeric_limits<Raw>::denorm_min(), std::numeric_limits<Raw>::max(),
+                            std::numeric_limits<Raw>::lowest(), nan, -nan};
+    std::uniform_real_distribution<Raw> wide(-1e6, 1e6);
+
+    for (size_t count : SIZES) {
+        std::vector<T> values;
+        for (size_t i = 0; i < count; ++i) {
+            values.push_back(T(i % 10 == 0 ? specials[(i / 10) % 10] : wide(rng)));
+        }
+
+        // NaNs last in their original order; -0.0 before +0.0
+        std::vector<T> expected, nans;
+        for (const T& value : values) {
+            (value.is_nan() ? nans : expected).push_back(value);
+        }
+        std::sort(expected.begin(), expected.end(), [](const T& a, const T& b) {
+            return a.raw() < b.raw() || (a.raw() == b.raw() && std::signbit(a.raw()) && !std::signbit(b.raw()));
+        });
+        expected.insert(expected.end(), nans.begin(), nans.end());
+
+        holycpp::sort(values);
+        assert(sameBits(values, expected));
+    }
+}
+
+void test_float_order() {
+    std::cout << "\n🔹 Testing float order, zeros and NaNs...\n";
+
+    std::mt19937_64 rng(2);
+    checkFloats<F32>(rng);
+    checkFloats<F64>(rng);
+
+    std::vector<F64> small = {F64(2.0), F64(std::nan("")), F64(-0.0), F64(-1.5), F64(0.0)};
+    holycpp::sort(small);
+    assert(small[0] == -1.5 && std::signbit(small[1].raw()) && !std::signbit(small[2].raw()));
+    assert(small[3] == 2.0 && small[4].is_nan());
+
+    std::cout << "  ✓ F32 and F64 in IEEE order, NaNs last with their bits kept\n";
+}
+
+void test_parallel_sort() {
+    std::cout << "\n🔹 Testing the parallel sort...\n";
+
+    WorkStealingPool pool(4);
+    std::mt19937_64 rng(3);
+    for (size_t count : {size_t(1000), sorting::PARALLEL_CUTOFF + 12345}) {
+        std::vector<I64> ints = randomIntegers<I64>(count, rng);
+        std::vector<I64> expectedInts = ints;
+        std::sort(expectedInts.begin(), expectedInts.end());
+        parallelSort(ints, pool);
+        assert(sameBits(ints, expectedInts));
+
+        std::vector<U32> words = randomIntegers<U32>(count, rng);
+        std::vector<U32> expectedWords = words;
+        std::sort(expectedWords.begin(), expectedWords.end());
+        parallelSort(words, pool);
+        assert(sameBits(words, expectedWords));
+
+        std::vector<F64> reals;
+        for (size_t i = 0; i < count; ++i) {
+            reals.push_back(F64(static_cast<double>(static_cast<int64_t>(rng())) / 1e9));
+        }
+        std::vector<F64> expectedReals = reals;
+        std::sort(expectedReals.begin(), expectedReals.end());
+        parallelSort(reals, pool);
+        assert(sameBits(reals, expectedReals));
+    }
+
+    std::cout << "  ✓ Matches std::sort on 4 pool threads\n";
+}
+
+template<typename T, typename Make, typename Sort>
+static double timeSorts(size_t count, int rounds, Make make, Sort sortFn) {
+    std::mt19937_64 rng(99);
+    std::vector<T> input;
+    input.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        input.push_back(make(rng));
+    }
+    double ms = 0;
+    std::vector<T> work;
+    for (int r = 0; r < rounds; ++r) {
+        work = input;
+        auto start = std::chrono::high_resolution_clock::now();
+        sortFn(work);
+        auto end = std::chrono::high_resolution_clock::now();
+        ms += std::chrono::duration<double, std::milli>(end - start).count();
+    }
+    assert(std::is_sorted(work.begin(), work.end()));
+    return ms / rounds;
+}
+
+template<typename T, typename Make>
+static void benchmarkType(const char* name, Make make, WorkStealingPool& pool) {
+    for (size_t count : {size_t(1000), size_t(100000), size_t(10000000)}) {
+        const int rounds = count <= 1000 ? 2000 : count <= 100000 ? 20 : 1;
+        double stdMs = timeSorts<T>(count, rounds, make, [](std::vector<T>& v) { std::sort(v.begin(), v.end()); });
+        double radixMs = timeSorts<T>(count, rounds, make, [](std::vector<T>& v) { holycpp::sort(v); });
+        double parallelMs = timeSorts<T>(count, rounds, make, [&](std::vector<T>& v) { parallelSort(v, pool); });
+        std::cout << "  " << name << " x " << count << ": std::sort " << stdMs << " ms, holycpp::sort " << radixMs
+                  << " ms (" << stdMs / radixMs << "x), parallelSort " << parallelMs << " ms\n";
+    }
+}
+
+void benchmark_sort() {
+    std::cout << "\n🔹 Benchmarking against std::sort...\n";
+
+    WorkStealingPool pool;
+    std::cout << "  (" << pool.threadCount() << " pool threads)\n";
+    benchmarkType<U32>("U32", [](std::mt19937_64& rng) { return U32(static_cast<uint32_t>(rng())); }, pool);
+    benchmarkType<I64>("I64", [](std::mt19937_64& rng) { return I64(static_cast<int64_t>(rng())); }, pool);
+    benchmarkType<F64>("F64", [](std::mt19937_64& rng) {
+        return F64(static_cast<double>(static_cast<int64_t>(rng())) * 1e-12);
+    }, pool);
+}
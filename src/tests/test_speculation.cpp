@@ -0,0 +1,274 @@
+#include "../lib/diagnostic_sink.hpp"
+#include "../lib/error.hpp"
+#include "../lib/error_types.hpp"
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+using namespace holycpp;
+
+// Test function prototypes
+void test_checkpoint_rollback();
+void test_nested_checkpoints();
+void test_arena_reuse();
+void test_deferred_streaming();
+void benchmark_backtracking_parse();
+
+int main() {
+    std::cout << "🧪 Running HolyC++ Speculative Diagnostics Tests\n";
+    std::cout << "=================================================\n";
+
+    try {
+        test_checkpoint_rollback();
+        test_nested_checkpoints();
+        test_arena_reuse();
+        test_deferred_streaming();
+        benchmark_backtracking_parse();
+
+        std::cout << "\n✅ All speculative diagnostics tests passed!\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ Test failed: " << e.what() << "\n";
+        return 1;
+    }
+}
+
+void test_checkpoint_rollback() {
+    std::cout << "\n🔹 Testing checkpoint and rollback...\n";
+
+    ErrorManager& manager = ErrorManager::get();
+    manager.clear();
+    manager.error("Before speculation");
+    manager.note("Also before");
+
+    auto mark = manager.checkpoint();
+    assert(manager.isSpeculating());
+    manager.emplace<TypeError>(TypeError::Code::TYPE_MISMATCH, SourceLocation("s.hc", 2, 1),
+                               DiagArg::literal("I64"), DiagArg::literal("U8"));
+    manager.warning("Speculative warning");
+    manager.fatal("Speculative fatal");
+    assert(manager.errorsSince(mark) == 2);
+    assert(manager.hasFatal());
+    assert(manager.getErrors().size() == 5);
+
+    manager.rollback(mark);
+    assert(!manager.isSpeculating());
+    assert(manager.getErrors().size() == 2);
+    assert(manager.getErrorCount() == 1);
+    assert(manager.getWarningCount() == 0);
+    assert(manager.getNoteCount() == 1);
+    assert(!manager.hasFatal());
+    assert(manager.getErrors().back()->getMessage() == "Also before");
+
+    // A committed attempt keeps its diagnostics
+    mark = manager.checkpoint();
+    manager.emplace<ParserError>(ParserError::Code::MISSING_SEMICOLON, SourceLocation("s.hc", 3, 9));
+    manager.commit(mark);
+    assert(manager.getErrors().size() == 3);
+    assert(manager.getErrors().back()->getErrorCode() == "P003");
+    assert(manager.getErrorCount() == 2);
+
+    manager.clear();
+    std::cout << "  ✓ Rollback restores stream and counters\n";
+}
+
+void test_nested_checkpoints() {
+    std::cout << "\n🔹 Testing nested checkpoints...\n";
+
+    ErrorManager& manager = ErrorManager::get();
+    manager.clear();
+
+    // Inner commit, outer rollback: everything goes
+    auto outer = manager.checkpoint();
+    manager.error("Outer attempt");
+    auto inner = manager.checkpoint();
+    manager.error("Inner attempt");
+    manager.commit(inner);
+    assert(manager.isSpeculating());
+    manager.rollback(outer);
+    assert(manager.getErrors().empty() && manager.getErrorCount() == 0);
+
+    // Inner rollback, outer commit: only the outer diagnostic stays
+    outer = manager.checkpoint();
+    manager.error("Outer kept");
+    inner = manager.checkpoint();
+    manager.error("Inner dropped");
+    manager.rollback(inner);
+    manager.commit(outer);
+    assert(manager.getErrors().size() == 1);
+    assert(manager.getErrors()[0]->getMessage() == "Outer kept");
+
+    // Closing out of order is a logic error
+    outer = manager.checkpoint();
+    inner = manager.checkpoint();
+    bool threw = false;
+    try {
+        manager.commit(outer);
+    } catch (const std::logic_error&) {
+        threw = true;
+    }
+    assert(threw);
+    manager.rollback(inner);
+    manager.rollback(outer);
+
+    // clear() abandons open checkpoints
+    outer = manager.checkpoint();
+    manager.clear();
+    assert(!manager.isSpeculating());
+    threw = false;
+    try {
+        manager.rollback(outer);
+    } catch (const std::logic_error&) {
+        threw = true;
+    }
+    assert(threw);
+
+    std::cout << "  ✓ Checkpoints nest and close innermost first\n";
+}
+
+void test_arena_reuse() {
+    std::cout << "\n🔹 Testing arena-backed speculative storage...\n";
+
+    ErrorManager& manager = ErrorManager::get();
+    manager.clear();
+
+    // Outside speculation diagnostics live on the heap
+    auto heap = manager.makeDiagnostic<TypeError>(TypeError::Code::MISSING_RETURN, SourceLocation());
+    assert(!heap.get_deleter().arenaOwned);
+
+    auto mark = manager.checkpoint();
+    auto speculative = manager.makeDiagnostic<TypeError>(TypeError::Code::MISSING_RETURN, SourceLocation());
+    assert(speculative.get_deleter().arenaOwned);
+    speculative.reset();
+    manager.rollback(mark);
+
+    // Repeated failed attempts reuse the same chunks
+    size_t reserved = 0;
+    for (int attempt = 0; attempt < 1000; ++attempt) {
+        mark = manager.checkpoint();
+        for (int i = 0; i < 50; ++i) {
+            manager.emplace<TypeError>(TypeError::Code::INVALID_CONVERSION, SourceLocation("a.hc", i + 1, 1),
+                                       DiagArg::integer(i), DiagArg::literal("U8"),
+                                       DiagArg::text("a message long enough to be owned text"));
+        }
+        manager.rollback(mark);
+        if (attempt == 0) {
+            reserved = manager.arenaBytes();
+            assert(reserved > 0);
+        }
+    }
+    assert(manager.arenaBytes() == reserved);
+    assert(manager.getErrors().empty());
+
+    // Committed arena diagnostics stay valid after speculation ends
+    mark = manager.checkpoint();
+    manager.emplace<LexerError>(LexerError::Code::INVALID_ESCAPE, SourceLocation("a.hc", 4, 2),
+                                DiagArg::text("\\q"));
+    manager.commit(mark);
+    manager.error("After speculation");
+    assert(manager.getErrors().size() == 2);
+    assert(manager.getErrors()[0]->getMessage() == "Invalid escape sequence: \\q");
+
+    manager.clear();
+    std::cout << "  ✓ Rolled-back diagnostics release their arena space in bulk\n";
+}
+
+// Collects what reaches a sink
+class RecordingSink : public DiagnosticSink {
+public:
+    std::vector<std::string> messages;
+    void emit(const CompilerError& error) override { messages.push_back(error.getMessage()); }
+};
+
+void test_deferred_streaming() {
+    std::cout << "\n🔹 Testing that speculation is invisible to sinks and limits...\n";
+
+    ErrorManager& manager = ErrorManager::get();
+    manager.clear();
+    RecordingSink sink;
+    manager.setSink(&sink);
+    manager.setRetainDiagnostics(false);
+    manager.setDeduplicate(true);
+
+    auto mark = manager.checkpoint();
+    manager.error("Failed alternative");
+    manager.rollback(mark);
+    assert(sink.messages.empty());
+
+    mark = manager.checkpoint();
+    manager.error("Chosen alternative");
+    manager.error("Chosen alternative");   // Duplicate, dropped at commit
+    assert(sink.messages.empty());
+    assert(manager.getErrorCount() == 2);
+    manager.commit(mark);
+
+    assert(sink.messages.size() == 1 && sink.messages[0] == "Chosen alternative");
+    assert(manager.getErrorCount() == 1);
+    assert(manager.getDuplicateCount() == 1);
+    assert(manager.getErrors().empty());   // Counts-only mode resumes after commit
+
+    // The rolled-back message was never fingerprinted
+    manager.error("Failed alternative");
+    assert(sink.messages.size() == 2);
+
+    manager.setSink(nullptr);
+    manager.setRetainDiagnostics(true);
+    manager.setDeduplicate(false);
+    manager.clear();
+    std::cout << "  ✓ Only committed diagnostics are streamed and deduplicated\n";
+}
+
+void benchmark_backtracking_parse() {
+    std::cout << "\n🔹 Benchmarking a backtracking parse...\n";
+
+    // Each statement tries declaration, call and cast forms before falling
+    // back to a plain expression; every failed form reports two diagnostics
+    const int statements = 100000;
+    const int failedForms = 3;
+    const std::string name = "value";
+    ErrorManager& manager = ErrorManager::get();
+    manager.clear();
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int s = 0; s < statements; ++s) {
+        SourceLocation loc("parse.hc", s + 1, 1);
+        for (int form = 0; form < failedForms; ++form) {
+            auto mark = manager.checkpoint();
+            manager.emplace<ParserError>(ParserError::Code::UNEXPECTED_TOKEN, loc,
+                                         DiagArg::name(&name), DiagArg::literal("';'"));
+            manager.emplace<TypeError>(TypeError::Code::INVALID_OPERAND_TYPES, loc,
+                                       DiagArg::literal("I64"), DiagArg::literal("U0"));
+            manager.rollback(mark);
+        }
+        auto mark = manager.checkpoint();
+        manager.commit(mark);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    double transactionMs = std::chrono::duration<double, std::milli>(end - start).count();
+    assert(manager.getErrors().empty() && manager.getErrorCount() == 0);
+    size_t arenaBytes = manager.arenaBytes();
+
+    // Baseline: collect each attempt's diagnostics in a local heap vector
+    size_t discarded = 0;
+    start = std::chrono::high_resolution_clock::now();
+    for (int s = 0; s < statements; ++s) {
+        SourceLocation loc("parse.hc", s + 1, 1);
+        for (int form = 0; form < failedForms; ++form) {
+            std::vector<std::unique_ptr<CompilerError>> attempt;
+            attempt.push_back(std::make_unique<ParserError>(ParserError::Code::UNEXPECTED_TOKEN, loc,
+                                                            DiagArg::name(&name), DiagArg::literal("';'")));
+            attempt.push_back(std::make_unique<TypeError>(TypeError::Code::INVALID_OPERAND_TYPES, loc,
+                                                          DiagArg::literal("I64"), DiagArg::literal("U0")));
+            discarded += attempt.size();
+        }
+    }
+    end = std::chrono::high_resolution_clock::now();
+    double vectorMs = std::chrono::duration<double, std::milli>(end - start).count();
+    assert(discarded == static_cast<size_t>(statements * failedForms * 2));
+
+    std::cout << "  " << statements * failedForms << " failed attempts: checkpoint/rollback "
+              << transactionMs << " ms (arena " << arenaBytes << " bytes), per-attempt heap vector "
+              << vectorMs << " ms\n";
+}
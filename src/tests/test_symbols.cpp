@@ -0,0 +1,331 @@
+#include "../compiler/symbol_table.hpp"
+#include "../types/type_table.hpp"
+#include "../lib/error.hpp"
+#include "../lib/error_types.hpp"
+#include <iostream>
+#include <sstream>
+#include <cassert>
+#include <chrono>
+#include <unordered_map>
+
+using namespace holycpp;
+
+// Test function prototypes
+void test_interner();
+void test_scopes_and_shadowing();
+void test_symbol_diagnostics();
+void test_table_growth();
+void benchmark_nested_scopes();
+void benchmark_many_globals();
+
+int main() {
+    std::cout << "🧪 Running HolyC++ Symbol Table Tests\n";
+    std::cout << "======================================\n";
+
+    try {
+        test_interner();
+        test_scopes_and_shadowing();
+        test_symbol_diagnostics();
+        test_table_growth();
+        benchmark_nested_scopes();
+        benchmark_many_globals();
+
+        std::cout << "\n✅ All symbol table tests passed!\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ Test failed: " << e.what() << "\n";
+        return 1;
+    }
+}
+
+void test_interner() {
+    std::cout << "\n🔹 Testing identifier interning...\n";
+
+    StringInterner interner;
+    const std::string* a = interner.intern("counter");
+    std::string spelled = "count";
+    spelled += "er";
+    assert(interner.intern(spelled) == a);
+    assert(*a == "counter");
+    assert(interner.intern("Counter") != a);
+    assert(interner.find("counter") == a);
+    assert(interner.find("missing") == nullptr);
+
+    // Pointers stay valid as the interner grows
+    for (int i = 0; i < 10000; ++i) {
+        interner.intern("id" + std::to_string(i));
+    }
+    assert(interner.intern("counter") == a && *a == "counter");
+    assert(interner.size() == 10002);
+
+    std::cout << "  ✓ Equal spellings share one pointer\n";
+}
+
+void test_scopes_and_shadowing() {
+    std::cout << "\n🔹 Testing scopes and shadowing...\n";
+
+    StringInterner interner;
+    SymbolTable table(interner);
+    const std::string* x = interner.intern("x");
+    const std::string* y = interner.intern("y");
+
+    const Symbol* globalX = table.declare(x, SymbolKind::VARIABLE, BuiltinTypes::I64);
+    assert(globalX && globalX->depth == 0);
+    assert(table.lookup(x) == globalX);
+    assert(table.lookup(y) == nullptr);
+
+    table.enterScope();
+    assert(table.depth() == 1);
+    assert(table.lookup(x) == globalX);          // Visible from inside
+    assert(!table.declaredInCurrentScope(x));
+
+    const Symbol* innerX = table.declare(x, SymbolKind::PARAMETER, BuiltinTypes::U8);
+    assert(innerX && innerX != globalX);
+    assert(table.lookup("x") == innerX);        // Shadows the global
+    table.declare(y, SymbolKind::VARIABLE, BuiltinTypes::F64);
+
+    table.enterScope();
+    const Symbol* innermostX = table.declare(x, SymbolKind::VARIABLE, BuiltinTypes::I8);
+    assert(table.lookup(x) == innermostX);
+    assert(table.lookup(y)->type == BuiltinTypes::F64);
+    table.leaveScope();
+
+    assert(table.lookup(x) == innerX);
+    assert(table.lookup(x)->type == BuiltinTypes::U8);
+    table.leaveScope();
+
+    assert(table.lookup(x) == globalX);
+    assert(table.lookup(y) == nullptr);
+    assert(table.symbolCount() == 1);
+    assert(table.depth() == 0);
+
+    bool threw = false;
+    try {
+        table.leaveScope();
+    } catch (const std::logic_error&) {
+        threw = true;
+    }
+    assert(threw);
+
+    // Symbol pointers survive later declarations
+    for (int i = 0; i < 5000; ++i) {
+        table.declare("g" + std::to_string(i), SymbolKind::VARIABLE, BuiltinTypes::I32);
+    }
+    assert(globalX->name == x && table.lookup(x) == globalX);
+    assert(table.diagnostics.empty());
+
+    std::cout << "  ✓ Leaving a scope restores shadowed bindings\n";
+}
+
+void test_symbol_diagnostics() {
+    std::cout << "\n🔹 Testing declaration diagnostics...\n";
+
+    StringInterner interner;
+    SymbolTable table(interner);
+
+    assert(table.declare("value", SymbolKind::VARIABLE, BuiltinTypes::I64, SourceLocation("a.hc", 1, 5)));
+    assert(!table.declare("value", SymbolKind::VARIABLE, BuiltinTypes::I64, SourceLocation("a.hc", 2, 5)));
+    assert(table.diagnostics.size() == 1);
+    assert(table.diagnostics[0]->getErrorCode() == "T003");
+    assert(table.diagnostics[0]->getMessage().find("value") != std::string::npos);
+    assert(table.diagnostics[0]->format().find("Previous declaration at a.hc:1:5") != std::string::npos);
+    assert(table.lookup("value")->location.line == 1);   // First declaration wins
+
+    assert(table.declare("Main", SymbolKind::FUNCTION, BuiltinTypes::U0));
+    assert(!table.declare("Main", SymbolKind::FUNCTION, BuiltinTypes::U0));
+    assert(table.diagnostics[1]->getErrorCode() == "P009");
+
+    // Redeclaring in an inner scope is shadowing, not an error
+    table.enterScope();
+    assert(table.declare("value", SymbolKind::VARIABLE, BuiltinTypes::U8));
+    assert(table.resolve(interner.intern("nothing"), SourceLocation("a.hc", 9, 1)) == nullptr);
+    table.leaveScope();
+
+    assert(table.diagnostics.size() == 3);
+    assert(table.diagnostics[2]->getErrorCode() == "T002");
+    assert(table.diagnostics[2]->getMessage().find("nothing") != std::string::npos);
+    assert(table.diagnostics[2]->getLocation().line == 9);
+
+    // Diagnostics outlive the interner and table that produced them
+    ErrorManager& manager = ErrorManager::get();
+    manager.clear();
+    {
+        StringInterner scoped;
+        SymbolTable inner(scoped);
+        inner.enterScope();
+        assert(inner.resolve(scoped.intern("ghost"), SourceLocation("b.hc", 4, 2)) == nullptr);
+        for (auto& diag : inner.diagnostics) {
+            manager.report(std::move(diag));
+        }
+    }
+    std::stringstream dump;
+    manager.dumpAll(dump);
+    assert(dump.str().find("ghost") != std::string::npos);
+    manager.clear();
+
+    std::cout << "  ✓ T003, P009 and T002 are reported\n";
+}
+
+void test_table_growth() {
+    std::cout << "\n🔹 Testing growth and unwinding at scale...\n";
+
+    StringInterner interner;
+    SymbolTable table(interner);
+    std::vector<const std::string*> names;
+    for (int i = 0; i < 20000; ++i) {
+        names.push_back(interner.intern("v" + std::to_string(i)));
+    }
+
+    for (int round = 0; round < 3; ++round) {
+        table.enterScope();
+        for (const std::string* name : names) {
+            assert(table.declare(name, SymbolKind::VARIABLE, static_cast<TypeId>(round)));
+        }
+        for (const std::string* name : names) {
+            assert(table.lookup(name)->type == static_cast<TypeId>(round));
+        }
+    }
+    for (int round = 2; round >= 0; --round) {
+        assert(table.lookup(names[123])->type == static_cast<TypeId>(round));
+        table.leaveScope();
+    }
+    for (const std::string* name : names) {
+        assert(table.lookup(name) == nullptr);
+    }
+    assert(table.symbolCount() == 0);
+
+    std::cout << "  ✓ Thousands of names grow and unwind cleanly\n";
+}
+
+// Baseline: a stack of per-scope maps searched innermost-first
+class MapStackScopes {
+public:
+    MapStackScopes() : scopes(1) {}
+    void enterScope() { scopes.emplace_back(); }
+    void leaveScope() { scopes.pop_back(); }
+    void declare(const std::string& name, TypeId type) { scopes.back()[name] = type; }
+    TypeId lookup(const std::string& name) const {
+        for (auto it = scopes.rbegin(); it != scopes.rend(); ++it) {
+            auto found = it->find(name);
+            if (found != it->end()) {
+                return found->second;
+            }
+        }
+        return INVALID_TYPE;
+    }
+
+private:
+    std::vector<std::unordered_map<std::string, TypeId>> scopes;
+};
+
+void benchmark_nested_scopes() {
+    std::cout << "\n🔹 Benchmarking deeply nested code...\n";
+
+    // 2000 nested blocks, 4 locals each, every block reads two globals and
+    // its parent's locals
+    const int depth = 2000;
+    const int repeats = 20;
+    StringInterner interner;
+    std::vector<std::string> spellings;
+    std::vector<const std::string*> locals;
+    for (int i = 0; i < 4; ++i) {
+        spellings.push_back("local" + std::to_string(i));
+        locals.push_back(interner.intern(spellings.back()));
+    }
+    const std::string* g0 = interner.intern("g0");
+    const std::string* g1 = interner.intern("g1");
+
+    uint64_t found = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int r = 0; r < repeats; ++r) {
+        SymbolTable table(interner);
+        table.declare(g0, SymbolKind::VARIABLE, BuiltinTypes::I64);
+        table.declare(g1, SymbolKind::VARIABLE, BuiltinTypes::I64);
+        for (int d = 0; d < depth; ++d) {
+            for (const std::string* name : locals) {
+                found += table.lookup(name) != nullptr;
+            }
+            table.enterScope();
+            for (const std::string* name : locals) {
+                table.declare(name, SymbolKind::VARIABLE, BuiltinTypes::I32);
+            }
+            found += table.lookup(g0) != nullptr;
+            found += table.lookup(g1) != nullptr;
+        }
+        for (int d = 0; d < depth; ++d) {
+            table.leaveScope();
+        }
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    double tableMs = std::chrono::duration<double, std::milli>(end - start).count();
+
+    uint64_t baselineFound = 0;
+    start = std::chrono::high_resolution_clock::now();
+    for (int r = 0; r < repeats; ++r) {
+        MapStackScopes scopes;
+        scopes.declare("g0", BuiltinTypes::I64);
+        scopes.declare("g1", BuiltinTypes::I64);
+        for (int d = 0; d < depth; ++d) {
+            for (const std::string& name : spellings) {
+                baselineFound += scopes.lookup(name) != INVALID_TYPE;
+            }
+            scopes.enterScope();
+            for (const std::string& name : spellings) {
+                scopes.declare(name, BuiltinTypes::I32);
+            }
+            baselineFound += scopes.lookup("g0") != INVALID_TYPE;
+            baselineFound += scopes.lookup("g1") != INVALID_TYPE;
+        }
+    }
+    end = std::chrono::high_resolution_clock::now();
+    double baselineMs = std::chrono::duration<double, std::milli>(end - start).count();
+
+    assert(found == baselineFound);
+    std::cout << "  Depth " << depth << " x " << repeats << ": symbol table " << tableMs
+              << " ms, map-per-scope " << baselineMs << " ms\n";
+}
+
+void benchmark_many_globals() {
+    std::cout << "\n🔹 Benchmarking 100k globals...\n";
+
+    const int globals = 100000;
+    StringInterner interner;
+    std::vector<std::string> spellings;
+    std::vector<const std::string*> names;
+    for (int i = 0; i < globals; ++i) {
+        spellings.push_back("global_" + std::to_string(i * 7919));
+        names.push_back(interner.intern(spellings.back()));
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+    SymbolTable table(interner);
+    for (const std::string* name : names) {
+        table.declare(name, SymbolKind::VARIABLE, BuiltinTypes::I64);
+    }
+    uint64_t hits = 0;
+    for (int pass = 0; pass < 10; ++pass) {
+        for (size_t i = 0; i < names.size(); i += 3) {
+            hits += table.lookup(names[(i * 31) % names.size()]) != nullptr;
+        }
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    double tableMs = std::chrono::duration<double, std::milli>(end - start).count();
+
+    start = std::chrono::high_resolution_clock::now();
+    std::unordered_map<std::string, TypeId> map;
+    for (const std::string& name : spellings) {
+        map[name] = BuiltinTypes::I64;
+    }
+    uint64_t mapHits = 0;
+    for (int pass = 0; pass < 10; ++pass) {
+        for (size_t i = 0; i < spellings.size(); i += 3) {
+            mapHits += map.count(spellings[(i * 31) % spellings.size()]);
+        }
+    }
+    end = std::chrono::high_resolution_clock::now();
+    double mapMs = std::chrono::duration<double, std::milli>(end - start).count();
+
+    assert(hits == mapHits && hits > 0);
+    std::cout << "  " << globals << " globals: symbol table " << tableMs
+              << " ms, std::unordered_map<std::string> " << mapMs << " ms\n";
+}
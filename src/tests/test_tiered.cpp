@@ -0,0 +1,344 @@
+#include "../runtime/bytecode.hpp"
+#include "../runtime/tiered.hpp"
+#include "../lib/error.hpp"
+#include "../lib/error_types.hpp"
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+
+using namespace holycpp;
+
+// Test function prototypes
+void test_bytecode_verification();
+void test_interpreter();
+void test_tier_up_on_calls();
+void test_tier_up_on_back_edges();
+void test_tiers_agree();
+void test_backend_failure_fallback();
+void benchmark_tiers();
+
+int main() {
+    std::cout << "🧪 Running HolyC++ Tiered Execution Tests\n";
+    std::cout << "==========================================\n";
+
+    try {
+        test_bytecode_verification();
+        test_interpreter();
+        test_tier_up_on_calls();
+        test_tier_up_on_back_edges();
+        test_tiers_agree();
+        test_backend_failure_fallback();
+        benchmark_tiers();
+
+        std::cout << "\n✅ All tiered execution tests passed!\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ Test failed: " << e.what() << "\n";
+        return 1;
+    }
+}
+
+// I64 SumTo(I64 n) { I64 s = 0; for (I64 i = 0; i < n; i++) s += i; return s; }
+Function makeSumTo() {
+    Function fn;
+    fn.name = "SumTo";
+    fn.numParams = 1;
+    fn.numRegs = 5;
+    fn.location = SourceLocation("sum.hc", 1, 1);
+    int zero = fn.addConstant(Reg::ofInt(0));
+    int one = fn.addConstant(Reg::ofInt(1));
+    fn.emit(OpCode::LOAD_CONST, 1, 0, 0, zero)      // 0: s = 0
+      .emit(OpCode::LOAD_CONST, 2, 0, 0, zero)      // 1: i = 0
+      .emit(OpCode::LOAD_CONST, 3, 0, 0, one)       // 2: k = 1
+      .emit(OpCode::LT_I64, 4, 2, 0)                // 3: c = i < n
+      .emit(OpCode::JUMP_IF_NOT, 0, 4, 0, 8)        // 4: if !c goto 8
+      .emit(OpCode::ADD_I64, 1, 1, 2)               // 5: s += i
+      .emit(OpCode::ADD_I64, 2, 2, 3)               // 6: i += 1
+      .emit(OpCode::JUMP, 0, 0, 0, 3)               // 7: goto 3
+      .emit(OpCode::RETURN, 0, 1);                  // 8: return s
+    return fn;
+}
+
+// F64 Poly(F64 x, I64 n) { F64 acc = 0; for (I64 i = 0; i < n; i++) acc = acc * x + 1.5; return acc; }
+Function makePoly() {
+    Function fn;
+    fn.name = "Poly";
+    fn.numParams = 2;
+    fn.numRegs = 7;
+    int fzero = fn.addConstant(Reg::ofFloat(0.0));
+    int izero = fn.addConstant(Reg::ofInt(0));
+    int one = fn.addConstant(Reg::ofInt(1));
+    int coeff = fn.addConstant(Reg::ofFloat(1.5));
+    fn.emit(OpCode::LOAD_CONST, 2, 0, 0, fzero)     // 0: acc = 0.0
+      .emit(OpCode::LOAD_CONST, 3, 0, 0, izero)     // 1: i = 0
+      .emit(OpCode::LOAD_CONST, 4, 0, 0, one)       // 2: k = 1
+      .emit(OpCode::LOAD_CONST, 5, 0, 0, coeff)     // 3: c = 1.5
+      .emit(OpCode::LT_I64, 6, 3, 1)                // 4: t = i < n
+      .emit(OpCode::JUMP_IF_NOT, 0, 6, 0, 10)       // 5
+      .emit(OpCode::MUL_F64, 2, 2, 0)               // 6: acc *= x
+      .emit(OpCode::ADD_F64, 2, 2, 5)               // 7: acc += c
+      .emit(OpCode::ADD_I64, 3, 3, 4)               // 8: i++
+      .emit(OpCode::JUMP, 0, 0, 0, 4)               // 9
+      .emit(OpCode::RETURN, 0, 2);                  // 10
+    return fn;
+}
+
+// I64 Div(I64 a, I64 b) { return a / b; }
+Function makeDiv() {
+    Function fn;
+    fn.name = "Div";
+    fn.numParams = 2;
+    fn.numRegs = 3;
+    fn.emit(OpCode::DIV_I64, 2, 0, 1)
+      .emit(OpCode::RETURN, 0, 2);
+    return fn;
+}
+
+void test_bytecode_verification() {
+    std::cout << "\n🔹 Testing bytecode verification...\n";
+
+    std::string reason;
+    assert(verifyFunction(makeSumTo(), reason));
+    assert(verifyFunction(makePoly(), reason));
+
+    // Jump past the end
+    Function badJump = makeSumTo();
+    badJump.code[7].imm = 42;
+    assert(!verifyFunction(badJump, reason));
+    assert(reason.find("jump target") != std::string::npos);
+
+    // Register out of range
+    Function badReg = makeDiv();
+    badReg.code[0].b = 9;
+    assert(!verifyFunction(badReg, reason));
+
+    // Falls off the end
+    Function noReturn = makeDiv();
+    noReturn.code.pop_back();
+    assert(!verifyFunction(noReturn, reason));
+
+    // Engine rejects unverifiable bytecode up front
+    TieredEngine engine;
+    bool threw = false;
+    try {
+        engine.addFunction(badJump);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+
+    assert(disassemble(makeDiv()).find("DIV_I64 r2, r0, r1") != std::string::npos);
+
+    std::cout << "  ✓ Verification catches malformed bytecode\n";
+}
+
+void test_interpreter() {
+    std::cout << "\n🔹 Testing baseline interpreter...\n";
+
+    Function sum = makeSumTo();
+    Reg n = Reg::ofInt(100);
+    uint64_t edges = 0;
+    assert(Interpreter::run(sum, &n, 1, &edges).i == 4950);
+    assert(edges == 100);  // One back-edge per loop iteration
+
+    // I64 wraps like HolyC instead of invoking UB
+    Function wrap;
+    wrap.name = "Wrap";
+    wrap.numRegs = 2;
+    int big = wrap.addConstant(Reg::ofInt(INT64_MAX));
+    int one = wrap.addConstant(Reg::ofInt(1));
+    wrap.emit(OpCode::LOAD_CONST, 0, 0, 0, big)
+        .emit(OpCode::LOAD_CONST, 1, 0, 0, one)
+        .emit(OpCode::ADD_I64, 0, 0, 1)
+        .emit(OpCode::RETURN, 0, 0);
+    assert(Interpreter::run(wrap, nullptr, 0).i == INT64_MIN);
+
+    // Division by zero raises the same error as I64::operator/
+    Reg args[2] = {Reg::ofInt(1), Reg::ofInt(0)};
+    bool threw = false;
+    try {
+        Interpreter::run(makeDiv(), args, 2);
+    } catch (const std::domain_error&) {
+        threw = true;
+    }
+    assert(threw);
+
+    std::cout << "  ✓ Interpreter executes I64/F64 bytecode\n";
+}
+
+void test_tier_up_on_calls() {
+    std::cout << "\n🔹 Testing tier-up by call count...\n";
+
+    TierPolicy policy;
+    policy.callThreshold = 5;
+    policy.backEdgeThreshold = 1000000;
+    TieredEngine engine(std::make_unique<ThreadedBackend>(), policy);
+    size_t id = engine.addFunction(makeDiv());
+
+    for (int i = 0; i < 4; ++i) {
+        assert(engine.call(id, {Reg::ofInt(84), Reg::ofInt(2)}).i == 42);
+        assert(engine.profile(id).tier == Tier::INTERPRETED);
+    }
+    assert(engine.call(id, {Reg::ofInt(84), Reg::ofInt(2)}).i == 42);
+    assert(engine.profile(id).tier == Tier::COMPILED);
+    assert(engine.profile(id).calls == 5);
+
+    // Compiled code raises the same HolyC errors
+    bool threw = false;
+    try {
+        engine.call(id, {Reg::ofInt(1), Reg::ofInt(0)});
+    } catch (const std::domain_error&) {
+        threw = true;
+    }
+    assert(threw);
+
+    std::cout << "  ✓ Hot functions are promoted after the call threshold\n";
+}
+
+void test_tier_up_on_back_edges() {
+    std::cout << "\n🔹 Testing tier-up by loop back-edges...\n";
+
+    TierPolicy policy;
+    policy.callThreshold = 1000000;
+    policy.backEdgeThreshold = 500;
+    TieredEngine engine(std::make_unique<ThreadedBackend>(), policy);
+    size_t id = engine.addFunction(makeSumTo());
+
+    // One long-running call crosses the threshold...
+    assert(engine.call(id, {Reg::ofInt(1000)}).i == 499500);
+    assert(engine.profile(id).backEdges == 1000);
+    assert(engine.profile(id).tier == Tier::INTERPRETED);
+
+    // ...and the next call runs compiled
+    assert(engine.call(id, {Reg::ofInt(10)}).i == 45);
+    assert(engine.profile(id).tier == Tier::COMPILED);
+
+    std::cout << "  ✓ Loop-heavy functions are promoted on back-edges\n";
+    std::cout << "  Compile latency: " << engine.profile(id).compileNanos << " ns\n";
+}
+
+void test_tiers_agree() {
+    std::cout << "\n🔹 Testing interpreter and compiled tiers agree...\n";
+
+    TieredEngine engine;
+    size_t sum = engine.addFunction(makeSumTo());
+    size_t poly = engine.addFunction(makePoly());
+
+    for (int64_t n : {0, 1, 7, 1000}) {
+        Reg arg = Reg::ofInt(n);
+        int64_t expected = Interpreter::run(engine.function(sum), &arg, 1).i;
+        assert(engine.compileNow(sum));
+        assert(engine.call(sum, &arg, 1).i == expected);
+    }
+
+    assert(engine.compileNow(poly));
+    for (double x : {0.5, -1.25, 1.0}) {
+        Reg args[2] = {Reg::ofFloat(x), Reg::ofInt(20)};
+        double interp = Interpreter::run(engine.function(poly), args, 2).f;
+        double compiled = engine.call(poly, args, 2).f;
+        // Bit-for-bit identical, not just close
+        assert(std::memcmp(&interp, &compiled, sizeof(double)) == 0);
+    }
+
+    std::cout << "  ✓ Both tiers produce identical results\n";
+}
+
+// Backend that always fails, to exercise the fallback path
+class BrokenBackend : public JitBackend {
+public:
+    const char* name() const override { return "broken"; }
+    CompileResult compile(const Function&) override {
+        CompileResult result;
+        result.failure = CodeGenError::Code::INVALID_IR;
+        result.detail = "simulated verifier failure";
+        return result;
+    }
+};
+
+class UnavailableBackend : public JitBackend {
+public:
+    const char* name() const override { return "unavailable"; }
+    bool initialize(std::string& reason) override {
+        reason = "no native target registered";
+        return false;
+    }
+    CompileResult compile(const Function&) override {
+        assert(false && "compile must not run when initialize fails");
+        return {};
+    }
+};
+
+void test_backend_failure_fallback() {
+    std::cout << "\n🔹 Testing backend failure fallback...\n";
+
+    ErrorManager::get().clear();
+
+    TierPolicy policy;
+    policy.callThreshold = 2;
+    TieredEngine engine(std::make_unique<BrokenBackend>(), policy);
+    size_t id = engine.addFunction(makeSumTo());
+
+    for (int i = 0; i < 10; ++i) {
+        assert(engine.call(id, {Reg::ofInt(10)}).i == 45);
+    }
+    assert(engine.profile(id).tier == Tier::FAILED);
+
+    // Reported once, as a C006 warning naming the backend's reason
+    assert(ErrorManager::get().getWarningCount() == 1);
+    assert(!ErrorManager::get().hasErrors());
+    const auto& reported = *ErrorManager::get().getErrors().back();
+    assert(reported.getErrorCode() == "C006");
+    assert(reported.getMessage().find("SumTo") != std::string::npos);
+    assert(reported.getMessage().find("Invalid IR generated") != std::string::npos);
+    assert(reported.getLocation().filename == "sum.hc");
+
+    // A backend that cannot initialize disables tier-up entirely
+    ErrorManager::get().clear();
+    TieredEngine noJit(std::make_unique<UnavailableBackend>(), policy);
+    size_t a = noJit.addFunction(makeDiv());
+    size_t b = noJit.addFunction(makeSumTo());
+    for (int i = 0; i < 5; ++i) {
+        assert(noJit.call(a, {Reg::ofInt(9), Reg::ofInt(3)}).i == 3);
+        assert(noJit.call(b, {Reg::ofInt(4)}).i == 6);
+    }
+    assert(noJit.profile(a).tier == Tier::FAILED);
+    assert(noJit.profile(b).tier == Tier::FAILED);
+    assert(ErrorManager::get().getWarningCount() == 1);
+    assert(ErrorManager::get().getErrors().back()->getMessage().find("LLVM initialization failed") != std::string::npos);
+    ErrorManager::get().clear();
+
+    std::cout << "  ✓ Failed tier-up falls back to the interpreter\n";
+}
+
+void benchmark_tiers() {
+    std::cout << "\n🔹 Benchmarking interpreter vs compiled tier...\n";
+
+    TieredEngine engine;
+    size_t sum = engine.addFunction(makeSumTo());
+    size_t poly = engine.addFunction(makePoly());
+
+    auto time = [](auto&& body) {
+        auto start = std::chrono::steady_clock::now();
+        body();
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    Reg n = Reg::ofInt(2000000);
+    int64_t interpSum = 0, compiledSum = 0;
+    double interpMs = time([&] { interpSum = Interpreter::run(engine.function(sum), &n, 1).i; });
+    engine.compileNow(sum);
+    double compiledMs = time([&] { compiledSum = engine.call(sum, &n, 1).i; });
+    assert(interpSum == compiledSum);
+    std::cout << "  I64 loop: interpreter " << interpMs << " ms, compiled " << compiledMs << " ms\n";
+
+    Reg args[2] = {Reg::ofFloat(0.999), Reg::ofInt(2000000)};
+    double interpPoly = 0, compiledPoly = 0;
+    interpMs = time([&] { interpPoly = Interpreter::run(engine.function(poly), args, 2).f; });
+    engine.compileNow(poly);
+    compiledMs = time([&] { compiledPoly = engine.call(poly, args, 2).f; });
+    assert(interpPoly == compiledPoly);
+    std::cout << "  F64 loop: interpreter " << interpMs << " ms, compiled " << compiledMs << " ms\n";
+    std::cout << "  Compile latency: " << engine.profile(poly).compileNanos << " ns\n";
+}
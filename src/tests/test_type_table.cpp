@@ -0,0 +1,337 @@
+#include "../types/type_table.hpp"
+#include "../types/unsigned_int.hpp"
+#include "../types/signed_int.hpp"
+#include "../types/float.hpp"
+#include "../types/union_type.hpp"
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <stdexcept>
+
+using namespace holycpp;
+
+// Test function prototypes
+void test_builtins();
+void test_interning();
+void test_conversion_matrix();
+void test_derived_conversions();
+void test_layouts();
+void test_type_errors();
+void benchmark_type_checks();
+
+int main() {
+    std::cout << "🧪 Running HolyC++ Type Table Tests\n";
+    std::cout << "====================================\n";
+
+    try {
+        test_builtins();
+        test_interning();
+        test_conversion_matrix();
+        test_derived_conversions();
+        test_layouts();
+        test_type_errors();
+        benchmark_type_checks();
+
+        std::cout << "\n✅ All type table tests passed!\n";
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "\n❌ Test failed: " << e.what() << "\n";
+        return 1;
+    }
+}
+
+void test_builtins() {
+    std::cout << "\n🔹 Testing builtin types...\n";
+
+    TypeTable types;
+    assert(types.typeCount() == BuiltinTypes::COUNT);
+    assert(types.name(BuiltinTypes::U0) == "U0");
+    assert(types.name(BuiltinTypes::I32) == "I32");
+    assert(types.kind(BuiltinTypes::F64) == TypeKind::FLOAT);
+    assert(types.size(BuiltinTypes::U16) == sizeof(U16));
+    assert(types.size(BuiltinTypes::I64) == sizeof(I64));
+    assert(types.size(BuiltinTypes::F32) == sizeof(F32));
+    assert(types.size(BuiltinTypes::U0) == U0::SIZE);
+    assert(types.isInteger(BuiltinTypes::U8) && !types.isInteger(BuiltinTypes::F32));
+    assert(types.isArithmetic(BuiltinTypes::F32) && !types.isArithmetic(BuiltinTypes::U0));
+
+    std::cout << "  ✓ Builtins have fixed ids and runtime sizes\n";
+}
+
+void test_interning() {
+    std::cout << "\n🔹 Testing hash-consing...\n";
+
+    TypeTable types;
+    TypeId p = types.pointerTo(BuiltinTypes::U8);
+    assert(types.pointerTo(BuiltinTypes::U8) == p);
+    assert(types.pointerTo(BuiltinTypes::I8) != p);
+    TypeId pp = types.pointerTo(p);
+    assert(types.pointerTo(types.pointerTo(BuiltinTypes::U8)) == pp);
+    assert(types.name(pp) == "U8**");
+
+    TypeId a = types.arrayOf(BuiltinTypes::I32, 10);
+    assert(types.arrayOf(BuiltinTypes::I32, 10) == a);
+    assert(types.arrayOf(BuiltinTypes::I32, 11) != a);
+    assert(types.name(a) == "I32[10]");
+    assert(types.size(a) == 40);
+
+    TypeId u = types.unionOf({BuiltinTypes::U8, BuiltinTypes::I32, BuiltinTypes::F64});
+    assert(types.unionOf({BuiltinTypes::U8, BuiltinTypes::I32, BuiltinTypes::F64}) == u);
+    assert(types.unionOf({BuiltinTypes::I32, BuiltinTypes::U8, BuiltinTypes::F64}) != u);
+    assert(types.name(u) == "union {U8, I32, F64}");
+    assert(types.members(u).size() == 3);
+
+    TypeId node = types.declareClass("Node");
+    assert(types.declareClass("Node") == node);
+    assert(types.findClass("Node") == node);
+    assert(types.findClass("Missing") == INVALID_TYPE);
+    assert(!types.isComplete(node));
+
+    const size_t before = types.typeCount();
+    for (int i = 0; i < 1000; ++i) {
+        types.pointerTo(BuiltinTypes::U8);
+        types.arrayOf(BuiltinTypes::I32, 10);
+    }
+    assert(types.typeCount() == before);
+
+    std::cout << "  ✓ Structurally equal types share one id\n";
+}
+
+// Tries the converting constructor on boundary values of From
+template<typename From, typename To>
+bool constructorCanThrow() {
+    for (auto raw : {From::MIN, From::MAX, static_cast<typename From::storage_type>(0)}) {
+        try {
+            To converted{From(raw)};
+            (void)converted;
+        } catch (const std::out_of_range&) {
+            return true;
+        }
+    }
+    return false;
+}
+
+template<typename From, typename To>
+void checkIntegerPair(const TypeTable& types, TypeId from, TypeId to) {
+    Conversion c = types.conversion(from, to);
+    const bool throws = constructorCanThrow<From, To>();
+    if (from == to) {
+        assert(c == Conversion::IDENTITY);
+    } else if (c == Conversion::WIDEN) {
+        assert(!throws);
+    } else {
+        assert(c == Conversion::CHECKED);
+        assert(throws);
+    }
+}
+
+template<typename From>
+void checkFromInteger(const TypeTable& types, TypeId from) {
+    checkIntegerPair<From, U8>(types, from, BuiltinTypes::U8);
+    checkIntegerPair<From, U16>(types, from, BuiltinTypes::U16);
+    checkIntegerPair<From, U32>(types, from, BuiltinTypes::U32);
+    checkIntegerPair<From, U64>(types, from, BuiltinTypes::U64);
+    checkIntegerPair<From, I8>(types, from, BuiltinTypes::I8);
+    checkIntegerPair<From, I16>(types, from, BuiltinTypes::I16);
+    checkIntegerPair<From, I32>(types, from, BuiltinTypes::I32);
+    checkIntegerPair<From, I64>(types, from, BuiltinTypes::I64);
+
+    // Integer -> float: WIDEN means MIN and MAX survive the round trip
+    for (TypeId to : {BuiltinTypes::F32, BuiltinTypes::F64}) {
+        bool exact = true;
+        for (auto raw : {From::MIN, From::MAX}) {
+            const long double converted = to == BuiltinTypes::F32
+                ? static_cast<long double>(F32(From(raw)).raw())
+                : static_cast<long double>(F64(From(raw)).raw());
+            exact = exact && converted == static_cast<long double>(raw);
+        }
+        Conversion c = types.conversion(from, to);
+        assert(c == (exact ? Conversion::WIDEN : Conversion::INEXACT));
+    }
+}
+
+void test_conversion_matrix() {
+    std::cout << "\n🔹 Testing conversions against the constructors...\n";
+
+    TypeTable types;
+    checkFromInteger<U8>(types, BuiltinTypes::U8);
+    checkFromInteger<U16>(types, BuiltinTypes::U16);
+    checkFromInteger<U32>(types, BuiltinTypes::U32);
+    checkFromInteger<U64>(types, BuiltinTypes::U64);
+    checkFromInteger<I8>(types, BuiltinTypes::I8);
+    checkFromInteger<I16>(types, BuiltinTypes::I16);
+    checkFromInteger<I32>(types, BuiltinTypes::I32);
+    checkFromInteger<I64>(types, BuiltinTypes::I64);
+
+    assert(types.conversion(BuiltinTypes::F32, BuiltinTypes::F64) == Conversion::WIDEN);
+    assert(types.conversion(BuiltinTypes::F64, BuiltinTypes::F32) == Conversion::INEXACT);
+    assert(types.conversion(BuiltinTypes::F64, BuiltinTypes::I32) == Conversion::CHECKED);
+    assert(types.conversion(BuiltinTypes::U0, BuiltinTypes::I32) == Conversion::NONE);
+    assert(types.conversion(BuiltinTypes::I32, BuiltinTypes::U0) == Conversion::NONE);
+    assert(types.isImplicit(BuiltinTypes::U8, BuiltinTypes::I16));
+    assert(!types.isImplicit(BuiltinTypes::I16, BuiltinTypes::U16));
+
+    // HolyC evaluates arithmetic in 64 bits
+    assert(types.arithmeticResult(BuiltinTypes::U8, BuiltinTypes::I8) == BuiltinTypes::I64);
+    assert(types.arithmeticResult(BuiltinTypes::U64, BuiltinTypes::I8) == BuiltinTypes::U64);
+    assert(types.arithmeticResult(BuiltinTypes::F32, BuiltinTypes::I8) == BuiltinTypes::F64);
+    assert(types.arithmeticResult(BuiltinTypes::U0, BuiltinTypes::I8) == INVALID_TYPE);
+
+    std::cout << "  ✓ Matrix agrees with UInt/SInt/FInt bounds checks\n";
+}
+
+void test_derived_conversions() {
+    std::cout << "\n🔹 Testing pointer and array conversions...\n";
+
+    TypeTable types;
+    TypeId u8p = types.pointerTo(BuiltinTypes::U8);
+    TypeId i32p = types.pointerTo(BuiltinTypes::I32);
+    TypeId voidp = types.pointerTo(BuiltinTypes::U0);
+    TypeId arr = types.arrayOf(BuiltinTypes::I32, 4);
+
+    assert(types.conversion(u8p, u8p) == Conversion::IDENTITY);
+    assert(types.conversion(u8p, voidp) == Conversion::REINTERPRET);
+    assert(types.conversion(voidp, i32p) == Conversion::REINTERPRET);
+    assert(types.conversion(u8p, i32p) == Conversion::NONE);
+    assert(types.conversion(arr, i32p) == Conversion::REINTERPRET);
+    assert(types.conversion(arr, u8p) == Conversion::NONE);
+    assert(types.conversion(u8p, BuiltinTypes::U64) == Conversion::REINTERPRET);
+    assert(types.conversion(u8p, BuiltinTypes::U32) == Conversion::INEXACT);
+    assert(types.conversion(BuiltinTypes::I64, u8p) == Conversion::REINTERPRET);
+    assert(types.conversion(BuiltinTypes::F64, u8p) == Conversion::NONE);
+    assert(types.conversion(u8p, BuiltinTypes::F64) == Conversion::NONE);
+
+    TypeId a = types.declareClass("A");
+    TypeId b = types.declareClass("B");
+    types.defineClass(a, {{"x", BuiltinTypes::I32}});
+    types.defineClass(b, {{"x", BuiltinTypes::I32}});
+    assert(types.conversion(a, b) == Conversion::NONE);   // Nominal
+    assert(types.conversion(a, a) == Conversion::IDENTITY);
+    assert(types.conversion(INVALID_TYPE, a) == Conversion::NONE);
+
+    std::cout << "  ✓ Derived conversions need only id compares\n";
+}
+
+struct Mixed {
+    U8 a;
+    I32 b;
+    F64 c;
+    U16 d;
+};
+
+void test_layouts() {
+    std::cout << "\n🔹 Testing class and union layouts...\n";
+
+    TypeTable types;
+    TypeId mixed = types.declareClass("Mixed");
+    types.defineClass(mixed, {{"a", BuiltinTypes::U8}, {"b", BuiltinTypes::I32},
+                              {"c", BuiltinTypes::F64}, {"d", BuiltinTypes::U16}});
+    const auto& fields = types.fields(mixed);
+    assert(fields.size() == 4);
+    assert(fields[0].offset == offsetof(Mixed, a));
+    assert(fields[1].offset == offsetof(Mixed, b));
+    assert(fields[2].offset == offsetof(Mixed, c));
+    assert(fields[3].offset == offsetof(Mixed, d));
+    assert(types.size(mixed) == sizeof(Mixed));
+    assert(types.align(mixed) == alignof(Mixed));
+
+    TypeId u = types.unionOf({BuiltinTypes::U8, BuiltinTypes::I32, BuiltinTypes::F64});
+    assert(types.size(u) == sizeof(CUnion<U8, I32, F64>));
+    assert(types.align(u) == alignof(CUnion<U8, I32, F64>));
+
+    // Self-reference through a pointer is fine before the class is complete
+    TypeId node = types.declareClass("Node");
+    types.defineClass(node, {{"value", BuiltinTypes::I64}, {"next", types.pointerTo(node)}});
+    assert(types.size(node) == 16);
+    assert(types.name(types.fields(node)[1].type) == "Node*");
+
+    std::cout << "  ✓ Layouts match the C++ representation\n";
+}
+
+void test_type_errors() {
+    std::cout << "\n🔹 Testing invalid type construction...\n";
+
+    TypeTable types;
+    TypeId cls = types.declareClass("Widget");
+
+    auto throwsInvalid = [](auto&& fn) {
+        try {
+            fn();
+        } catch (const std::invalid_argument&) {
+            return true;
+        }
+        return false;
+    };
+
+    assert(throwsInvalid([&] { types.arrayOf(cls, 4); }));
+    assert(throwsInvalid([&] { types.arrayOf(BuiltinTypes::U0, 4); }));
+    assert(throwsInvalid([&] { types.unionOf({}); }));
+    assert(throwsInvalid([&] { types.defineClass(cls, {{"self", cls}}); }));
+    assert(throwsInvalid([&] {
+        types.defineClass(cls, {{"x", BuiltinTypes::U8}, {"x", BuiltinTypes::U16}});
+    }));
+    types.defineClass(cls, {{"x", BuiltinTypes::U8}});
+    assert(throwsInvalid([&] { types.defineClass(cls, {{"y", BuiltinTypes::U8}}); }));
+    assert(throwsInvalid([&] { types.defineClass(BuiltinTypes::I32, {}); }));
+    assert(throwsInvalid([&] { types.fields(BuiltinTypes::I32); }));
+
+    bool outOfRange = false;
+    try {
+        types.pointerTo(12345);
+    } catch (const std::out_of_range&) {
+        outOfRange = true;
+    }
+    assert(outOfRange);
+
+    std::cout << "  ✓ Invalid types are rejected\n";
+}
+
+void benchmark_type_checks() {
+    std::cout << "\n🔹 Benchmarking type checks...\n";
+
+    TypeTable types;
+    std::vector<TypeId> pool;
+    for (TypeId t = 0; t < BuiltinTypes::COUNT; ++t) {
+        pool.push_back(t);
+        pool.push_back(types.pointerTo(t));
+        if (t != BuiltinTypes::U0) {
+            pool.push_back(types.arrayOf(t, 8));
+        }
+    }
+    std::vector<std::string> names;
+    for (TypeId t : pool) {
+        names.push_back(types.name(t));
+    }
+
+    const int iterations = 5000000;
+    std::vector<std::pair<uint32_t, uint32_t>> queries;
+    for (size_t i = 0; i < 4096; ++i) {
+        queries.emplace_back(static_cast<uint32_t>(i % pool.size()),
+                             static_cast<uint32_t>((i * 7 + i / pool.size()) % pool.size()));
+    }
+
+    uint64_t implicit = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        const auto& q = queries[i & 4095];
+        implicit += types.isImplicit(pool[q.first], pool[q.second]);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    double idMs = std::chrono::duration<double, std::milli>(end - start).count();
+
+    // Baseline: equality alone by comparing type spellings, as a checker
+    // without interning would
+    uint64_t equal = 0;
+    start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        const auto& q = queries[i & 4095];
+        equal += names[q.first] == names[q.second];
+    }
+    end = std::chrono::high_resolution_clock::now();
+    double nameMs = std::chrono::duration<double, std::milli>(end - start).count();
+
+    assert(implicit > 0 && equal > 0);
+    std::cout << "  " << iterations << " conversion queries by id: " << idMs << " ms\n";
+    std::cout << "  " << iterations << " equality checks by spelling: " << nameMs << " ms\n";
+}
@@ -0,0 +1,263 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "checking.hpp"
+
+namespace holycpp {
+
+// ==================== Arrays ====================
+// Array<T, N> is a fixed-size array held inline, HeapArray<T> an owning
+// array sized at run time (MAlloc with a length), and Slice<T> a pointer
+// and a length into either, or into a std::vector.
+//
+// operator[] checks its index when the Policy checks bounds (every policy
+// but checking::Unchecked, so level 0 builds strip the checks); at()
+// always checks. Iteration goes through raw pointers, and subslice()
+// checks its range once, so a loop over a slice pays for no per-element
+// checks. Storage is aligned to 64 bytes (32 for arrays under 64 bytes),
+// so vector loads never split a cache line.
+namespace arrays {
+
+constexpr size_t VECTOR_ALIGNMENT = 32;
+constexpr size_t CACHE_LINE = 64;
+
+constexpr size_t alignmentFor(size_t bytes, size_t natural) {
+    const size_t simd = bytes >= CACHE_LINE ? CACHE_LINE : VECTOR_ALIGNMENT;
+    return simd > natural ? simd : natural;
+}
+
+template<typename Policy>
+inline void checkIndex(size_t index, size_t length) {
+    if constexpr (checking::checks_bounds_v<Policy>) {
+        if (index >= length) {
+            throw std::out_of_range("Array index out of range");
+        }
+    }
+}
+
+inline void checkRange(size_t offset, size_t count, size_t length) {
+    if (offset > length || count > length - offset) {
+        throw std::out_of_range("Slice range out of bounds");
+    }
+}
+
+} // namespace arrays
+
+template<typename T, typename Policy = checking::Default>
+class Slice {
+    T* items = nullptr;
+    size_t length = 0;
+
+    template<typename U>
+    static constexpr bool VIEWABLE = std::is_convertible_v<U (*)[], T (*)[]>;
+
+public:
+    using value_type = std::remove_cv_t<T>;
+    using policy_type = Policy;
+
+    Slice() = default;
+    Slice(T* items, size_t length) : items(items), length(length) {}
+
+    // Over anything with data() and size() whose elements T can view:
+    // Array, HeapArray, std::vector, or a Slice of another policy
+    template<typename Container, typename = std::enable_if_t<
+        VIEWABLE<std::remove_pointer_t<decltype(std::declval<Container&>().data())>>>>
+    Slice(Container& values) : items(values.data()), length(values.size()) {}
+
+    template<typename U, typename OtherPolicy, typename = std::enable_if_t<VIEWABLE<U>>>
+    Slice(const Slice<U, OtherPolicy>& other) : items(other.data()), length(other.size()) {}
+
+    size_t size() const { return length; }
+    bool empty() const { return length == 0; }
+    T* data() const { return items; }
+
+    T& operator[](size_t index) const {
+        arrays::checkIndex<Policy>(index, length);
+        return items[index];
+    }
+
+    T& at(size_t index) const {
+        arrays::checkIndex<checking::Basic>(index, length);
+        return items[index];
+    }
+
+    T* begin() const { return items; }
+    T* end() const { return items + length; }
+
+    Slice subslice(size_t offset, size_t count) const {
+        arrays::checkRange(offset, count, length);
+        return Slice(items + offset, count);
+    }
+    Slice first(size_t count) const { return subslice(0, count); }
+    Slice drop(size_t count) const { return subslice(count, length - std::min(count, length)); }
+};
+
+// Aggregate, so Array<I64, 3> a = {1, 2, 3} works; elements is public for
+// that reason alone
+template<typename T, size_t N, typename Policy = checking::Default>
+struct Array {
+    static_assert(N > 0, "HolyC arrays have at least one element");
+
+    static constexpr size_t ALIGNMENT = arrays::alignmentFor(sizeof(T) * N, alignof(T));
+
+    alignas(ALIGNMENT) T elements[N];
+
+    static constexpr size_t size() { return N; }
+    T* data() { return elements; }
+    const T* data() const { return elements; }
+
+    T& operator[](size_t index) {
+        arrays::checkIndex<Policy>(index, N);
+        return elements[index];
+    }
+    const T& operator[](size_t index) const {
+        arrays::checkIndex<Policy>(index, N);
+        return elements[index];
+    }
+
+    T& at(size_t index) {
+        arrays::checkIndex<checking::Basic>(index, N);
+        return elements[index];
+    }
+    const T& at(size_t index) const {
+        arrays::checkIndex<checking::Basic>(index, N);
+        return elements[index];
+    }
+
+    T* begin() { return elements; }
+    T* end() { return elements + N; }
+    const T* begin() const { return elements; }
+    const T* end() const { return elements + N; }
+
+    void fill(const T& value) {
+        for (T& element : elements) {
+            element = value;
+        }
+    }
+
+    Slice<T, Policy> slice() { return Slice<T, Policy>(elements, N); }
+    Slice<const T, Policy> slice() const { return Slice<const T, Policy>(elements, N); }
+};
+
+// Elements are value-initialized, so a HeapArray<I32> starts zeroed
+template<typename T, typename Policy = checking::Default>
+class HeapArray {
+public:
+    static constexpr size_t ALIGNMENT = arrays::alignmentFor(arrays::CACHE_LINE, alignof(T));
+
+private:
+    T* items = nullptr;
+    size_t length = 0;
+
+    // Counts come from HolyC code, so count * sizeof(T) must not wrap
+    static T* allocate(size_t count) {
+        if (count > SIZE_MAX / sizeof(T)) {
+            throw std::bad_array_new_length();
+        }
+        return count ? static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t(ALIGNMENT))) : nullptr;
+    }
+
+    void release() {
+        for (size_t i = length; i > 0; --i) {
+            items[i - 1].~T();
+        }
+        if (items) {
+            ::operator delete(items, std::align_val_t(ALIGNMENT));
+        }
+        items = nullptr;
+        length = 0;
+    }
+
+    // Builds count elements with make(i); on an exception destroys the
+    // ones built so far and frees the storage
+    template<typename Make>
+    void build(size_t count, Make make) {
+        T* storage = allocate(count);
+        size_t built = 0;
+        try {
+            for (; built < count; ++built) {
+                new (storage + built) T(make(built));
+            }
+        } catch (...) {
+            while (built > 0) {
+                storage[--built].~T();
+            }
+            ::operator delete(storage, std::align_val_t(ALIGNMENT));
+            throw;
+        }
+        items = storage;
+        length = count;
+    }
+
+public:
+    HeapArray() = default;
+    explicit HeapArray(size_t count) { build(count, [](size_t) { return T(); }); }
+    HeapArray(size_t count, const T& value) { build(count, [&](size_t) { return value; }); }
+    ~HeapArray() { release(); }
+
+    HeapArray(const HeapArray& other) { build(other.length, [&](size_t i) { return other.items[i]; }); }
+
+    HeapArray(HeapArray&& other) noexcept
+        : items(std::exchange(other.items, nullptr)), length(std::exchange(other.length, 0)) {}
+
+    HeapArray& operator=(const HeapArray& other) {
+        if (this != &other) {
+            HeapArray copy(other);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    HeapArray& operator=(HeapArray&& other) noexcept {
+        if (this != &other) {
+            release();
+            items = std::exchange(other.items, nullptr);
+            length = std::exchange(other.length, 0);
+        }
+        return *this;
+    }
+
+    size_t size() const { return length; }
+    bool empty() const { return length == 0; }
+    T* data() { return items; }
+    const T* data() const { return items; }
+
+    T& operator[](size_t index) {
+        arrays::checkIndex<Policy>(index, length);
+        return items[index];
+    }
+    const T& operator[](size_t index) const {
+        arrays::checkIndex<Policy>(index, length);
+        return items[index];
+    }
+
+    T& at(size_t index) {
+        arrays::checkIndex<checking::Basic>(index, length);
+        return items[index];
+    }
+    const T& at(size_t index) const {
+        arrays::checkIndex<checking::Basic>(index, length);
+        return items[index];
+    }
+
+    T* begin() { return items; }
+    T* end() { return items + length; }
+    const T* begin() const { return items; }
+    const T* end() const { return items + length; }
+
+    Slice<T, Policy> slice() { return Slice<T, Policy>(items, length); }
+    Slice<const T, Policy> slice() const { return Slice<const T, Policy>(items, length); }
+};
+
+// MAlloc with a length: a zeroed HeapArray of count values
+template<typename T>
+inline HeapArray<T> MAllocArray(size_t count) {
+    return HeapArray<T>(count);
+}
+
+} // namespace holycpp
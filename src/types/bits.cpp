@@ -0,0 +1,180 @@
+#include "bits.hpp"
+
+#if HOLYC_X86_DISPATCH
+#include <immintrin.h>
+// Compiles the function once per target and picks one at load time
+#define HOLYC_TARGET_CLONES(...) __attribute__((target_clones(__VA_ARGS__)))
+#else
+#define HOLYC_TARGET_CLONES(...)
+#endif
+
+namespace holycpp {
+namespace bits {
+
+bool cpuHasAvx2() {
+#if HOLYC_X86_DISPATCH
+    static const bool has = __builtin_cpu_supports("avx2");
+    return has;
+#else
+    return false;
+#endif
+}
+
+bool cpuHasBmi2() {
+#if HOLYC_X86_DISPATCH
+    static const bool has = __builtin_cpu_supports("bmi2");
+    return has;
+#else
+    return false;
+#endif
+}
+
+bool cpuHasF16c() {
+#if HOLYC_X86_DISPATCH
+    static const bool has = __builtin_cpu_supports("f16c");
+    return has;
+#else
+    return false;
+#endif
+}
+
+bool cpuHasFma() {
+#if HOLYC_X86_DISPATCH
+    static const bool has = __builtin_cpu_supports("fma");
+    return has;
+#else
+    return false;
+#endif
+}
+
+// ==================== Population Count ====================
+
+namespace {
+
+HOLYC_TARGET_CLONES("popcnt", "default")
+uint64_t popcountScalar(const uint64_t* data, size_t count) {
+    uint64_t total = 0;
+    for (size_t i = 0; i < count; ++i) {
+        total += static_cast<uint64_t>(popcount(data[i]));
+    }
+    return total;
+}
+
+#if HOLYC_X86_DISPATCH
+// Nibble lookups with PSHUFB, summed per 8 bytes with PSADBW
+__attribute__((target("avx2")))
+uint64_t popcountAvx2(const uint64_t* data, size_t count) {
+    const __m256i table = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                           0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i low = _mm256_set1_epi8(0x0F);
+    __m256i totals = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m256i words = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        const __m256i lo = _mm256_shuffle_epi8(table, _mm256_and_si256(words, low));
+        const __m256i hi = _mm256_shuffle_epi8(table, _mm256_and_si256(_mm256_srli_epi16(words, 4), low));
+        totals = _mm256_add_epi64(totals, _mm256_sad_epu8(_mm256_add_epi8(lo, hi), _mm256_setzero_si256()));
+    }
+    uint64_t lanes[4];
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), totals);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + popcountScalar(data + i, count - i);
+}
+#endif
+
+} // namespace
+
+uint64_t popcountArray(const uint64_t* data, size_t count) {
+#if HOLYC_X86_DISPATCH
+    if (cpuHasAvx2()) {
+        return popcountAvx2(data, count);
+    }
+#endif
+    return popcountScalar(data, count);
+}
+
+// ==================== Byte Swaps and Rotates ====================
+// Plain loops; the AVX2 clones vectorize them to VPSHUFB and shift pairs
+
+HOLYC_TARGET_CLONES("avx2", "default")
+void byteSwapArray(uint16_t* data, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        data[i] = byteSwap(data[i]);
+    }
+}
+
+HOLYC_TARGET_CLONES("avx2", "default")
+void byteSwapArray(uint32_t* data, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        data[i] = byteSwap(data[i]);
+    }
+}
+
+HOLYC_TARGET_CLONES("avx2", "default")
+void byteSwapArray(uint64_t* data, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        data[i] = byteSwap(data[i]);
+    }
+}
+
+HOLYC_TARGET_CLONES("avx2", "default")
+void rotateLeftArray(uint32_t* data, size_t count, unsigned shift) {
+    for (size_t i = 0; i < count; ++i) {
+        data[i] = rotateLeft(data[i], shift);
+    }
+}
+
+HOLYC_TARGET_CLONES("avx2", "default")
+void rotateLeftArray(uint64_t* data, size_t count, unsigned shift) {
+    for (size_t i = 0; i < count; ++i) {
+        data[i] = rotateLeft(data[i], shift);
+    }
+}
+
+// ==================== Extract and Deposit ====================
+
+namespace {
+
+#if HOLYC_X86_DISPATCH
+__attribute__((target("bmi2")))
+void extractBmi2(const uint64_t* in, uint64_t* out, size_t count, uint64_t mask) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = _pext_u64(in[i], mask);
+    }
+}
+
+__attribute__((target("bmi2")))
+void depositBmi2(const uint64_t* in, uint64_t* out, size_t count, uint64_t mask) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = _pdep_u64(in[i], mask);
+    }
+}
+#endif
+
+} // namespace
+
+void extractBitsArray(const uint64_t* in, uint64_t* out, size_t count, uint64_t mask) {
+#if HOLYC_X86_DISPATCH
+    if (cpuHasBmi2()) {
+        extractBmi2(in, out, count, mask);
+        return;
+    }
+#endif
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = extractBits(in[i], mask);
+    }
+}
+
+void depositBitsArray(const uint64_t* in, uint64_t* out, size_t count, uint64_t mask) {
+#if HOLYC_X86_DISPATCH
+    if (cpuHasBmi2()) {
+        depositBmi2(in, out, count, mask);
+        return;
+    }
+#endif
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = depositBits(in[i], mask);
+    }
+}
+
+} // namespace bits
+} // namespace holycpp
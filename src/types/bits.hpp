@@ -0,0 +1,162 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+namespace holycpp {
+namespace bits {
+
+// ==================== Scalar Bit Operations ====================
+// Population count, leading and trailing zero counts, byte swap, rotates
+// and bit extract/deposit on the unsigned builtins behind UInt and SInt.
+// These map to POPCNT, LZCNT, TZCNT, BSWAP, ROL/ROR, PEXT and PDEP when
+// the build enables them (-mpopcnt -mlzcnt -mbmi -mbmi2, or -march=native).
+// Otherwise GCC expands the builtins portably and pext/pdep loop over
+// the mask. The array functions below choose their path at run time.
+//
+// Zero counts of zero are the width, as with LZCNT/TZCNT. Rotates take
+// any count modulo the width and never throw, unlike UInt's shifts.
+template<typename T>
+using EnableUnsigned = std::enable_if_t<std::is_integral_v<T> && std::is_unsigned_v<T>, int>;
+
+template<typename T, EnableUnsigned<T> = 0>
+constexpr int popcount(T value) {
+    if constexpr (sizeof(T) <= sizeof(unsigned)) {
+        return __builtin_popcount(value);
+    } else {
+        return __builtin_popcountll(value);
+    }
+}
+
+template<typename T, EnableUnsigned<T> = 0>
+constexpr int countLeadingZeros(T value) {
+    constexpr int BITS = sizeof(T) * 8;
+    if (value == 0) {
+        return BITS;
+    }
+    if constexpr (sizeof(T) <= sizeof(unsigned)) {
+        return __builtin_clz(value) - (32 - BITS);
+    } else {
+        return __builtin_clzll(value);
+    }
+}
+
+template<typename T, EnableUnsigned<T> = 0>
+constexpr int countTrailingZeros(T value) {
+    if (value == 0) {
+        return sizeof(T) * 8;
+    }
+    if constexpr (sizeof(T) <= sizeof(unsigned)) {
+        return __builtin_ctz(value);
+    } else {
+        return __builtin_ctzll(value);
+    }
+}
+
+template<typename T, EnableUnsigned<T> = 0>
+constexpr T byteSwap(T value) {
+    if constexpr (sizeof(T) == 1) {
+        return value;
+    } else if constexpr (sizeof(T) == 2) {
+        return __builtin_bswap16(value);
+    } else if constexpr (sizeof(T) == 4) {
+        return __builtin_bswap32(value);
+    } else {
+        return __builtin_bswap64(value);
+    }
+}
+
+template<typename T, EnableUnsigned<T> = 0>
+constexpr T rotateLeft(T value, unsigned count) {
+    constexpr unsigned BITS = sizeof(T) * 8;
+    count &= BITS - 1;
+    return static_cast<T>((value << count) | (value >> ((BITS - count) & (BITS - 1))));
+}
+
+template<typename T, EnableUnsigned<T> = 0>
+constexpr T rotateRight(T value, unsigned count) {
+    constexpr unsigned BITS = sizeof(T) * 8;
+    count &= BITS - 1;
+    return static_cast<T>((value >> count) | (value << ((BITS - count) & (BITS - 1))));
+}
+
+// Gathers the bits of `value` selected by `mask` into the low bits (PEXT)
+template<typename T, EnableUnsigned<T> = 0>
+inline T extractBits(T value, T mask) {
+#if defined(__BMI2__)
+    if constexpr (sizeof(T) <= 4) {
+        return static_cast<T>(_pext_u32(value, mask));
+    } else {
+        return static_cast<T>(_pext_u64(value, mask));
+    }
+#else
+    T result = 0;
+    for (T bit = 1; mask; bit = static_cast<T>(bit << 1)) {
+        const T lowest = static_cast<T>(mask & (T(0) - mask));
+        if (value & lowest) {
+            result |= bit;
+        }
+        mask = static_cast<T>(mask & (mask - 1));
+    }
+    return result;
+#endif
+}
+
+// Scatters the low bits of `value` to the positions set in `mask` (PDEP)
+template<typename T, EnableUnsigned<T> = 0>
+inline T depositBits(T value, T mask) {
+#if defined(__BMI2__)
+    if constexpr (sizeof(T) <= 4) {
+        return static_cast<T>(_pdep_u32(value, mask));
+    } else {
+        return static_cast<T>(_pdep_u64(value, mask));
+    }
+#else
+    T result = 0;
+    for (T bit = 1; mask; bit = static_cast<T>(bit << 1)) {
+        const T lowest = static_cast<T>(mask & (T(0) - mask));
+        if (value & bit) {
+            result |= lowest;
+        }
+        mask = static_cast<T>(mask & (mask - 1));
+    }
+    return result;
+#endif
+}
+
+// ==================== Array Bit Operations ====================
+// The same operations over whole arrays. On x86-64 each picks the best
+// path the CPU supports when it is first called: AVX2 for popcount, byte
+// swaps and rotates, and BMI2 for extract/deposit. Other targets run the
+// scalar loops. Results match the scalar functions exactly.
+uint64_t popcountArray(const uint64_t* data, size_t count);
+
+void byteSwapArray(uint16_t* data, size_t count);
+void byteSwapArray(uint32_t* data, size_t count);
+void byteSwapArray(uint64_t* data, size_t count);
+
+void rotateLeftArray(uint32_t* data, size_t count, unsigned shift);
+void rotateLeftArray(uint64_t* data, size_t count, unsigned shift);
+
+void extractBitsArray(const uint64_t* in, uint64_t* out, size_t count, uint64_t mask);
+void depositBitsArray(const uint64_t* in, uint64_t* out, size_t count, uint64_t mask);
+
+// HOLYC_X86_DISPATCH is 1 where kernels can be compiled per target (GCC
+// on x86-64) and picked at run time with the checks below
+#if defined(__x86_64__) && defined(__GNUC__) && !defined(__clang__)
+#define HOLYC_X86_DISPATCH 1
+#else
+#define HOLYC_X86_DISPATCH 0
+#endif
+
+// What the array functions can use on this CPU
+bool cpuHasAvx2();
+bool cpuHasBmi2();
+bool cpuHasF16c();
+bool cpuHasFma();
+
+} // namespace bits
+} // namespace holycpp
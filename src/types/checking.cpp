@@ -0,0 +1,22 @@
+#include "checking.hpp"
+#include "../lib/error.hpp"
+
+namespace holycpp {
+namespace checking {
+
+void reportFault(Fault fault, bool isSigned) {
+    ErrorManager& manager = ErrorManager::get();
+    switch (fault) {
+        case Fault::DIVISION_BY_ZERO:
+        case Fault::MODULO_BY_ZERO:
+        case Fault::DIVISION_OVERFLOW:
+            manager.error(faultMessage(fault, isSigned));
+            break;
+        default:
+            manager.warning(faultMessage(fault, isSigned));
+            break;
+    }
+}
+
+} // namespace checking
+} // namespace holycpp
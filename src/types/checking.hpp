@@ -0,0 +1,433 @@
+#pragma once
+#include <cstdint>
+#include <type_traits>
+#include <stdexcept>
+#include <limits>
+
+// Build-wide default checking policy for UInt/SInt, per specs/ERROR.MD:
+//   0 = none      every check stripped (checking::Unchecked)
+//   1 = basic     division, negation and shift checks (checking::Basic)
+//   2 = full      basic plus +, -, * overflow (checking::Trapping)
+//   3 = paranoid  every fault reported to ErrorManager (checking::Reporting)
+// Level 3 needs src/types/checking.cpp and src/lib/error.cpp at link time.
+#ifndef HOLYC_ERROR_CHECKING_LEVEL
+#define HOLYC_ERROR_CHECKING_LEVEL 1
+#endif
+
+namespace holycpp {
+
+namespace checking {
+
+// ==================== Faults ====================
+enum class Fault : uint8_t {
+    ADD_OVERFLOW,
+    SUB_OVERFLOW,
+    MUL_OVERFLOW,
+    DIVISION_BY_ZERO,
+    MODULO_BY_ZERO,
+    DIVISION_OVERFLOW,   // MIN / -1
+    NEGATION_OVERFLOW,   // -MIN
+    SHIFT_OUT_OF_RANGE
+};
+
+// The message each fault has always been thrown with
+inline const char* faultMessage(Fault fault, bool isSigned) {
+    switch (fault) {
+        case Fault::ADD_OVERFLOW: return isSigned ? "Signed addition overflow" : "Unsigned addition overflow";
+        case Fault::SUB_OVERFLOW: return isSigned ? "Signed subtraction overflow" : "Unsigned subtraction underflow";
+        case Fault::MUL_OVERFLOW: return isSigned ? "Signed multiplication overflow" : "Unsigned multiplication overflow";
+        case Fault::DIVISION_BY_ZERO: return "Division by zero";
+        case Fault::MODULO_BY_ZERO: return "Modulo by zero";
+        case Fault::DIVISION_OVERFLOW: return "Signed division overflow (MIN / -1)";
+        case Fault::NEGATION_OVERFLOW: return "Negation of MIN value overflows";
+        case Fault::SHIFT_OUT_OF_RANGE: return isSigned ? "Shift amount out of range" : "Shift amount exceeds bit width";
+    }
+    return "Arithmetic fault";
+}
+
+// Throws the std exception matching the fault
+[[noreturn]] inline void raise(Fault fault, bool isSigned) {
+    const char* message = faultMessage(fault, isSigned);
+    switch (fault) {
+        case Fault::SUB_OVERFLOW:
+            if (!isSigned) {
+                throw std::underflow_error(message);
+            }
+            throw std::overflow_error(message);
+        case Fault::DIVISION_BY_ZERO:
+        case Fault::MODULO_BY_ZERO:
+            throw std::domain_error(message);
+        case Fault::SHIFT_OUT_OF_RANGE:
+            throw std::out_of_range(message);
+        default:
+            throw std::overflow_error(message);
+    }
+}
+
+// Sends a fault to ErrorManager: overflow and shift faults as warnings,
+// division faults as errors. Defined in checking.cpp.
+void reportFault(Fault fault, bool isSigned);
+
+namespace detail {
+
+// Unsigned type the operation is carried out in, so that signed overflow is
+// never undefined and narrow types do not promote to int
+template<typename T>
+using Wide = std::conditional_t<(sizeof(T) < sizeof(unsigned)), unsigned, std::make_unsigned_t<T>>;
+
+template<typename T> constexpr T wrapAdd(T a, T b) { return static_cast<T>(static_cast<Wide<T>>(a) + static_cast<Wide<T>>(b)); }
+template<typename T> constexpr T wrapSub(T a, T b) { return static_cast<T>(static_cast<Wide<T>>(a) - static_cast<Wide<T>>(b)); }
+template<typename T> constexpr T wrapMul(T a, T b) { return static_cast<T>(static_cast<Wide<T>>(a) * static_cast<Wide<T>>(b)); }
+
+// Overflow-reporting forms; the wrapped result is stored either way
+template<typename T> bool addOverflows(T a, T b, T& result) { return __builtin_add_overflow(a, b, &result); }
+template<typename T> bool subOverflows(T a, T b, T& result) { return __builtin_sub_overflow(a, b, &result); }
+template<typename T> bool mulOverflows(T a, T b, T& result) { return __builtin_mul_overflow(a, b, &result); }
+
+template<typename T>
+constexpr bool divisionOverflows(T a, T b) {
+    if constexpr (std::is_signed_v<T>) {
+        return a == std::numeric_limits<T>::min() && b == -1;
+    }
+    return false;
+}
+
+template<size_t Bits, typename C>
+constexpr bool shiftInRange(C count) {
+    if constexpr (std::is_signed_v<C>) {
+        if (count < 0) {
+            return false;
+        }
+    }
+    return static_cast<uint64_t>(count) < Bits;
+}
+
+// Shifts for a count already known to be in range
+template<typename T> constexpr T shiftLeft(T a, uint64_t count) { return static_cast<T>(static_cast<Wide<T>>(a) << count); }
+template<typename T> constexpr T shiftRight(T a, uint64_t count) { return static_cast<T>(a >> count); }
+
+// MAX for a positive overflow, MIN for a negative one
+template<typename T> constexpr T saturate(bool negative) {
+    return negative ? std::numeric_limits<T>::min() : std::numeric_limits<T>::max();
+}
+
+template<typename T> constexpr bool isNegative(T a) {
+    if constexpr (std::is_signed_v<T>) {
+        return a < 0;
+    }
+    return false;
+}
+
+// Result of a right shift by the full width or more
+template<typename T> constexpr T shiftedOut(T a) { return isNegative(a) ? T(-1) : T(0); }
+
+// Whether a wider intermediate of the same signedness is in T's range. W
+// may be __int128, which has no type traits in ISO mode
+template<typename T, typename W> constexpr bool fits(W wide) {
+    return wide >= static_cast<W>(std::numeric_limits<T>::min()) && wide <= static_cast<W>(std::numeric_limits<T>::max());
+}
+
+} // namespace detail
+
+// ==================== Policies ====================
+// Each policy implements the arithmetic operators of UInt/SInt on raw
+// storage values. Shifts take the declared width as a template argument
+// since SInt<12> stores 64 bits. Bitwise and comparison operators never
+// fault and do not go through the policy. narrow() fits a wider
+// intermediate (fixed-point products and quotients) back into T, treating a
+// value out of range as `fault`.
+
+// No checks at all. Overflow wraps, shift counts are masked to the storage
+// width as x86 does, and division by zero or MIN / -1 is undefined, as in C.
+struct Unchecked {
+    template<typename T> static T add(T a, T b) { return detail::wrapAdd(a, b); }
+    template<typename T> static T sub(T a, T b) { return detail::wrapSub(a, b); }
+    template<typename T> static T mul(T a, T b) { return detail::wrapMul(a, b); }
+    template<typename T> static T div(T a, T b) { return static_cast<T>(a / b); }
+    template<typename T> static T mod(T a, T b) { return static_cast<T>(a % b); }
+    template<typename T> static T neg(T a) { return detail::wrapSub(T(0), a); }
+
+    template<size_t Bits, typename T, typename C>
+    static T shl(T a, C count) { return detail::shiftLeft(a, static_cast<uint64_t>(count) & (sizeof(T) * 8 - 1)); }
+    template<size_t Bits, typename T, typename C>
+    static T shr(T a, C count) { return detail::shiftRight(a, static_cast<uint64_t>(count) & (sizeof(T) * 8 - 1)); }
+
+    template<typename T, typename W> static T narrow(W wide, Fault) { return static_cast<T>(wide); }
+};
+
+// HolyC behaviour: +, - and * wrap; division by zero, MIN / -1, -MIN and
+// out-of-range shift counts throw
+struct Basic {
+    template<typename T> static T add(T a, T b) { return detail::wrapAdd(a, b); }
+    template<typename T> static T sub(T a, T b) { return detail::wrapSub(a, b); }
+    template<typename T> static T mul(T a, T b) { return detail::wrapMul(a, b); }
+
+    template<typename T>
+    static T div(T a, T b) {
+        if (b == 0) {
+            raise(Fault::DIVISION_BY_ZERO, std::is_signed_v<T>);
+        }
+        if (detail::divisionOverflows(a, b)) {
+            raise(Fault::DIVISION_OVERFLOW, true);
+        }
+        return static_cast<T>(a / b);
+    }
+
+    template<typename T>
+    static T mod(T a, T b) {
+        if (b == 0) {
+            raise(Fault::MODULO_BY_ZERO, std::is_signed_v<T>);
+        }
+        // MIN % -1 is 0, but computing it traps on x86
+        return detail::divisionOverflows(a, b) ? T(0) : static_cast<T>(a % b);
+    }
+
+    template<typename T>
+    static T neg(T a) {
+        if (detail::divisionOverflows(a, T(-1))) {
+            raise(Fault::NEGATION_OVERFLOW, true);
+        }
+        return detail::wrapSub(T(0), a);
+    }
+
+    template<size_t Bits, typename T, typename C>
+    static T shl(T a, C count) {
+        if (!detail::shiftInRange<Bits>(count)) {
+            raise(Fault::SHIFT_OUT_OF_RANGE, std::is_signed_v<T>);
+        }
+        return detail::shiftLeft(a, static_cast<uint64_t>(count));
+    }
+
+    template<size_t Bits, typename T, typename C>
+    static T shr(T a, C count) {
+        if (!detail::shiftInRange<Bits>(count)) {
+            raise(Fault::SHIFT_OUT_OF_RANGE, std::is_signed_v<T>);
+        }
+        return detail::shiftRight(a, static_cast<uint64_t>(count));
+    }
+
+    // Wraps, as +, - and * do
+    template<typename T, typename W> static T narrow(W wide, Fault) { return static_cast<T>(wide); }
+};
+
+// Basic, plus +, - and * throw on overflow (as checked_add() and friends do)
+struct Trapping : Basic {
+    template<typename T>
+    static T add(T a, T b) {
+        T result;
+        if (detail::addOverflows(a, b, result)) {
+            raise(Fault::ADD_OVERFLOW, std::is_signed_v<T>);
+        }
+        return result;
+    }
+
+    template<typename T>
+    static T sub(T a, T b) {
+        T result;
+        if (detail::subOverflows(a, b, result)) {
+            raise(Fault::SUB_OVERFLOW, std::is_signed_v<T>);
+        }
+        return result;
+    }
+
+    template<typename T>
+    static T mul(T a, T b) {
+        T result;
+        if (detail::mulOverflows(a, b, result)) {
+            raise(Fault::MUL_OVERFLOW, std::is_signed_v<T>);
+        }
+        return result;
+    }
+
+    template<typename T, typename W>
+    static T narrow(W wide, Fault fault) {
+        if (!detail::fits<T>(wide)) {
+            raise(fault, std::is_signed_v<T>);
+        }
+        return static_cast<T>(wide);
+    }
+};
+
+// Results clamp to [MIN, MAX] and nothing throws. x / 0 saturates toward
+// the sign of x (0 / 0 is 0) and x % 0 is 0. A left shift that loses bits
+// saturates; a right shift by the full width or more leaves 0 or -1.
+struct Saturating {
+    template<typename T>
+    static T add(T a, T b) {
+        T result;
+        return detail::addOverflows(a, b, result) ? detail::saturate<T>(detail::isNegative(b)) : result;
+    }
+
+    template<typename T>
+    static T sub(T a, T b) {
+        T result;
+        if (!detail::subOverflows(a, b, result)) {
+            return result;
+        }
+        return std::is_signed_v<T> ? detail::saturate<T>(!detail::isNegative(b)) : T(0);
+    }
+
+    template<typename T>
+    static T mul(T a, T b) {
+        T result;
+        return detail::mulOverflows(a, b, result)
+            ? detail::saturate<T>(detail::isNegative(a) != detail::isNegative(b)) : result;
+    }
+
+    template<typename T>
+    static T div(T a, T b) {
+        if (b == 0) {
+            return a == 0 ? T(0) : detail::saturate<T>(detail::isNegative(a));
+        }
+        if (detail::divisionOverflows(a, b)) {
+            return std::numeric_limits<T>::max();
+        }
+        return static_cast<T>(a / b);
+    }
+
+    template<typename T>
+    static T mod(T a, T b) {
+        return b == 0 || detail::divisionOverflows(a, b) ? T(0) : static_cast<T>(a % b);
+    }
+
+    template<typename T>
+    static T neg(T a) {
+        return detail::divisionOverflows(a, T(-1)) ? std::numeric_limits<T>::max() : detail::wrapSub(T(0), a);
+    }
+
+    template<size_t Bits, typename T, typename C>
+    static T shl(T a, C count) {
+        if (!detail::shiftInRange<Bits>(count)) {
+            return a == 0 ? T(0) : detail::saturate<T>(detail::isNegative(a));
+        }
+        T result = detail::shiftLeft(a, static_cast<uint64_t>(count));
+        if (detail::shiftRight(result, static_cast<uint64_t>(count)) != a) {
+            return detail::saturate<T>(detail::isNegative(a));
+        }
+        return result;
+    }
+
+    template<size_t Bits, typename T, typename C>
+    static T shr(T a, C count) {
+        if (!detail::shiftInRange<Bits>(count)) {
+            return detail::shiftedOut(a);
+        }
+        return detail::shiftRight(a, static_cast<uint64_t>(count));
+    }
+
+    template<typename T, typename W>
+    static T narrow(W wide, Fault) {
+        return detail::fits<T>(wide) ? static_cast<T>(wide) : detail::saturate<T>(wide < W(0));
+    }
+};
+
+// Debug builds: every fault Trapping would throw is reported through
+// reportFault() instead and execution carries on with the wrapped result.
+// Division by zero yields 0 and out-of-range shifts leave 0 or -1.
+struct Reporting {
+    template<typename T>
+    static T add(T a, T b) {
+        T result;
+        if (detail::addOverflows(a, b, result)) {
+            reportFault(Fault::ADD_OVERFLOW, std::is_signed_v<T>);
+        }
+        return result;
+    }
+
+    template<typename T>
+    static T sub(T a, T b) {
+        T result;
+        if (detail::subOverflows(a, b, result)) {
+            reportFault(Fault::SUB_OVERFLOW, std::is_signed_v<T>);
+        }
+        return result;
+    }
+
+    template<typename T>
+    static T mul(T a, T b) {
+        T result;
+        if (detail::mulOverflows(a, b, result)) {
+            reportFault(Fault::MUL_OVERFLOW, std::is_signed_v<T>);
+        }
+        return result;
+    }
+
+    template<typename T>
+    static T div(T a, T b) {
+        if (b == 0) {
+            reportFault(Fault::DIVISION_BY_ZERO, std::is_signed_v<T>);
+            return T(0);
+        }
+        if (detail::divisionOverflows(a, b)) {
+            reportFault(Fault::DIVISION_OVERFLOW, true);
+            return a;
+        }
+        return static_cast<T>(a / b);
+    }
+
+    template<typename T>
+    static T mod(T a, T b) {
+        if (b == 0) {
+            reportFault(Fault::MODULO_BY_ZERO, std::is_signed_v<T>);
+            return T(0);
+        }
+        return detail::divisionOverflows(a, b) ? T(0) : static_cast<T>(a % b);
+    }
+
+    template<typename T>
+    static T neg(T a) {
+        if (detail::divisionOverflows(a, T(-1))) {
+            reportFault(Fault::NEGATION_OVERFLOW, true);
+        }
+        return detail::wrapSub(T(0), a);
+    }
+
+    template<size_t Bits, typename T, typename C>
+    static T shl(T a, C count) {
+        if (!detail::shiftInRange<Bits>(count)) {
+            reportFault(Fault::SHIFT_OUT_OF_RANGE, std::is_signed_v<T>);
+            return T(0);
+        }
+        return detail::shiftLeft(a, static_cast<uint64_t>(count));
+    }
+
+    template<size_t Bits, typename T, typename C>
+    static T shr(T a, C count) {
+        if (!detail::shiftInRange<Bits>(count)) {
+            reportFault(Fault::SHIFT_OUT_OF_RANGE, std::is_signed_v<T>);
+            return detail::shiftedOut(a);
+        }
+        return detail::shiftRight(a, static_cast<uint64_t>(count));
+    }
+
+    template<typename T, typename W>
+    static T narrow(W wide, Fault fault) {
+        if (!detail::fits<T>(wide)) {
+            reportFault(fault, std::is_signed_v<T>);
+        }
+        return static_cast<T>(wide);
+    }
+};
+
+// Array and Slice indexing (array.hpp) is checked under every policy but
+// Unchecked; an index out of range is never a value to saturate or wrap
+template<typename Policy>
+inline constexpr bool checks_bounds_v = !std::is_same_v<Policy, Unchecked>;
+
+#if HOLYC_ERROR_CHECKING_LEVEL <= 0
+using Default = Unchecked;
+#elif HOLYC_ERROR_CHECKING_LEVEL == 1
+using Default = Basic;
+#elif HOLYC_ERROR_CHECKING_LEVEL == 2
+using Default = Trapping;
+#else
+using Default = Reporting;
+#endif
+
+} // namespace checking
+
+// Forward declarations; the policy defaults to the build-wide one
+template<size_t Bits, typename Policy = checking::Default> class UInt;
+template<size_t Bits, typename Policy = checking::Default> class SInt;
+
+} // namespace holycpp
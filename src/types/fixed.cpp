@@ -0,0 +1,107 @@
+#include "fixed.hpp"
+#include "bits.hpp"
+
+#if HOLYC_X86_DISPATCH
+#include <immintrin.h>
+#endif
+
+namespace holycpp {
+
+static_assert(sizeof(Q15) == 2 && std::is_standard_layout_v<Q15>,
+              "Arrays of Q15 are processed as arrays of their raw values");
+
+namespace {
+
+// ==================== Scalar Loops ====================
+
+void multiplyScalar(const Q15* a, const Q15* b, Q15* out, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = a[i] * b[i];
+    }
+}
+
+int64_t dotScalar(const int16_t* a, const int16_t* b, size_t count) {
+    int64_t total = 0;
+    for (size_t i = 0; i < count; ++i) {
+        total += static_cast<int32_t>(a[i]) * b[i];
+    }
+    return total;
+}
+
+const int16_t* rawOf(const Q15* values) { return reinterpret_cast<const int16_t*>(values); }
+int16_t* rawOf(Q15* values) { return reinterpret_cast<int16_t*>(values); }
+
+#if HOLYC_X86_DISPATCH
+// ==================== AVX2 Kernels ====================
+
+// VPMULHRSW is (a * b + 2^14) >> 15, which is Rounding::NEAREST. Its one
+// overflow, -1 * -1, gives 0x8000, which no other product gives; flipping
+// its bits saturates it to 0x7FFF
+__attribute__((target("avx2")))
+void multiplyAvx2(const int16_t* a, const int16_t* b, int16_t* out, size_t count) {
+    const __m256i overflow = _mm256_set1_epi16(INT16_MIN);
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        const __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        const __m256i product = _mm256_mulhrs_epi16(x, y);
+        const __m256i fixed = _mm256_xor_si256(product, _mm256_cmpeq_epi16(product, overflow));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), fixed);
+    }
+    multiplyScalar(reinterpret_cast<const Q15*>(a + i), reinterpret_cast<const Q15*>(b + i),
+                   reinterpret_cast<Q15*>(out + i), count - i);
+}
+
+// VPMADDWD sums pairs of products into 32 bits. Only two -1 * -1 products
+// reach 2^31, which wraps to INT32_MIN and which no other pair gives; those
+// are counted and given back their 2^32 at the end. The pair sums widen to
+// 64 bits before they accumulate.
+__attribute__((target("avx2")))
+int64_t dotAvx2(const int16_t* a, const int16_t* b, size_t count) {
+    const __m256i wrapped = _mm256_set1_epi32(INT32_MIN);
+    __m256i totals = _mm256_setzero_si256();
+    __m256i wraps = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        const __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+        const __m256i pairs = _mm256_madd_epi16(x, y);
+        wraps = _mm256_sub_epi32(wraps, _mm256_cmpeq_epi32(pairs, wrapped));
+        totals = _mm256_add_epi64(totals, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(pairs)));
+        totals = _mm256_add_epi64(totals, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(pairs, 1)));
+    }
+    int64_t lanes[4];
+    int32_t wrapCounts[8];
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), totals);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(wrapCounts), wraps);
+    int64_t total = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    for (int32_t wrapCount : wrapCounts) {
+        total += static_cast<int64_t>(wrapCount) << 32;
+    }
+    return total + dotScalar(a + i, b + i, count - i);
+}
+#endif
+
+} // namespace
+
+// ==================== Bulk Kernels ====================
+
+void multiplyArray(const Q15* a, const Q15* b, Q15* out, size_t count) {
+#if HOLYC_X86_DISPATCH
+    if (bits::cpuHasAvx2()) {
+        return multiplyAvx2(rawOf(a), rawOf(b), rawOf(out), count);
+    }
+#endif
+    multiplyScalar(a, b, out, count);
+}
+
+Q15Accumulator dot(const Q15* a, const Q15* b, size_t count) {
+#if HOLYC_X86_DISPATCH
+    if (bits::cpuHasAvx2()) {
+        return Q15Accumulator::from_bits(dotAvx2(rawOf(a), rawOf(b), count));
+    }
+#endif
+    return Q15Accumulator::from_bits(dotScalar(rawOf(a), rawOf(b), count));
+}
+
+} // namespace holycpp
@@ -0,0 +1,320 @@
+#pragma once
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include "signed_int.hpp"
+#include "float.hpp"
+#include "array.hpp"
+
+namespace holycpp {
+
+// ==================== Fixed Point ====================
+// Q-format numbers: an SInt or UInt whose low FracBits bits are the
+// fraction, so the value is raw() / 2^FracBits. Fixed<IntBits, FracBits> is
+// signed with the sign bit counted in IntBits (Fixed<1, 15> is Q15);
+// UFixed is unsigned. IntBits + FracBits must be 8, 16, 32 or 64.
+//
+// + and - are the integer's own operators. * and / work at twice the width
+// (__int128 for 64-bit values), round as Round says, and fit the result
+// back through the integer's Policy: Basic wraps, Saturating clamps,
+// Trapping throws. Conversions from floats, integers and other fixed-point
+// types clamp under Saturating and otherwise throw std::out_of_range, as
+// the SInt/UInt constructors do.
+enum class Rounding : uint8_t {
+    TRUNCATE,       // Toward -infinity: the dropped bits are discarded
+    NEAREST,        // Halfway rounds up, as DSP rounding multiplies do
+    NEAREST_EVEN    // Halfway rounds to the even neighbour
+};
+
+namespace fixedpoint {
+
+using Int128 = __int128;
+
+// Products and quotients are computed in this
+template<typename T>
+using Wide = std::conditional_t<(sizeof(T) < 8),
+    std::conditional_t<std::is_signed_v<T>, int64_t, uint64_t>,
+    std::conditional_t<std::is_signed_v<T>, __int128, unsigned __int128>>;
+
+// value / 2^shift, rounded
+template<Rounding Round, typename W>
+constexpr W shiftRound(W value, unsigned shift) {
+    if (shift == 0) {
+        return value;
+    }
+    const W quotient = value >> shift;   // Arithmetic shift: floor
+    if constexpr (Round == Rounding::TRUNCATE) {
+        return quotient;
+    }
+    const W remainder = value & ((W(1) << shift) - 1);
+    const W half = W(1) << (shift - 1);
+    if constexpr (Round == Rounding::NEAREST) {
+        return quotient + (remainder >= half ? 1 : 0);
+    }
+    return quotient + (remainder > half || (remainder == half && (quotient & 1)) ? 1 : 0);
+}
+
+// numerator / divisor for a non-zero divisor, rounded. T is the storage
+// type, which says whether W is signed
+template<Rounding Round, typename T, typename W>
+constexpr W divideRound(W numerator, W divisor) {
+    if constexpr (std::is_signed_v<T>) {
+        if (divisor < 0) {
+            numerator = -numerator;
+            divisor = -divisor;
+        }
+    }
+    W quotient = numerator / divisor;
+    W remainder = numerator % divisor;
+    if constexpr (std::is_signed_v<T>) {
+        if (remainder < 0) {   // Floor, leaving remainder in [0, divisor)
+            --quotient;
+            remainder += divisor;
+        }
+    }
+    if constexpr (Round == Rounding::TRUNCATE) {
+        return quotient;
+    }
+    const W twice = remainder * 2;
+    if constexpr (Round == Rounding::NEAREST) {
+        return quotient + (twice >= divisor ? 1 : 0);
+    }
+    return quotient + (twice > divisor || (twice == divisor && (quotient & 1)) ? 1 : 0);
+}
+
+// value * 2^FracBits rounded to an integer; not range checked
+template<Rounding Round, typename F>
+F scaleRound(F value, size_t fracBits) {
+    const F scaled = std::ldexp(value, static_cast<int>(fracBits));
+    if constexpr (Round == Rounding::TRUNCATE) {
+        return std::floor(scaled);
+    } else if constexpr (Round == Rounding::NEAREST) {
+        const F floor = std::floor(scaled);
+        return scaled - floor >= F(0.5) ? floor + 1 : floor;   // scaled + 0.5 could round up
+    } else {
+        return std::nearbyint(scaled);
+    }
+}
+
+} // namespace fixedpoint
+
+template<typename Integer, size_t FracBits, Rounding Round>
+class FixedPoint {
+public:
+    using integer_type = Integer;
+    using storage_type = typename Integer::storage_type;
+    using policy_type = typename Integer::policy_type;
+
+    static constexpr size_t BITS = Integer::BITS;
+    static constexpr size_t FRAC_BITS = FracBits;
+    static constexpr size_t INT_BITS = BITS - FracBits;
+    static constexpr Rounding ROUNDING = Round;
+
+    static_assert(BITS == 8 || BITS == 16 || BITS == 32 || BITS == 64, "Fixed-point types are 8, 16, 32 or 64 bits");
+    static_assert(FracBits < BITS, "Fixed-point types need at least one integer or sign bit");
+
+private:
+    Integer value;
+
+    using Wide = fixedpoint::Wide<storage_type>;
+    using Int128 = fixedpoint::Int128;
+
+    static constexpr bool SATURATING = std::is_same_v<policy_type, checking::Saturating>;
+
+    // Raw value for an out-of-range conversion
+    static storage_type outOfRange(bool negative) {
+        if constexpr (SATURATING) {
+            return negative ? std::numeric_limits<storage_type>::min() : std::numeric_limits<storage_type>::max();
+        }
+        throw std::out_of_range("Value out of range for this fixed-point type");
+    }
+
+    static storage_type fromExact(Int128 raw) {
+        if (!checking::detail::fits<storage_type>(raw)) {
+            return outOfRange(raw < 0);
+        }
+        return static_cast<storage_type>(raw);
+    }
+
+    template<typename T>
+    static storage_type fromInteger(T val) {
+        // Compared before scaling, so that nothing overflows
+        const Int128 lowest = Int128(std::numeric_limits<storage_type>::min()) >> FracBits;
+        const Int128 highest = Int128(std::numeric_limits<storage_type>::max()) >> FracBits;
+        if (Int128(val) < lowest || Int128(val) > highest) {
+            return outOfRange(Int128(val) < 0);
+        }
+        return static_cast<storage_type>(Int128(val) * (Int128(1) << FracBits));
+    }
+
+    template<typename F>
+    static storage_type fromFloating(F val) {
+        if (std::isnan(val)) {
+            if constexpr (SATURATING) {
+                return 0;
+            }
+            throw std::out_of_range("NaN has no fixed-point value");
+        }
+        const F rounded = fixedpoint::scaleRound<Round>(val, FracBits);
+        const F limit = std::ldexp(F(1), static_cast<int>(std::is_signed_v<storage_type> ? BITS - 1 : BITS));
+        const F lowest = std::is_signed_v<storage_type> ? -limit : F(0);
+        if (rounded < lowest || rounded >= limit) {   // Also catches infinities
+            return outOfRange(rounded < 0);
+        }
+        if constexpr (std::is_signed_v<storage_type>) {
+            return static_cast<storage_type>(static_cast<int64_t>(rounded));
+        }
+        return static_cast<storage_type>(static_cast<uint64_t>(rounded));
+    }
+
+    explicit FixedPoint(const Integer& integer) : value(integer) {}
+
+public:
+    // Constructors
+    FixedPoint() : value() {}
+
+    FixedPoint(float val) : value(fromFloating(val)) {}
+    FixedPoint(double val) : value(fromFloating(val)) {}
+    FixedPoint(const F32& other) : FixedPoint(other.raw()) {}
+    FixedPoint(const F64& other) : FixedPoint(other.raw()) {}
+
+    template<typename T, typename = std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool>>>
+    FixedPoint(T val) : value(fromInteger(val)) {}
+
+    // From another fixed-point type, rounding away fraction bits as this
+    // type's Round says
+    template<typename OtherInteger, size_t OtherFracBits, Rounding OtherRound>
+    FixedPoint(const FixedPoint<OtherInteger, OtherFracBits, OtherRound>& other) {
+        Int128 raw = other.raw();
+        if constexpr (OtherFracBits > FracBits) {
+            raw = fixedpoint::shiftRound<Round>(raw, OtherFracBits - FracBits);
+        } else {
+            raw *= Int128(1) << (FracBits - OtherFracBits);
+        }
+        value = Integer(fromExact(raw));
+    }
+
+    static FixedPoint from_bits(storage_type raw) { return FixedPoint(Integer(raw)); }
+
+    // Limits
+    static FixedPoint max() { return from_bits(std::numeric_limits<storage_type>::max()); }
+    static FixedPoint lowest() { return from_bits(std::numeric_limits<storage_type>::min()); }
+    static FixedPoint epsilon() { return from_bits(1); }
+
+    // Conversion to floating point; F64 is exact up to 53 significant bits
+    F32 to_f32() const { return F32(std::ldexp(static_cast<float>(raw()), -static_cast<int>(FracBits))); }
+    F64 to_f64() const { return F64(std::ldexp(static_cast<double>(raw()), -static_cast<int>(FracBits))); }
+    explicit operator double() const { return to_f64().raw(); }
+    explicit operator float() const { return to_f32().raw(); }
+
+    // The integer part, rounded toward -infinity
+    storage_type integer_part() const { return static_cast<storage_type>(raw() >> FracBits); }
+
+    // Get raw value and the underlying integer
+    storage_type raw() const { return value.raw(); }
+    const Integer& bits() const { return value; }
+
+    // Arithmetic operators
+    FixedPoint operator+(const FixedPoint& other) const { return FixedPoint(value + other.value); }
+    FixedPoint operator-(const FixedPoint& other) const { return FixedPoint(value - other.value); }
+    FixedPoint operator-() const { return FixedPoint(-value); }
+
+    FixedPoint operator*(const FixedPoint& other) const {
+        const Wide product = static_cast<Wide>(raw()) * static_cast<Wide>(other.raw());
+        return from_bits(policy_type::template narrow<storage_type>(
+            fixedpoint::shiftRound<Round>(product, FracBits), checking::Fault::MUL_OVERFLOW));
+    }
+
+    FixedPoint operator/(const FixedPoint& other) const {
+        if (other.raw() == 0) {
+            return FixedPoint(value / other.value);   // The policy's division by zero
+        }
+        const Wide numerator = static_cast<Wide>(raw()) * (Wide(1) << FracBits);
+        return from_bits(policy_type::template narrow<storage_type>(
+            fixedpoint::divideRound<Round, storage_type>(numerator, static_cast<Wide>(other.raw())),
+            checking::Fault::DIVISION_OVERFLOW));
+    }
+
+    // Compound assignment
+    FixedPoint& operator+=(const FixedPoint& other) { return *this = *this + other; }
+    FixedPoint& operator-=(const FixedPoint& other) { return *this = *this - other; }
+    FixedPoint& operator*=(const FixedPoint& other) { return *this = *this * other; }
+    FixedPoint& operator/=(const FixedPoint& other) { return *this = *this / other; }
+
+    // Comparison operators
+    bool operator==(const FixedPoint& other) const { return value == other.value; }
+    bool operator!=(const FixedPoint& other) const { return value != other.value; }
+    bool operator<(const FixedPoint& other) const { return value < other.value; }
+    bool operator<=(const FixedPoint& other) const { return value <= other.value; }
+    bool operator>(const FixedPoint& other) const { return value > other.value; }
+    bool operator>=(const FixedPoint& other) const { return value >= other.value; }
+
+    bool is_zero() const { return raw() == 0; }
+    bool is_negative() const { return checking::detail::isNegative(raw()); }
+
+    // HolyC-style methods
+    void Print() const {
+        std::cout << to_f64() << std::endl;
+    }
+
+    // Stream output
+    friend std::ostream& operator<<(std::ostream& os, const FixedPoint& val) {
+        return os << val.to_f64();
+    }
+};
+
+template<size_t IntBits, size_t FracBits, Rounding Round = Rounding::NEAREST, typename Policy = checking::Default>
+using Fixed = FixedPoint<SInt<IntBits + FracBits, Policy>, FracBits, Round>;
+
+template<size_t IntBits, size_t FracBits, Rounding Round = Rounding::NEAREST, typename Policy = checking::Default>
+using UFixed = FixedPoint<UInt<IntBits + FracBits, Policy>, FracBits, Round>;
+
+// Clamps instead of wrapping or throwing
+template<size_t IntBits, size_t FracBits, Rounding Round = Rounding::NEAREST>
+using SatFixed = Fixed<IntBits, FracBits, Round, checking::Saturating>;
+
+// Concrete fixed-point types. Q15 and Q31 saturate, as the DSP
+// instructions they model do; Q15Accumulator holds exact sums of Q15
+// products (30 fraction bits)
+using Q15 = SatFixed<1, 15>;
+using Q31 = SatFixed<1, 31>;
+using Q16_16 = Fixed<16, 16>;
+using Q15Accumulator = SatFixed<34, 30>;
+
+template<typename T>
+struct is_fixed_holyc : std::false_type {};
+
+template<typename I, size_t F, Rounding R> struct is_fixed_holyc<FixedPoint<I, F, R>> : std::true_type {};
+
+template<typename T>
+inline constexpr bool is_fixed_holyc_v = is_fixed_holyc<T>::value;
+
+// ==================== Bulk Kernels ====================
+// Q15 loops for DSP code. On x86-64 with AVX2 they take 16 values a step
+// (VPMULHRSW for products, VPMADDWD for sums of products); other CPUs run
+// the scalar operators. Every path gives the same bits.
+void multiplyArray(const Q15* a, const Q15* b, Q15* out, size_t count);
+
+// Sum of a[i] * b[i] without rounding; exact below 2^33 terms
+Q15Accumulator dot(const Q15* a, const Q15* b, size_t count);
+
+// Over an Array, HeapArray or Slice; the lengths must match
+inline void multiplyArray(Slice<const Q15> a, Slice<const Q15> b, Slice<Q15> out) {
+    if (a.size() != b.size() || a.size() != out.size()) {
+        throw std::invalid_argument("multiplyArray: slices differ in length");
+    }
+    multiplyArray(a.data(), b.data(), out.data(), a.size());
+}
+
+inline Q15Accumulator dot(Slice<const Q15> a, Slice<const Q15> b) {
+    if (a.size() != b.size()) {
+        throw std::invalid_argument("dot: slices differ in length");
+    }
+    return dot(a.data(), b.data(), a.size());
+}
+
+} // namespace holycpp
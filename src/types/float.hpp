@@ -5,16 +5,16 @@
 #include <stdexcept>
 #include <limits>
 #include <cmath>
+#include "checking.hpp"
 
 namespace holycpp {
 
-// Forward declarations
-template<size_t> class UInt;
-template<size_t> class SInt;
-
 // Base floating-point type
 template<size_t Bits>
 class FInt {
+    static_assert(Bits == 32 || Bits == 64,
+                  "FInt is 32 or 64 bits; F16 and BF16 are in half.hpp");
+
 public:
     using storage_type = 
         std::conditional_t<Bits == 32, float,
@@ -40,12 +40,12 @@ public:
     FInt(const FInt<OtherBits>& other) : value(static_cast<storage_type>(other.raw())) {}
     
     // From unsigned integer types
-    template<size_t OtherBits>
-    FInt(const UInt<OtherBits>& other) : value(static_cast<storage_type>(other.raw())) {}
+    template<size_t OtherBits, typename Policy>
+    FInt(const UInt<OtherBits, Policy>& other) : value(static_cast<storage_type>(other.raw())) {}
     
     // From signed integer types
-    template<size_t OtherBits>
-    FInt(const SInt<OtherBits>& other) : value(static_cast<storage_type>(other.raw())) {}
+    template<size_t OtherBits, typename Policy>
+    FInt(const SInt<OtherBits, Policy>& other) : value(static_cast<storage_type>(other.raw())) {}
     
     // From fundamental floating-point and integral types
     template<typename T, typename = std::enable_if_t<std::is_arithmetic_v<T> && !std::is_same_v<T, storage_type>>>
@@ -162,6 +162,10 @@ public:
     FInt abs() const { return FInt(std::abs(value)); }
     FInt sqrt() const { return FInt(std::sqrt(value)); }
     FInt pow(const FInt& exponent) const { return FInt(std::pow(value, exponent.value)); }
+    // this * multiplier + addend with a single rounding
+    FInt fma(const FInt& multiplier, const FInt& addend) const {
+        return FInt(std::fma(value, multiplier.value, addend.value));
+    }
     FInt sin() const { return FInt(std::sin(value)); }
     FInt cos() const { return FInt(std::cos(value)); }
     FInt tan() const { return FInt(std::tan(value)); }
@@ -0,0 +1,274 @@
+#include "half.hpp"
+#include "bits.hpp"
+
+#if HOLYC_X86_DISPATCH
+#include <immintrin.h>
+#endif
+
+namespace holycpp {
+
+static_assert(sizeof(F16) == 2 && sizeof(BF16) == 2 && std::is_standard_layout_v<F16>,
+              "Arrays of 16-bit floats are converted as arrays of their bits");
+
+namespace {
+
+using namespace halfbits;
+
+// ==================== Scalar Loops ====================
+
+template<typename Format>
+void widenScalar(const uint16_t* in, float* out, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = Format::toFloat(in[i]);
+    }
+}
+
+template<typename Format>
+void widenScalar(const uint16_t* in, double* out, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = Format::toFloat(in[i]);
+    }
+}
+
+template<typename Format>
+void narrowScalar(const float* in, uint16_t* out, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = Format::fromFloat(in[i]);
+    }
+}
+
+template<typename Format>
+void narrowScalar(const double* in, uint16_t* out, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = Format::fromDouble(in[i]);
+    }
+}
+
+#if HOLYC_X86_DISPATCH
+// ==================== AVX2 Kernels ====================
+// F16 uses the F16C conversions; BF16 is integer shifts and adds. Doubles
+// narrow four at a time: VCVTPD2PS, then the round-to-odd fix-up of
+// roundToOddFloat(), then the 16-bit rounding. Tails run the scalar code.
+constexpr int NEAREST = _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC;
+
+__attribute__((target("avx2"))) inline __m128i narrowMask(__m256d mask) {
+    const __m256i evens = _mm256_setr_epi32(0, 2, 4, 6, 0, 0, 0, 0);
+    return _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(_mm256_castpd_si256(mask), evens));
+}
+
+__attribute__((target("avx2"))) inline __m128 roundToOdd(__m256d value) {
+    const __m128 narrowed = _mm256_cvtpd_ps(value);
+    const __m256d back = _mm256_cvtps_pd(narrowed);
+    const __m256d sign = _mm256_set1_pd(-0.0);
+    const __m128i inexact = narrowMask(_mm256_cmp_pd(back, value, _CMP_NEQ_OQ));
+    const __m128i up = narrowMask(_mm256_cmp_pd(_mm256_andnot_pd(sign, value), _mm256_andnot_pd(sign, back), _CMP_GT_OQ));
+
+    const __m128i one = _mm_set1_epi32(1);
+    const __m128i bits = _mm_castps_si128(narrowed);
+    const __m128i even = _mm_cmpeq_epi32(_mm_and_si128(bits, one), _mm_setzero_si128());
+    const __m128i step = _mm_sub_epi32(_mm_and_si128(up, _mm_set1_epi32(2)), one);   // +1 or -1
+    return _mm_castsi128_ps(_mm_add_epi32(bits, _mm_and_si128(_mm_and_si128(inexact, even), step)));
+}
+
+// floatToBF16() on four floats, as 32-bit lanes
+__attribute__((target("avx2"))) inline __m128i toBF16(__m128 value) {
+    const __m128i x = _mm_castps_si128(value);
+    const __m128i odd = _mm_and_si128(_mm_srli_epi32(x, 16), _mm_set1_epi32(1));
+    const __m128i rounded = _mm_srli_epi32(_mm_add_epi32(x, _mm_add_epi32(odd, _mm_set1_epi32(0x7FFF))), 16);
+    const __m128i quiet = _mm_or_si128(_mm_srli_epi32(x, 16), _mm_set1_epi32(0x40));
+    const __m128i isNaN = _mm_cmpgt_epi32(_mm_and_si128(x, _mm_set1_epi32(0x7FFFFFFF)), _mm_set1_epi32(0x7F800000));
+    return _mm_blendv_epi8(rounded, quiet, isNaN);
+}
+
+__attribute__((target("avx2"))) inline __m256i toBF16(__m256 value) {
+    const __m256i x = _mm256_castps_si256(value);
+    const __m256i odd = _mm256_and_si256(_mm256_srli_epi32(x, 16), _mm256_set1_epi32(1));
+    const __m256i rounded = _mm256_srli_epi32(_mm256_add_epi32(x, _mm256_add_epi32(odd, _mm256_set1_epi32(0x7FFF))), 16);
+    const __m256i quiet = _mm256_or_si256(_mm256_srli_epi32(x, 16), _mm256_set1_epi32(0x40));
+    const __m256i isNaN = _mm256_cmpgt_epi32(_mm256_and_si256(x, _mm256_set1_epi32(0x7FFFFFFF)),
+                                             _mm256_set1_epi32(0x7F800000));
+    return _mm256_blendv_epi8(rounded, quiet, isNaN);
+}
+
+__attribute__((target("avx2,f16c")))
+void f16ToF32Avx2(const uint16_t* in, float* out, size_t count) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m128i half = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        _mm256_storeu_ps(out + i, _mm256_cvtph_ps(half));
+    }
+    widenScalar<Binary16>(in + i, out + i, count - i);
+}
+
+__attribute__((target("avx2,f16c")))
+void f16ToF64Avx2(const uint16_t* in, double* out, size_t count) {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m128i half = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(in + i));
+        _mm256_storeu_pd(out + i, _mm256_cvtps_pd(_mm_cvtph_ps(half)));
+    }
+    widenScalar<Binary16>(in + i, out + i, count - i);
+}
+
+__attribute__((target("avx2,f16c")))
+void f32ToF16Avx2(const float* in, uint16_t* out, size_t count) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m128i half = _mm256_cvtps_ph(_mm256_loadu_ps(in + i), NEAREST);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), half);
+    }
+    narrowScalar<Binary16>(in + i, out + i, count - i);
+}
+
+__attribute__((target("avx2,f16c")))
+void f64ToF16Avx2(const double* in, uint16_t* out, size_t count) {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m128i half = _mm_cvtps_ph(roundToOdd(_mm256_loadu_pd(in + i)), NEAREST);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(out + i), half);
+    }
+    narrowScalar<Binary16>(in + i, out + i, count - i);
+}
+
+__attribute__((target("avx2")))
+void bf16ToF32Avx2(const uint16_t* in, float* out, size_t count) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m256i wide = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i)));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_slli_epi32(wide, 16));
+    }
+    widenScalar<BFloat16>(in + i, out + i, count - i);
+}
+
+__attribute__((target("avx2")))
+void bf16ToF64Avx2(const uint16_t* in, double* out, size_t count) {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m128i wide = _mm_cvtepu16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(in + i)));
+        _mm256_storeu_pd(out + i, _mm256_cvtps_pd(_mm_castsi128_ps(_mm_slli_epi32(wide, 16))));
+    }
+    widenScalar<BFloat16>(in + i, out + i, count - i);
+}
+
+__attribute__((target("avx2")))
+void f32ToBF16Avx2(const float* in, uint16_t* out, size_t count) {
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        const __m256i low = toBF16(_mm256_loadu_ps(in + i));
+        const __m256i high = toBF16(_mm256_loadu_ps(in + i + 8));
+        // PACKUSDW packs within 128-bit lanes; put the quarters back in order
+        const __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(low, high), _MM_SHUFFLE(3, 1, 2, 0));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), packed);
+    }
+    narrowScalar<BFloat16>(in + i, out + i, count - i);
+}
+
+__attribute__((target("avx2")))
+void f64ToBF16Avx2(const double* in, uint16_t* out, size_t count) {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m128i wide = toBF16(roundToOdd(_mm256_loadu_pd(in + i)));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(out + i), _mm_packus_epi32(wide, wide));
+    }
+    narrowScalar<BFloat16>(in + i, out + i, count - i);
+}
+
+bool useF16c() {
+    return bits::cpuHasAvx2() && bits::cpuHasF16c();
+}
+
+bool useAvx2() {
+    return bits::cpuHasAvx2();
+}
+#endif
+
+const uint16_t* bitsOf(const F16* values) { return reinterpret_cast<const uint16_t*>(values); }
+const uint16_t* bitsOf(const BF16* values) { return reinterpret_cast<const uint16_t*>(values); }
+uint16_t* bitsOf(F16* values) { return reinterpret_cast<uint16_t*>(values); }
+uint16_t* bitsOf(BF16* values) { return reinterpret_cast<uint16_t*>(values); }
+const float* rawOf(const F32* values) { return reinterpret_cast<const float*>(values); }
+const double* rawOf(const F64* values) { return reinterpret_cast<const double*>(values); }
+float* rawOf(F32* values) { return reinterpret_cast<float*>(values); }
+double* rawOf(F64* values) { return reinterpret_cast<double*>(values); }
+
+} // namespace
+
+// ==================== Bulk Conversion ====================
+
+void convertArray(const F16* in, F32* out, size_t count) {
+#if HOLYC_X86_DISPATCH
+    if (useF16c()) {
+        return f16ToF32Avx2(bitsOf(in), rawOf(out), count);
+    }
+#endif
+    widenScalar<Binary16>(bitsOf(in), rawOf(out), count);
+}
+
+void convertArray(const F16* in, F64* out, size_t count) {
+#if HOLYC_X86_DISPATCH
+    if (useF16c()) {
+        return f16ToF64Avx2(bitsOf(in), rawOf(out), count);
+    }
+#endif
+    widenScalar<Binary16>(bitsOf(in), rawOf(out), count);
+}
+
+void convertArray(const F32* in, F16* out, size_t count) {
+#if HOLYC_X86_DISPATCH
+    if (useF16c()) {
+        return f32ToF16Avx2(rawOf(in), bitsOf(out), count);
+    }
+#endif
+    narrowScalar<Binary16>(rawOf(in), bitsOf(out), count);
+}
+
+void convertArray(const F64* in, F16* out, size_t count) {
+#if HOLYC_X86_DISPATCH
+    if (useF16c()) {
+        return f64ToF16Avx2(rawOf(in), bitsOf(out), count);
+    }
+#endif
+    narrowScalar<Binary16>(rawOf(in), bitsOf(out), count);
+}
+
+void convertArray(const BF16* in, F32* out, size_t count) {
+#if HOLYC_X86_DISPATCH
+    if (useAvx2()) {
+        return bf16ToF32Avx2(bitsOf(in), rawOf(out), count);
+    }
+#endif
+    widenScalar<BFloat16>(bitsOf(in), rawOf(out), count);
+}
+
+void convertArray(const BF16* in, F64* out, size_t count) {
+#if HOLYC_X86_DISPATCH
+    if (useAvx2()) {
+        return bf16ToF64Avx2(bitsOf(in), rawOf(out), count);
+    }
+#endif
+    widenScalar<BFloat16>(bitsOf(in), rawOf(out), count);
+}
+
+void convertArray(const F32* in, BF16* out, size_t count) {
+#if HOLYC_X86_DISPATCH
+    if (useAvx2()) {
+        return f32ToBF16Avx2(rawOf(in), bitsOf(out), count);
+    }
+#endif
+    narrowScalar<BFloat16>(rawOf(in), bitsOf(out), count);
+}
+
+void convertArray(const F64* in, BF16* out, size_t count) {
+#if HOLYC_X86_DISPATCH
+    if (useAvx2()) {
+        return f64ToBF16Avx2(rawOf(in), bitsOf(out), count);
+    }
+#endif
+    narrowScalar<BFloat16>(rawOf(in), bitsOf(out), count);
+}
+
+// Explicit template instantiations
+template class HalfFloat<halfbits::Binary16>;
+template class HalfFloat<halfbits::BFloat16>;
+
+} // namespace holycpp
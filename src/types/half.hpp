@@ -0,0 +1,250 @@
+#pragma once
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include "float.hpp"
+
+namespace holycpp {
+
+// ==================== 16-bit Float Formats ====================
+// IEEE binary16 (F16: 5 exponent bits, 10 fraction bits) and bfloat16
+// (BF16: the top half of an F32, 8 exponent bits, 7 fraction bits).
+// Narrowing rounds to nearest-even and overflows to infinity. Both
+// directions quiet NaNs but keep their sign and top payload bits, as
+// VCVTPH2PS/VCVTPS2PH do.
+namespace halfbits {
+
+inline uint32_t floatBits(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+inline float bitsFloat(uint32_t bits) {
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+inline float f16ToFloat(uint16_t h) {
+    const uint32_t sign = static_cast<uint32_t>(h & 0x8000) << 16;
+    const uint32_t magnitude = h & 0x7FFF;
+    if (magnitude == 0x7C00) {
+        return bitsFloat(sign | 0x7F800000);
+    }
+    if (magnitude > 0x7C00) {
+        return bitsFloat(sign | 0x7FC00000 | ((magnitude & 0x3FF) << 13));   // Quiet NaN
+    }
+    if (magnitude >= 0x0400) {
+        return bitsFloat(sign | ((magnitude << 13) + 0x38000000));   // Rebias 15 -> 127
+    }
+    const float subnormal = static_cast<float>(magnitude) * bitsFloat(0x33800000);   // * 2^-24, exact
+    return bitsFloat(sign | floatBits(subnormal));
+}
+
+inline uint16_t floatToF16(float value) {
+    uint32_t x = floatBits(value);
+    const uint32_t sign = (x >> 16) & 0x8000;
+    x &= 0x7FFFFFFF;
+    if (x >= 0x7F800000) {
+        return static_cast<uint16_t>(sign | (x > 0x7F800000 ? 0x7E00 | ((x >> 13) & 0x3FF) : 0x7C00));
+    }
+    if (x >= 0x477FF000) {
+        return static_cast<uint16_t>(sign | 0x7C00);   // 65520 and up round to infinity
+    }
+    if (x < 0x38800000) {
+        // Below 2^-14 the result is subnormal: adding 0.5 lines the F16 ulp
+        // up with the F32 ulp, and the FPU does the rounding
+        const float shifted = bitsFloat(x) + 0.5f;
+        return static_cast<uint16_t>(sign | (floatBits(shifted) - 0x3F000000));
+    }
+    // Rebias 127 -> 15 and round on the 13 dropped bits; a carry out of the
+    // fraction correctly bumps the exponent
+    x += 0xC8000FFF + ((x >> 13) & 1);
+    return static_cast<uint16_t>(sign | (x >> 13));
+}
+
+inline float bf16ToFloat(uint16_t b) {
+    return bitsFloat(static_cast<uint32_t>(b) << 16);
+}
+
+inline uint16_t floatToBF16(float value) {
+    const uint32_t x = floatBits(value);
+    if ((x & 0x7FFFFFFF) > 0x7F800000) {
+        return static_cast<uint16_t>((x >> 16) | 0x40);
+    }
+    return static_cast<uint16_t>((x + 0x7FFF + ((x >> 16) & 1)) >> 16);
+}
+
+// Rounds to F32 with round-to-odd: an inexact result gets an odd last bit.
+// Rounding that to nearest-even at 16 bits equals rounding the double
+// directly, since F32 keeps more than two extra bits for either format.
+// Rounding through a plain F32 would round twice and can be off by one ulp.
+inline float roundToOddFloat(double value) {
+    float narrowed = static_cast<float>(value);
+    const double back = narrowed;
+    if (back != value && !std::isnan(value) && (floatBits(narrowed) & 1) == 0) {
+        const uint32_t bits = floatBits(narrowed) + (std::fabs(value) > std::fabs(back) ? 1 : uint32_t(-1));
+        narrowed = bitsFloat(bits);
+    }
+    return narrowed;
+}
+
+inline uint16_t doubleToF16(double value) { return floatToF16(roundToOddFloat(value)); }
+inline uint16_t doubleToBF16(double value) { return floatToBF16(roundToOddFloat(value)); }
+
+struct Binary16 {
+    static float toFloat(uint16_t bits) { return f16ToFloat(bits); }
+    static uint16_t fromFloat(float value) { return floatToF16(value); }
+    static uint16_t fromDouble(double value) { return doubleToF16(value); }
+};
+
+struct BFloat16 {
+    static float toFloat(uint16_t bits) { return bf16ToFloat(bits); }
+    static uint16_t fromFloat(float value) { return floatToBF16(value); }
+    static uint16_t fromDouble(double value) { return doubleToBF16(value); }
+};
+
+} // namespace halfbits
+
+// 16-bit storage; arithmetic widens to F32 and rounds the result back.
+// For +, -, * and / that single rounding is exact: F32 carries more than
+// twice the bits of either format, so the F32 result rounds to the same
+// value as an infinitely precise one would.
+template<typename Format>
+class HalfFloat {
+public:
+    using storage_type = uint16_t;
+
+private:
+    storage_type bits;
+
+    struct FromBits {};
+    HalfFloat(storage_type raw, FromBits) : bits(raw) {}
+
+public:
+    static constexpr size_t BITS = 16;
+
+    // Constructors
+    HalfFloat() : bits(0) {}
+
+    HalfFloat(float val) : bits(Format::fromFloat(val)) {}
+    HalfFloat(double val) : bits(Format::fromDouble(val)) {}
+
+    template<typename T, typename = std::enable_if_t<std::is_arithmetic_v<T> &&
+        !std::is_same_v<T, float> && !std::is_same_v<T, double>>>
+    HalfFloat(T val) : HalfFloat(static_cast<double>(val)) {}
+
+    HalfFloat(const F32& other) : HalfFloat(other.raw()) {}
+    HalfFloat(const F64& other) : HalfFloat(other.raw()) {}
+
+    static HalfFloat from_bits(storage_type raw) { return HalfFloat(raw, FromBits{}); }
+
+    // Conversion to F32, which is exact
+    operator float() const { return Format::toFloat(bits); }
+    F32 to_f32() const { return F32(Format::toFloat(bits)); }
+    F64 to_f64() const { return F64(static_cast<double>(Format::toFloat(bits))); }
+
+    // Get raw bits
+    storage_type raw() const { return bits; }
+
+    // Arithmetic operators
+    HalfFloat operator+(const HalfFloat& other) const { return HalfFloat(float(*this) + float(other)); }
+    HalfFloat operator-(const HalfFloat& other) const { return HalfFloat(float(*this) - float(other)); }
+    HalfFloat operator*(const HalfFloat& other) const { return HalfFloat(float(*this) * float(other)); }
+    HalfFloat operator/(const HalfFloat& other) const {
+        if (other.is_zero()) {
+            throw std::domain_error("Division by zero");
+        }
+        return HalfFloat(float(*this) / float(other));
+    }
+    HalfFloat operator-() const { return from_bits(static_cast<storage_type>(bits ^ 0x8000)); }
+
+    // Arithmetic with built-in types
+    template<typename T, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+    HalfFloat operator+(T other) const { return *this + HalfFloat(other); }
+    template<typename T, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+    HalfFloat operator-(T other) const { return *this - HalfFloat(other); }
+    template<typename T, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+    HalfFloat operator*(T other) const { return *this * HalfFloat(other); }
+    template<typename T, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+    HalfFloat operator/(T other) const { return *this / HalfFloat(other); }
+
+    // Compound assignment
+    HalfFloat& operator+=(const HalfFloat& other) { return *this = *this + other; }
+    HalfFloat& operator-=(const HalfFloat& other) { return *this = *this - other; }
+    HalfFloat& operator*=(const HalfFloat& other) { return *this = *this * other; }
+    HalfFloat& operator/=(const HalfFloat& other) { return *this = *this / other; }
+
+    // Comparison operators - by value, so -0.0 == 0.0 and NaN != NaN
+    bool operator==(const HalfFloat& other) const { return float(*this) == float(other); }
+    bool operator!=(const HalfFloat& other) const { return float(*this) != float(other); }
+    bool operator<(const HalfFloat& other) const { return float(*this) < float(other); }
+    bool operator<=(const HalfFloat& other) const { return float(*this) <= float(other); }
+    bool operator>(const HalfFloat& other) const { return float(*this) > float(other); }
+    bool operator>=(const HalfFloat& other) const { return float(*this) >= float(other); }
+
+    // Comparison operators - with built-in types, at the other type's precision
+    template<typename T, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+    bool operator==(T other) const { return float(*this) == other; }
+    template<typename T, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+    bool operator!=(T other) const { return float(*this) != other; }
+    template<typename T, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+    bool operator<(T other) const { return float(*this) < other; }
+    template<typename T, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+    bool operator<=(T other) const { return float(*this) <= other; }
+    template<typename T, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+    bool operator>(T other) const { return float(*this) > other; }
+    template<typename T, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+    bool operator>=(T other) const { return float(*this) >= other; }
+
+    // Check for special values
+    bool is_nan() const { return std::isnan(float(*this)); }
+    bool is_inf() const { return std::isinf(float(*this)); }
+    bool is_finite() const { return std::isfinite(float(*this)); }
+    bool is_zero() const { return (bits & 0x7FFF) == 0; }
+
+    // HolyC-style methods
+    void Print() const {
+        std::cout << float(*this) << std::endl;
+    }
+
+    // Stream output
+    friend std::ostream& operator<<(std::ostream& os, const HalfFloat& val) {
+        return os << float(val);
+    }
+};
+
+// Concrete 16-bit types
+using F16 = HalfFloat<halfbits::Binary16>;
+using BF16 = HalfFloat<halfbits::BFloat16>;
+
+template<typename T>
+struct is_half_holyc : std::false_type {};
+
+template<typename Format> struct is_half_holyc<HalfFloat<Format>> : std::true_type {};
+
+template<typename T>
+inline constexpr bool is_half_holyc_v = is_half_holyc<T>::value;
+
+// ==================== Bulk Conversion ====================
+// Array conversions between the 16-bit types and F32/F64. On x86-64 with
+// F16C, F16 goes through VCVTPH2PS/VCVTPS2PH eight values at a time and
+// BF16 through AVX2 shifts and adds; other CPUs run the scalar functions
+// above. Every path gives the same bits as the scalar conversions.
+void convertArray(const F16* in, F32* out, size_t count);
+void convertArray(const F16* in, F64* out, size_t count);
+void convertArray(const F32* in, F16* out, size_t count);
+void convertArray(const F64* in, F16* out, size_t count);
+
+void convertArray(const BF16* in, F32* out, size_t count);
+void convertArray(const BF16* in, F64* out, size_t count);
+void convertArray(const F32* in, BF16* out, size_t count);
+void convertArray(const F64* in, BF16* out, size_t count);
+
+} // namespace holycpp
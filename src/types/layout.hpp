@@ -0,0 +1,289 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+
+namespace holycpp {
+
+// ==================== Field Slots ====================
+// Where a member lives. A plain member is one load of `size` bytes at
+// `offset`. A bit-field is one load of `size` bytes at `offset`, a shift
+// right by `bitOffset` and a mask of `bitWidth` bits.
+struct FieldSlot {
+    size_t offset = 0;
+    size_t size = 0;
+    uint8_t bitOffset = 0;
+    uint8_t bitWidth = 0;   // 0 for a plain member
+
+    constexpr bool isBitField() const { return bitWidth != 0; }
+};
+
+// ==================== Layout Builder ====================
+// Lays out members in declaration order.
+//   NATURAL  the C ABI rules: a member goes at the next multiple of its
+//            alignment; a bit-field shares the current unit of its type if
+//            it fits there and otherwise starts the next aligned unit
+//   PACKED   alignment 1: members go at the next byte and bit-fields at the
+//            next bit, as long as the field stays within one 8-byte load
+//   UNION    every member at offset 0
+// An explicit alignment raises a member's alignment in any mode, and a
+// zero-width bit-field closes the current unit. The record is padded so
+// that every load of a bit-field stays inside it.
+enum class LayoutMode : uint8_t {
+    NATURAL,
+    PACKED,
+    UNION
+};
+
+class LayoutBuilder {
+public:
+    constexpr explicit LayoutBuilder(LayoutMode mode = LayoutMode::NATURAL) : mode(mode) {}
+
+    constexpr FieldSlot member(size_t size, size_t align, size_t explicitAlign = 0) {
+        FieldSlot slot;
+        slot.size = size;
+        const size_t effective = effectiveAlign(align, explicitAlign);
+        if (mode != LayoutMode::UNION) {
+            slot.offset = alignUp((bitEnd + 7) / 8, effective);
+        }
+        bitEnd = mode == LayoutMode::UNION ? max(bitEnd, size * 8) : (slot.offset + size) * 8;
+        return slot;
+    }
+
+    // A bit-field of `width` bits over an integer of unitSize bytes
+    constexpr FieldSlot bitField(size_t unitSize, unsigned width, size_t explicitAlign = 0) {
+        if (unitSize != 1 && unitSize != 2 && unitSize != 4 && unitSize != 8) {
+            throw std::invalid_argument("Bit-fields need a U8..U64 or I8..I64 unit");
+        }
+        const uint64_t unitBits = unitSize * 8;
+        if (width > unitBits) {
+            throw std::invalid_argument("Bit-field is wider than its type");
+        }
+        const size_t effective = effectiveAlign(unitSize, explicitAlign);
+        uint64_t start = mode == LayoutMode::UNION ? 0 : bitEnd;
+        if (explicitAlign != 0) {
+            start = alignUp(start, explicitAlign * 8);
+        }
+
+        if (width == 0) {
+            if (mode != LayoutMode::UNION) {
+                bitEnd = alignUp(start, effective * 8);
+            }
+            return FieldSlot{};
+        }
+
+        FieldSlot slot;
+        if (mode == LayoutMode::PACKED) {
+            // Smallest load from the containing byte that covers the field
+            if (start % 8 + width > 64) {
+                start = alignUp(start, 8);
+            }
+            slot.offset = static_cast<size_t>(start / 8);
+            slot.bitOffset = static_cast<uint8_t>(start % 8);
+            slot.size = loadBytes((start % 8 + width + 7) / 8);
+        } else {
+            // The field may not straddle an aligned unit of its type
+            if (start / unitBits != (start + width - 1) / unitBits) {
+                start = alignUp(start, unitBits);
+            }
+            slot.offset = static_cast<size_t>(start / unitBits * unitSize);
+            slot.bitOffset = static_cast<uint8_t>(start % unitBits);
+            slot.size = unitSize;
+        }
+        slot.bitWidth = static_cast<uint8_t>(width);
+        loadEnd = max(loadEnd, slot.offset + slot.size);
+        bitEnd = mode == LayoutMode::UNION ? max(bitEnd, uint64_t(width)) : start + width;
+        return slot;
+    }
+
+    constexpr size_t size() const { return alignUp(max((bitEnd + 7) / 8, loadEnd), alignment); }
+    constexpr size_t align() const { return alignment; }
+
+private:
+    LayoutMode mode;
+    uint64_t bitEnd = 0;     // First bit after the last member; the extent for unions
+    size_t loadEnd = 0;      // First byte after the furthest bit-field load
+    size_t alignment = 1;
+
+    static constexpr uint64_t max(uint64_t a, uint64_t b) { return a < b ? b : a; }
+
+    static constexpr uint64_t alignUp(uint64_t value, uint64_t align) {
+        return align <= 1 ? value : (value + align - 1) / align * align;
+    }
+
+    static constexpr size_t loadBytes(uint64_t bytes) {
+        return bytes <= 1 ? 1 : bytes <= 2 ? 2 : bytes <= 4 ? 4 : 8;
+    }
+
+    constexpr size_t effectiveAlign(size_t natural, size_t explicitAlign) {
+        if (explicitAlign & (explicitAlign - 1)) {
+            throw std::invalid_argument("Alignment must be a power of two");
+        }
+        size_t effective = mode == LayoutMode::PACKED ? 1 : natural;
+        effective = static_cast<size_t>(max(effective, explicitAlign));
+        alignment = static_cast<size_t>(max(alignment, effective));
+        return effective;
+    }
+};
+
+// ==================== Compile-Time Class Layouts ====================
+// A HolyC class declaration as a list of field descriptors:
+//
+//   using Token = ClassLayout<LayoutMode::PACKED,
+//       Member<U32>,           // line
+//       BitField<U16, 12>,     // column
+//       BitField<U8, 4>,       // kind
+//       Member<F64, 8>>;       // value, explicitly 8-aligned
+//
+// Offsets are constants, so PackedRecord<Token>::get<0>() compiles to a
+// single load at a fixed offset.
+template<typename T, size_t Align = 0>
+struct Member {
+    using type = T;
+    static constexpr unsigned WIDTH = 0;
+    static constexpr size_t ALIGN = Align;
+};
+
+template<typename T, unsigned Width, size_t Align = 0>
+struct BitField {
+    using type = T;
+    static constexpr unsigned WIDTH = Width;
+    static constexpr size_t ALIGN = Align;
+    static_assert(Width > 0, "Use a zero-width bit-field only to close a unit");
+};
+
+namespace detail {
+
+// The builtin behind a HolyC type (UInt/SInt/FInt::storage_type), or T itself
+template<typename T, typename = void>
+struct RawOf { using type = T; };
+template<typename T>
+struct RawOf<T, std::void_t<typename T::storage_type>> { using type = typename T::storage_type; };
+
+template<size_t Bytes>
+using LoadType = std::conditional_t<Bytes == 1, uint8_t,
+                 std::conditional_t<Bytes == 2, uint16_t,
+                 std::conditional_t<Bytes == 4, uint32_t, uint64_t>>>;
+
+} // namespace detail
+
+template<LayoutMode Mode, typename... Fields>
+struct ClassLayout {
+    using fields = std::tuple<Fields...>;
+    static constexpr size_t COUNT = sizeof...(Fields);
+
+private:
+    struct Computed {
+        std::array<FieldSlot, sizeof...(Fields)> slots{};
+        size_t size = 0;
+        size_t align = 1;
+    };
+
+    template<typename F>
+    static constexpr FieldSlot place(LayoutBuilder& builder) {
+        using Raw = typename detail::RawOf<typename F::type>::type;
+        if constexpr (F::WIDTH == 0) {
+            return builder.member(sizeof(Raw), alignof(Raw), F::ALIGN);
+        } else {
+            static_assert(std::is_integral_v<Raw>, "Bit-fields need an integer type");
+            return builder.bitField(sizeof(Raw), F::WIDTH, F::ALIGN);
+        }
+    }
+
+    static constexpr Computed compute() {
+        LayoutBuilder builder(Mode);
+        Computed result;
+        size_t i = 0;
+        ((result.slots[i++] = place<Fields>(builder)), ...);
+        result.size = builder.size();
+        result.align = builder.align();
+        return result;
+    }
+
+    static constexpr Computed LAYOUT = compute();
+
+public:
+    static constexpr std::array<FieldSlot, sizeof...(Fields)> SLOTS = LAYOUT.slots;
+    static constexpr size_t SIZE = LAYOUT.size;
+    static constexpr size_t ALIGN = LAYOUT.align;
+
+    template<size_t I>
+    static constexpr FieldSlot slot() { return SLOTS[I]; }
+};
+
+// ==================== Packed Records ====================
+// Storage for one instance of a ClassLayout, exactly SIZE bytes
+template<typename Layout>
+class PackedRecord {
+public:
+    template<size_t I>
+    using field_type = typename std::tuple_element_t<I, typename Layout::fields>::type;
+
+    PackedRecord() : bytes{} {}
+
+    template<size_t I>
+    field_type<I> get() const {
+        using T = field_type<I>;
+        using Raw = typename detail::RawOf<T>::type;
+        constexpr FieldSlot slot = Layout::template slot<I>();
+        if constexpr (!slot.isBitField()) {
+            Raw raw;
+            std::memcpy(&raw, bytes + slot.offset, sizeof(Raw));
+            return T(raw);
+        } else {
+            using Unsigned = std::make_unsigned_t<Raw>;
+            constexpr Unsigned mask = fieldMask<Unsigned>(slot.bitWidth);
+            Unsigned bits = static_cast<Unsigned>(load<slot.size>(slot.offset) >> slot.bitOffset) & mask;
+            if constexpr (std::is_signed_v<Raw>) {
+                // Sign-extend from the field's top bit
+                const Unsigned sign = Unsigned(1) << (slot.bitWidth - 1);
+                bits = static_cast<Unsigned>((bits ^ sign) - sign);
+            }
+            return T(static_cast<Raw>(bits));
+        }
+    }
+
+    // Bit-fields keep the low bitWidth bits of the value, as in C
+    template<size_t I>
+    void set(const field_type<I>& value) {
+        using Raw = typename detail::RawOf<field_type<I>>::type;
+        constexpr FieldSlot slot = Layout::template slot<I>();
+        const Raw raw = static_cast<Raw>(value);
+        if constexpr (!slot.isBitField()) {
+            std::memcpy(bytes + slot.offset, &raw, sizeof(Raw));
+        } else {
+            using Word = detail::LoadType<slot.size>;
+            constexpr Word mask = static_cast<Word>(fieldMask<uint64_t>(slot.bitWidth) << slot.bitOffset);
+            Word word = load<slot.size>(slot.offset);
+            const Word bits = static_cast<Word>(static_cast<uint64_t>(raw) << slot.bitOffset);
+            word = static_cast<Word>((word & ~mask) | (bits & mask));
+            std::memcpy(bytes + slot.offset, &word, sizeof(Word));
+        }
+    }
+
+    const unsigned char* data() const { return bytes; }
+    unsigned char* data() { return bytes; }
+
+    static constexpr size_t size() { return Layout::SIZE; }
+
+private:
+    alignas(Layout::ALIGN) unsigned char bytes[Layout::SIZE];
+
+    template<typename U>
+    static constexpr U fieldMask(unsigned width) {
+        return width >= sizeof(U) * 8 ? static_cast<U>(~U(0)) : static_cast<U>((U(1) << width) - 1);
+    }
+
+    template<size_t Bytes>
+    detail::LoadType<Bytes> load(size_t offset) const {
+        detail::LoadType<Bytes> word;
+        std::memcpy(&word, bytes + offset, sizeof(word));
+        return word;
+    }
+};
+
+} // namespace holycpp
@@ -0,0 +1,246 @@
+#include "reduce.hpp"
+#include "bits.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+// Kernels are inlined into each target's entry point so that each copy is
+// compiled, and vectorized, for that target
+#define HOLYC_KERNEL inline __attribute__((always_inline))
+
+namespace holycpp {
+
+static_assert(sizeof(F32) == sizeof(float) && sizeof(F64) == sizeof(double) && std::is_standard_layout_v<F64>,
+              "Arrays of FInt are reduced as arrays of their storage");
+
+namespace {
+
+using reduction::LANES;
+using reduction::PAIRWISE_BLOCK;
+
+// ==================== Terms ====================
+// What gets summed. COMPENSATED also adds each term's rounding error,
+// which is zero for loaded values and fma(a, b, -a * b) for products.
+template<typename T>
+struct Values {
+    const T* data;
+    static constexpr bool EXACT = true;
+    HOLYC_KERNEL T value(size_t i) const { return data[i]; }
+    HOLYC_KERNEL T error(size_t, T) const { return T(0); }
+};
+
+template<typename T>
+struct Products {
+    const T* a;
+    const T* b;
+    static constexpr bool EXACT = false;
+    HOLYC_KERNEL T value(size_t i) const { return a[i] * b[i]; }
+    HOLYC_KERNEL T error(size_t i, T product) const { return std::fma(a[i], b[i], -product); }
+};
+
+// Squares of data[i] * scale, where scale is a power of two
+template<typename T>
+struct ScaledSquares {
+    const T* data;
+    T scale;
+    static constexpr bool EXACT = false;
+    HOLYC_KERNEL T value(size_t i) const {
+        const T scaled = data[i] * scale;
+        return scaled * scaled;
+    }
+    HOLYC_KERNEL T error(size_t i, T square) const {
+        const T scaled = data[i] * scale;
+        return std::fma(scaled, scaled, -square);
+    }
+};
+
+// ==================== Kernels ====================
+
+template<typename T>
+HOLYC_KERNEL T foldLanes(T* sums) {
+    for (size_t width = LANES / 2; width > 0; width /= 2) {
+        for (size_t lane = 0; lane < width; ++lane) {
+            sums[lane] += sums[lane + width];
+        }
+    }
+    return sums[0];
+}
+
+template<typename T, typename Terms>
+HOLYC_KERNEL T naiveSum(const Terms& terms, size_t begin, size_t end) {
+    T sums[LANES] = {};
+    size_t i = begin;
+    for (; i + LANES <= end; i += LANES) {
+        for (size_t lane = 0; lane < LANES; ++lane) {
+            sums[lane] += terms.value(i + lane);
+        }
+    }
+    for (size_t lane = 0; i < end; ++i, ++lane) {
+        sums[lane] += terms.value(i);
+    }
+    return foldLanes(sums);
+}
+
+// Block totals merge like a binary counter: two totals of the same level
+// become one of the next level, which is the pairwise tree without
+// recursion
+template<typename T, typename Terms>
+HOLYC_KERNEL T pairwiseSum(const Terms& terms, size_t count) {
+    T totals[64];
+    unsigned levels[64];
+    size_t depth = 0;
+    for (size_t begin = 0; begin < count; begin += PAIRWISE_BLOCK) {
+        T total = naiveSum<T>(terms, begin, std::min(count, begin + PAIRWISE_BLOCK));
+        unsigned level = 0;
+        while (depth > 0 && levels[depth - 1] == level) {
+            total = totals[--depth] + total;
+            ++level;
+        }
+        totals[depth] = total;
+        levels[depth++] = level;
+    }
+    T result = 0;
+    while (depth > 0) {
+        result = totals[--depth] + result;
+    }
+    return result;
+}
+
+// Neumaier's step: sum + x, with the rounding error of that add, computed
+// from whichever operand is larger, going into correction
+template<typename T>
+HOLYC_KERNEL void addCompensated(T& sum, T& correction, T x) {
+    const T total = sum + x;
+    const bool sumLarger = std::fabs(sum) >= std::fabs(x);
+    const T larger = sumLarger ? sum : x;
+    const T smaller = sumLarger ? x : sum;
+    correction += (larger - total) + smaller;
+    sum = total;
+}
+
+template<typename T, typename Terms>
+HOLYC_KERNEL void addTerm(const Terms& terms, size_t i, T& sum, T& correction) {
+    const T x = terms.value(i);
+    addCompensated(sum, correction, x);
+    if constexpr (!Terms::EXACT) {
+        correction += terms.error(i, x);
+    }
+}
+
+template<typename T, typename Terms>
+HOLYC_KERNEL T compensatedSum(const Terms& terms, size_t count) {
+    T sums[LANES] = {};
+    T corrections[LANES] = {};
+    size_t i = 0;
+    for (; i + LANES <= count; i += LANES) {
+        for (size_t lane = 0; lane < LANES; ++lane) {
+            addTerm(terms, i + lane, sums[lane], corrections[lane]);
+        }
+    }
+    for (size_t lane = 0; i < count; ++i, ++lane) {
+        addTerm(terms, i, sums[lane], corrections[lane]);
+    }
+
+    T sum = 0;
+    T correction = 0;
+    for (size_t lane = 0; lane < LANES; ++lane) {
+        addCompensated(sum, correction, sums[lane]);
+    }
+    for (size_t lane = 0; lane < LANES; ++lane) {
+        correction += corrections[lane];
+    }
+    // Infinities make the corrections NaN; the plain sum is the answer then
+    return std::isfinite(sum) ? sum + correction : sum;
+}
+
+template<typename T, typename Terms>
+HOLYC_KERNEL T reduce(const Terms& terms, size_t count, Summation mode) {
+    switch (mode) {
+        case Summation::NAIVE:       return naiveSum<T>(terms, 0, count);
+        case Summation::PAIRWISE:    return pairwiseSum<T>(terms, count);
+        case Summation::COMPENSATED: return compensatedSum<T>(terms, count);
+    }
+    throw std::invalid_argument("Unknown summation mode");
+}
+
+// ==================== Dispatch ====================
+// Both copies compile the same operations in the same order, so they agree
+// bit for bit. GCC fuses a * b + c into an fma by default when the target
+// has one, so the AVX2 copy turns that off.
+
+template<typename T, typename Terms>
+T reduceScalar(const Terms& terms, size_t count, Summation mode) {
+    return reduce<T>(terms, count, mode);
+}
+
+#if HOLYC_X86_DISPATCH
+template<typename T, typename Terms>
+__attribute__((target("avx2,fma"), optimize("fp-contract=off")))
+T reduceAvx2(const Terms& terms, size_t count, Summation mode) {
+    return reduce<T>(terms, count, mode);
+}
+#endif
+
+template<typename T, typename Terms>
+T run(const Terms& terms, size_t count, Summation mode) {
+#if HOLYC_X86_DISPATCH
+    if (bits::cpuHasAvx2() && bits::cpuHasFma()) {
+        return reduceAvx2<T>(terms, count, mode);
+    }
+#endif
+    return reduceScalar<T>(terms, count, mode);
+}
+
+template<typename T>
+T normOf(const T* data, size_t count, Summation mode) {
+    const T squares = run<T>(Products<T>{data, data}, count, mode);
+    const T safeMin = std::numeric_limits<T>::min() / std::numeric_limits<T>::epsilon();
+    if ((std::isfinite(squares) && squares >= safeMin) || std::isnan(squares)) {
+        return std::sqrt(squares);
+    }
+
+    // Overflow, or squares small enough to have lost bits: scale the
+    // largest value to about 1 and sum again
+    T largest = 0;
+    for (size_t i = 0; i < count; ++i) {
+        largest = std::max(largest, std::fabs(data[i]));
+    }
+    if (largest == 0 || std::isinf(largest)) {
+        return largest;
+    }
+    // Clamped so that the scale itself stays finite for subnormal inputs
+    const int exponent = std::max(std::ilogb(largest), 1 - std::numeric_limits<T>::max_exponent);
+    const T scaled = run<T>(ScaledSquares<T>{data, std::ldexp(T(1), -exponent)}, count, mode);
+    return std::ldexp(std::sqrt(scaled), exponent);
+}
+
+const float* rawOf(const F32* values) { return reinterpret_cast<const float*>(values); }
+const double* rawOf(const F64* values) { return reinterpret_cast<const double*>(values); }
+
+} // namespace
+
+F32 sum(const F32* data, size_t count, Summation mode) {
+    return F32(run<float>(Values<float>{rawOf(data)}, count, mode));
+}
+
+F64 sum(const F64* data, size_t count, Summation mode) {
+    return F64(run<double>(Values<double>{rawOf(data)}, count, mode));
+}
+
+F32 dot(const F32* a, const F32* b, size_t count, Summation mode) {
+    return F32(run<float>(Products<float>{rawOf(a), rawOf(b)}, count, mode));
+}
+
+F64 dot(const F64* a, const F64* b, size_t count, Summation mode) {
+    return F64(run<double>(Products<double>{rawOf(a), rawOf(b)}, count, mode));
+}
+
+F32 norm(const F32* data, size_t count, Summation mode) {
+    return F32(normOf(rawOf(data), count, mode));
+}
+
+F64 norm(const F64* data, size_t count, Summation mode) {
+    return F64(normOf(rawOf(data), count, mode));
+}
+
+} // namespace holycpp
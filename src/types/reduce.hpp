@@ -0,0 +1,100 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+#include "float.hpp"
+#include "array.hpp"
+
+namespace holycpp {
+
+// ==================== Reductions ====================
+// sum, dot and norm over F32 and F64 arrays. Every mode keeps 16 running
+// sums, element i going to sum i % 16, so the loop vectorizes and never
+// waits on one add chain; the sums are folded as a tree at the end.
+//
+//   NAIVE        the 16 sums run over the whole input. Fastest; the error
+//                grows with count / 16.
+//   PAIRWISE     the same over blocks of PAIRWISE_BLOCK values, whose
+//                totals are combined pairwise. The error grows with
+//                log(count) at almost NAIVE speed.
+//   COMPENSATED  each running sum carries Neumaier's correction term (Kahan
+//                summation that also handles terms larger than the sum),
+//                and dot/norm add each product's rounding error via fma.
+//                The error is about one rounding of the result unless the
+//                terms cancel to many orders of magnitude below their size.
+//
+// The order of operations is fixed by the mode and the count alone, so a
+// result is bit-for-bit the same on every path (AVX2+FMA or scalar) and on
+// every run. norm() rescales and tries again if the squares overflow or
+// underflow. Empty inputs give zero.
+enum class Summation : uint8_t {
+    NAIVE,
+    PAIRWISE,
+    COMPENSATED
+};
+
+namespace reduction {
+
+constexpr size_t LANES = 16;
+constexpr size_t PAIRWISE_BLOCK = 256;
+
+} // namespace reduction
+
+F32 sum(const F32* data, size_t count, Summation mode = Summation::PAIRWISE);
+F64 sum(const F64* data, size_t count, Summation mode = Summation::PAIRWISE);
+
+F32 dot(const F32* a, const F32* b, size_t count, Summation mode = Summation::PAIRWISE);
+F64 dot(const F64* a, const F64* b, size_t count, Summation mode = Summation::PAIRWISE);
+
+// Euclidean norm: sqrt(dot(data, data))
+F32 norm(const F32* data, size_t count, Summation mode = Summation::PAIRWISE);
+F64 norm(const F64* data, size_t count, Summation mode = Summation::PAIRWISE);
+
+template<typename T>
+T sum(const std::vector<T>& values, Summation mode = Summation::PAIRWISE) {
+    return sum(values.data(), values.size(), mode);
+}
+
+template<typename T>
+T dot(const std::vector<T>& a, const std::vector<T>& b, Summation mode = Summation::PAIRWISE) {
+    if (a.size() != b.size()) {
+        throw std::invalid_argument("dot: vectors differ in length");
+    }
+    return dot(a.data(), b.data(), a.size(), mode);
+}
+
+template<typename T>
+T norm(const std::vector<T>& values, Summation mode = Summation::PAIRWISE) {
+    return norm(values.data(), values.size(), mode);
+}
+
+// Over an Array, HeapArray or Slice
+inline F32 sum(Slice<const F32> values, Summation mode = Summation::PAIRWISE) {
+    return sum(values.data(), values.size(), mode);
+}
+inline F64 sum(Slice<const F64> values, Summation mode = Summation::PAIRWISE) {
+    return sum(values.data(), values.size(), mode);
+}
+
+inline F32 dot(Slice<const F32> a, Slice<const F32> b, Summation mode = Summation::PAIRWISE) {
+    if (a.size() != b.size()) {
+        throw std::invalid_argument("dot: slices differ in length");
+    }
+    return dot(a.data(), b.data(), a.size(), mode);
+}
+inline F64 dot(Slice<const F64> a, Slice<const F64> b, Summation mode = Summation::PAIRWISE) {
+    if (a.size() != b.size()) {
+        throw std::invalid_argument("dot: slices differ in length");
+    }
+    return dot(a.data(), b.data(), a.size(), mode);
+}
+
+inline F32 norm(Slice<const F32> values, Summation mode = Summation::PAIRWISE) {
+    return norm(values.data(), values.size(), mode);
+}
+inline F64 norm(Slice<const F64> values, Summation mode = Summation::PAIRWISE) {
+    return norm(values.data(), values.size(), mode);
+}
+
+} // namespace holycpp
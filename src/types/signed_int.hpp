@@ -8,8 +8,8 @@
 
 namespace holycpp {
 
-// Base signed integer type
-template<size_t Bits>
+// Base signed integer type; Policy as for UInt
+template<size_t Bits, typename Policy>
 class SInt {
 public:
     using storage_type = 
@@ -18,7 +18,7 @@ public:
         std::conditional_t<Bits == 32, int32_t,
         int64_t>>>;
     
-    using unsigned_type = UInt<Bits>;
+    using unsigned_type = UInt<Bits, Policy>;
     
 protected:
     storage_type value;
@@ -36,6 +36,7 @@ protected:
 public:
     // Constants
     static constexpr size_t BITS = Bits;
+    using policy_type = Policy;
     static constexpr storage_type MIN = 
         Bits == 8 ? INT8_MIN :
         Bits == 16 ? INT16_MIN :
@@ -54,15 +55,24 @@ public:
     explicit SInt(storage_type val) : value(val) {}
     
     // From unsigned (HolyC allows this) with bounds checking
-    template<size_t OtherBits>
-    SInt(const UInt<OtherBits>& other) {
+    template<size_t OtherBits, typename OtherPolicy>
+    SInt(const UInt<OtherBits, OtherPolicy>& other) {
         auto raw_val = other.raw();
-        if (raw_val > static_cast<typename UInt<OtherBits>::storage_type>(MAX)) {
+        if (raw_val > static_cast<typename UInt<OtherBits, OtherPolicy>::storage_type>(MAX)) {
             throw std::out_of_range("Unsigned value too large for signed type");
         }
         value = static_cast<storage_type>(raw_val);
     }
-    
+
+    // From other signed HolyC++ types with bounds checking
+    template<size_t OtherBits, typename OtherPolicy>
+    SInt(const SInt<OtherBits, OtherPolicy>& other) {
+        if constexpr (OtherBits > Bits) {
+            check_bounds(other.raw());
+        }
+        value = static_cast<storage_type>(other.raw());
+    }
+
     // From other signed types with bounds checking
     template<typename T, typename = std::enable_if_t<
         std::is_signed_v<T> && std::is_integral_v<T> && !std::is_same_v<T, storage_type>>>
@@ -146,65 +156,27 @@ public:
         return SInt(value * other.value);
     }
     
-    // Arithmetic operators (unchecked for performance)
-    SInt operator+(const SInt& other) const { return SInt(static_cast<storage_type>(value + other.value)); }
-    SInt operator-(const SInt& other) const { return SInt(static_cast<storage_type>(value - other.value)); }
-    SInt operator*(const SInt& other) const { return SInt(static_cast<storage_type>(value * other.value)); }
-    SInt operator/(const SInt& other) const { 
-        if (other.value == 0) {
-            throw std::domain_error("Division by zero");
-        }
-        if (value == MIN && other.value == -1) {
-            throw std::overflow_error("Signed division overflow (MIN / -1)");
-        }
-        return SInt(static_cast<storage_type>(value / other.value)); 
-    }
-    SInt operator%(const SInt& other) const { 
-        if (other.value == 0) {
-            throw std::domain_error("Modulo by zero");
-        }
-        return SInt(static_cast<storage_type>(value % other.value)); 
-    }
-    SInt operator-() const { 
-        if (value == MIN) {
-            throw std::overflow_error("Negation of MIN value overflows");
-        }
-        return SInt(static_cast<storage_type>(-value)); 
-    }
+    // Arithmetic operators (checked as Policy says; the default wraps)
+    SInt operator+(const SInt& other) const { return SInt(Policy::add(value, other.value)); }
+    SInt operator-(const SInt& other) const { return SInt(Policy::sub(value, other.value)); }
+    SInt operator*(const SInt& other) const { return SInt(Policy::mul(value, other.value)); }
+    SInt operator/(const SInt& other) const { return SInt(Policy::div(value, other.value)); }
+    SInt operator%(const SInt& other) const { return SInt(Policy::mod(value, other.value)); }
+    SInt operator-() const { return SInt(Policy::neg(value)); }
     
     // Bitwise operators
     SInt operator&(const SInt& other) const { return SInt(static_cast<storage_type>(value & other.value)); }
     SInt operator|(const SInt& other) const { return SInt(static_cast<storage_type>(value | other.value)); }
     SInt operator^(const SInt& other) const { return SInt(static_cast<storage_type>(value ^ other.value)); }
     SInt operator~() const { return SInt(static_cast<storage_type>(~value)); }
-    SInt operator<<(const SInt& other) const { 
-        if (other.value < 0 || other.value >= static_cast<storage_type>(BITS)) {
-            throw std::out_of_range("Shift amount out of range");
-        }
-        return SInt(static_cast<storage_type>(value << other.value)); 
-    }
-    SInt operator>>(const SInt& other) const { 
-        if (other.value < 0 || other.value >= static_cast<storage_type>(BITS)) {
-            throw std::out_of_range("Shift amount out of range");
-        }
-        return SInt(static_cast<storage_type>(value >> other.value)); 
-    }
+    SInt operator<<(const SInt& other) const { return SInt(Policy::template shl<Bits>(value, other.value)); }
+    SInt operator>>(const SInt& other) const { return SInt(Policy::template shr<Bits>(value, other.value)); }
     
     // Bitwise operators with built-in types
     template<typename T, typename = std::enable_if_t<std::is_integral_v<T>>>
-    SInt operator<<(T shift) const {
-        if (shift < 0 || shift >= static_cast<T>(BITS)) {
-            throw std::out_of_range("Shift amount out of range");
-        }
-        return SInt(static_cast<storage_type>(value << shift));
-    }
+    SInt operator<<(T shift) const { return SInt(Policy::template shl<Bits>(value, shift)); }
     template<typename T, typename = std::enable_if_t<std::is_integral_v<T>>>
-    SInt operator>>(T shift) const {
-        if (shift < 0 || shift >= static_cast<T>(BITS)) {
-            throw std::out_of_range("Shift amount out of range");
-        }
-        return SInt(static_cast<storage_type>(value >> shift));
-    }
+    SInt operator>>(T shift) const { return SInt(Policy::template shr<Bits>(value, shift)); }
     
     // Comparison operators - with same type
     bool operator==(const SInt& other) const { return value == other.value; }
@@ -241,49 +213,35 @@ public:
     }
     
     // Compound assignment
-    SInt& operator+=(const SInt& other) { value += other.value; return *this; }
-    SInt& operator-=(const SInt& other) { value -= other.value; return *this; }
-    SInt& operator*=(const SInt& other) { value *= other.value; return *this; }
-    SInt& operator/=(const SInt& other) { 
-        if (other.value == 0) {
-            throw std::domain_error("Division by zero");
-        }
-        if (value == MIN && other.value == -1) {
-            throw std::overflow_error("Signed division overflow (MIN / -1)");
-        }
-        value /= other.value; 
-        return *this; 
-    }
-    SInt& operator%=(const SInt& other) { 
-        if (other.value == 0) {
-            throw std::domain_error("Modulo by zero");
-        }
-        value %= other.value; 
-        return *this; 
-    }
+    SInt& operator+=(const SInt& other) { value = Policy::add(value, other.value); return *this; }
+    SInt& operator-=(const SInt& other) { value = Policy::sub(value, other.value); return *this; }
+    SInt& operator*=(const SInt& other) { value = Policy::mul(value, other.value); return *this; }
+    SInt& operator/=(const SInt& other) { value = Policy::div(value, other.value); return *this; }
+    SInt& operator%=(const SInt& other) { value = Policy::mod(value, other.value); return *this; }
     SInt& operator&=(const SInt& other) { value &= other.value; return *this; }
     SInt& operator|=(const SInt& other) { value |= other.value; return *this; }
     SInt& operator^=(const SInt& other) { value ^= other.value; return *this; }
-    SInt& operator<<=(const SInt& other) { 
-        if (other.value < 0 || other.value >= static_cast<storage_type>(BITS)) {
-            throw std::out_of_range("Shift amount out of range");
-        }
-        value <<= other.value; 
-        return *this; 
-    }
-    SInt& operator>>=(const SInt& other) { 
-        if (other.value < 0 || other.value >= static_cast<storage_type>(BITS)) {
-            throw std::out_of_range("Shift amount out of range");
-        }
-        value >>= other.value; 
-        return *this; 
-    }
+    SInt& operator<<=(const SInt& other) { value = Policy::template shl<Bits>(value, other.value); return *this; }
+    SInt& operator>>=(const SInt& other) { value = Policy::template shr<Bits>(value, other.value); return *this; }
     
     // Increment/Decrement
-    SInt& operator++() { ++value; return *this; }
-    SInt operator++(int) { SInt temp = *this; ++value; return temp; }
-    SInt& operator--() { --value; return *this; }
-    SInt operator--(int) { SInt temp = *this; --value; return temp; }
+    SInt& operator++() { value = Policy::add(value, storage_type(1)); return *this; }
+    SInt operator++(int) { SInt temp = *this; ++*this; return temp; }
+    SInt& operator--() { value = Policy::sub(value, storage_type(1)); return *this; }
+    SInt operator--(int) { SInt temp = *this; --*this; return temp; }
+    
+    // Bit intrinsics on the two's-complement pattern (see bits.hpp)
+    int popcount() const { return as_unsigned().popcount(); }
+    int leading_zeros() const { return as_unsigned().leading_zeros(); }
+    int trailing_zeros() const { return as_unsigned().trailing_zeros(); }
+    SInt byte_swap() const { return from_bits(as_unsigned().byte_swap()); }
+    SInt rotate_left(unsigned count) const { return from_bits(as_unsigned().rotate_left(count)); }
+    SInt rotate_right(unsigned count) const { return from_bits(as_unsigned().rotate_right(count)); }
+    SInt extract_bits(const unsigned_type& mask) const { return from_bits(as_unsigned().extract_bits(mask)); }
+    SInt deposit_bits(const unsigned_type& mask) const { return from_bits(as_unsigned().deposit_bits(mask)); }
+    
+    // The SInt with the same bit pattern
+    static SInt from_bits(const unsigned_type& pattern) { return SInt(static_cast<storage_type>(pattern.raw())); }
     
     // HolyC-style methods
     const char* to_hex() const {
@@ -315,23 +273,128 @@ using I64 = SInt<64>;
 template<typename T>
 struct is_signed_holyc : std::false_type {};
 
-template<size_t B> struct is_signed_holyc<SInt<B>> : std::true_type {};
+template<size_t B, typename P> struct is_signed_holyc<SInt<B, P>> : std::true_type {};
 
 template<typename T>
 inline constexpr bool is_signed_holyc_v = is_signed_holyc<T>::value;
 
 // Implementation of UInt constructor from SInt (defined after SInt is complete)
-template<size_t Bits>
-template<size_t OtherBits>
-inline UInt<Bits>::UInt(const SInt<OtherBits>& other) {
+template<size_t Bits, typename Policy>
+template<size_t OtherBits, typename OtherPolicy>
+inline UInt<Bits, Policy>::UInt(const SInt<OtherBits, OtherPolicy>& other) {
     auto raw_val = other.raw();
     if (raw_val < 0) {
         throw std::out_of_range("Cannot assign negative signed value to unsigned type");
     }
     if constexpr (OtherBits > Bits) {
-        check_bounds(static_cast<typename SInt<OtherBits>::storage_type>(raw_val));
+        check_bounds(static_cast<typename SInt<OtherBits, OtherPolicy>::storage_type>(raw_val));
     }
     value = static_cast<storage_type>(raw_val);
 }
 
+// ==================== Mixed-Width Arithmetic ====================
+// Binary operators on two different HolyC integer types (U8 + U32,
+// I16 * U8, I32 - U32, ...) widen both operands to 64 bits, as HolyC does,
+// and compute in the promoted type:
+//   U64  when both are unsigned, or either is U64
+//   I64  otherwise, so a signed operand meets only unsigned values that
+//        I64 holds
+// Widening keeps every value except a negative one going to U64, which
+// wraps as in C; no range check runs and nothing throws out_of_range. The
+// arithmetic follows the left operand's Policy at 64 bits. Comparisons
+// compare the values exactly, so I8(-1) < U64(1).
+namespace promotion {
+
+template<typename A, typename B>
+struct Promoted {};
+
+template<size_t BitsA, typename PolicyA, size_t BitsB, typename PolicyB>
+struct Promoted<UInt<BitsA, PolicyA>, UInt<BitsB, PolicyB>> {
+    using type = UInt<64, PolicyA>;
+    static constexpr bool MIXED = BitsA != BitsB;
+};
+
+template<size_t BitsA, typename PolicyA, size_t BitsB, typename PolicyB>
+struct Promoted<SInt<BitsA, PolicyA>, SInt<BitsB, PolicyB>> {
+    using type = SInt<64, PolicyA>;
+    static constexpr bool MIXED = BitsA != BitsB;
+};
+
+template<size_t BitsA, typename PolicyA, size_t BitsB, typename PolicyB>
+struct Promoted<SInt<BitsA, PolicyA>, UInt<BitsB, PolicyB>> {
+    using type = std::conditional_t<BitsB == 64, UInt<64, PolicyA>, SInt<64, PolicyA>>;
+    static constexpr bool MIXED = true;
+};
+
+template<size_t BitsA, typename PolicyA, size_t BitsB, typename PolicyB>
+struct Promoted<UInt<BitsA, PolicyA>, SInt<BitsB, PolicyB>> {
+    using type = std::conditional_t<BitsA == 64, UInt<64, PolicyA>, SInt<64, PolicyA>>;
+    static constexpr bool MIXED = true;
+};
+
+// Only for mixed pairs; same-type operands keep the member operators
+template<typename A, typename B>
+using promoted_t = std::enable_if_t<Promoted<A, B>::MIXED, typename Promoted<A, B>::type>;
+
+template<typename R, typename T>
+R widen(const T& value) {
+    return R(static_cast<typename R::storage_type>(value.raw()));
+}
+
+template<typename A, typename B>
+bool less(const A& a, const B& b) {
+    if constexpr (is_signed_holyc_v<A> == is_signed_holyc_v<B>) {
+        return a.raw() < b.raw();
+    } else if constexpr (is_signed_holyc_v<A>) {
+        return a.raw() < 0 || static_cast<uint64_t>(a.raw()) < b.raw();
+    } else {
+        return b.raw() > 0 && a.raw() < static_cast<uint64_t>(b.raw());
+    }
+}
+
+template<typename A, typename B>
+bool equal(const A& a, const B& b) {
+    if constexpr (is_signed_holyc_v<A> == is_signed_holyc_v<B>) {
+        return a.raw() == b.raw();
+    } else if constexpr (is_signed_holyc_v<A>) {
+        return a.raw() >= 0 && static_cast<uint64_t>(a.raw()) == b.raw();
+    } else {
+        return b.raw() >= 0 && a.raw() == static_cast<uint64_t>(b.raw());
+    }
+}
+
+} // namespace promotion
+
+// Arithmetic and bitwise operators
+template<typename A, typename B, typename R = promotion::promoted_t<A, B>>
+R operator+(const A& a, const B& b) { return promotion::widen<R>(a) + promotion::widen<R>(b); }
+template<typename A, typename B, typename R = promotion::promoted_t<A, B>>
+R operator-(const A& a, const B& b) { return promotion::widen<R>(a) - promotion::widen<R>(b); }
+template<typename A, typename B, typename R = promotion::promoted_t<A, B>>
+R operator*(const A& a, const B& b) { return promotion::widen<R>(a) * promotion::widen<R>(b); }
+template<typename A, typename B, typename R = promotion::promoted_t<A, B>>
+R operator/(const A& a, const B& b) { return promotion::widen<R>(a) / promotion::widen<R>(b); }
+template<typename A, typename B, typename R = promotion::promoted_t<A, B>>
+R operator%(const A& a, const B& b) { return promotion::widen<R>(a) % promotion::widen<R>(b); }
+template<typename A, typename B, typename R = promotion::promoted_t<A, B>>
+R operator&(const A& a, const B& b) { return promotion::widen<R>(a) & promotion::widen<R>(b); }
+template<typename A, typename B, typename R = promotion::promoted_t<A, B>>
+R operator|(const A& a, const B& b) { return promotion::widen<R>(a) | promotion::widen<R>(b); }
+template<typename A, typename B, typename R = promotion::promoted_t<A, B>>
+R operator^(const A& a, const B& b) { return promotion::widen<R>(a) ^ promotion::widen<R>(b); }
+
+// Comparison operators - by value
+template<typename A, typename B, typename = promotion::promoted_t<A, B>>
+bool operator==(const A& a, const B& b) { return promotion::equal(a, b); }
+template<typename A, typename B, typename = promotion::promoted_t<A, B>>
+bool operator!=(const A& a, const B& b) { return !promotion::equal(a, b); }
+template<typename A, typename B, typename = promotion::promoted_t<A, B>>
+bool operator<(const A& a, const B& b) { return promotion::less(a, b); }
+template<typename A, typename B, typename = promotion::promoted_t<A, B>>
+bool operator<=(const A& a, const B& b) { return !promotion::less(b, a); }
+template<typename A, typename B, typename = promotion::promoted_t<A, B>>
+bool operator>(const A& a, const B& b) { return promotion::less(b, a); }
+template<typename A, typename B, typename = promotion::promoted_t<A, B>>
+bool operator>=(const A& a, const B& b) { return !promotion::less(a, b); }
+
 } // namespace holycpp
\ No newline at end of file
@@ -0,0 +1,196 @@
+#include "sort.hpp"
+#include "../compiler/thread_pool.hpp"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <memory>
+
+namespace holycpp {
+namespace sorting {
+
+namespace {
+
+constexpr size_t RADIX = 256;
+
+template<typename K>
+inline size_t digitOf(K key, size_t pass) {
+    return static_cast<size_t>((key >> (8 * pass)) & 0xFF);
+}
+
+// LSD passes over digits [0, passes) of `data`, with `temp` as the other
+// buffer. Returns the buffer that holds the result.
+template<typename K>
+K* lsdPasses(K* data, K* temp, size_t count, size_t passes) {
+    std::vector<size_t> counts(passes * RADIX, 0);
+    for (size_t i = 0; i < count; ++i) {
+        const K key = data[i];
+        for (size_t pass = 0; pass < passes; ++pass) {
+            ++counts[pass * RADIX + digitOf(key, pass)];
+        }
+    }
+
+    K* from = data;
+    K* to = temp;
+    for (size_t pass = 0; pass < passes; ++pass) {
+        size_t* offsets = &counts[pass * RADIX];
+        if (offsets[digitOf(data[0], pass)] == count) {
+            continue;   // Every key has this digit
+        }
+        size_t total = 0;
+        for (size_t d = 0; d < RADIX; ++d) {
+            const size_t n = offsets[d];
+            offsets[d] = total;
+            total += n;
+        }
+        for (size_t i = 0; i < count; ++i) {
+            const K key = from[i];
+            to[offsets[digitOf(key, pass)]++] = key;
+        }
+        std::swap(from, to);
+    }
+    return from;
+}
+
+template<typename K>
+void sortBucket(K* data, K* temp, size_t count, size_t digit, K* target);
+
+// Bucket bounds after a pass on one digit
+using Buckets = std::array<size_t, RADIX + 1>;
+
+// Sorts data[0, count) on digits [0, digit] with `temp` as the other
+// buffer, and returns the buffer that holds the result. Large inputs are
+// split on their top digit, recursively, until the buckets fit in cache;
+// then LSD passes finish them.
+template<typename K>
+K* msdSort(K* data, K* temp, size_t count, size_t digit) {
+    if (count < RADIX_CUTOFF) {
+        std::sort(data, data + count);
+        return data;
+    }
+    if (count < MSD_CUTOFF || digit == 0) {
+        return lsdPasses(data, temp, count, digit + 1);
+    }
+
+    Buckets bounds{};
+    for (size_t i = 0; i < count; ++i) {
+        ++bounds[digitOf(data[i], digit) + 1];
+    }
+    if (bounds[digitOf(data[0], digit) + 1] == count) {
+        return msdSort(data, temp, count, digit - 1);   // Every key has this digit
+    }
+    for (size_t d = 0; d < RADIX; ++d) {
+        bounds[d + 1] += bounds[d];
+    }
+    Buckets offsets = bounds;
+    for (size_t i = 0; i < count; ++i) {
+        const K key = data[i];
+        temp[offsets[digitOf(key, digit)]++] = key;
+    }
+    for (size_t d = 0; d < RADIX; ++d) {
+        sortBucket(temp + bounds[d], data + bounds[d], bounds[d + 1] - bounds[d], digit - 1, temp + bounds[d]);
+    }
+    return temp;
+}
+
+// Sorts a bucket on its lower digits and leaves it in `target`, which is
+// either `data` or `temp`
+template<typename K>
+void sortBucket(K* data, K* temp, size_t count, size_t digit, K* target) {
+    K* result = msdSort(data, temp, count, digit);
+    if (result != target) {
+        std::memcpy(target, result, count * sizeof(K));
+    }
+}
+
+template<typename K>
+void radixSort(K* keys, size_t count) {
+    if (count < RADIX_CUTOFF) {
+        std::sort(keys, keys + count);
+        return;
+    }
+
+    // One digit: the histogram is the sorted array
+    if constexpr (sizeof(K) == 1) {
+        size_t counts[RADIX] = {};
+        for (size_t i = 0; i < count; ++i) {
+            ++counts[keys[i]];
+        }
+        K* out = keys;
+        for (size_t d = 0; d < RADIX; ++d) {
+            out = std::fill_n(out, counts[d], static_cast<K>(d));
+        }
+        return;
+    }
+
+    std::unique_ptr<K[]> scratch(new K[count]);
+    if (msdSort(keys, scratch.get(), count, sizeof(K) - 1) != keys) {
+        std::memcpy(keys, scratch.get(), count * sizeof(K));
+    }
+}
+
+// The top-digit split in blocks, each with its own histogram, then the
+// buckets as separate tasks
+template<typename K>
+void parallelRadixSort(K* keys, size_t count, WorkStealingPool& pool) {
+    const size_t threads = pool.threadCount();
+    if (threads < 2 || count < PARALLEL_CUTOFF) {
+        radixSort(keys, count);
+        return;
+    }
+    constexpr size_t TOP = sizeof(K) - 1;
+    const size_t blocks = threads * 4;   // Slack for stealing
+    const size_t blockSize = (count + blocks - 1) / blocks;
+    auto blockRange = [&](size_t block) {
+        const size_t begin = std::min(count, block * blockSize);
+        return std::make_pair(begin, std::min(count, begin + blockSize));
+    };
+
+    std::vector<size_t> histograms(blocks * RADIX, 0);
+    pool.parallelFor(blocks, [&](size_t block) {
+        size_t* histogram = &histograms[block * RADIX];
+        auto [begin, end] = blockRange(block);
+        for (size_t i = begin; i < end; ++i) {
+            ++histogram[digitOf(keys[i], TOP)];
+        }
+    });
+
+    // Offsets run digit by digit, and block by block within a digit, so
+    // every block scatters stably into ranges of its own
+    Buckets bounds{};
+    size_t total = 0;
+    for (size_t d = 0; d < RADIX; ++d) {
+        bounds[d] = total;
+        for (size_t block = 0; block < blocks; ++block) {
+            const size_t n = histograms[block * RADIX + d];
+            histograms[block * RADIX + d] = total;
+            total += n;
+        }
+    }
+    bounds[RADIX] = total;
+
+    std::unique_ptr<K[]> scratch(new K[count]);
+    pool.parallelFor(blocks, [&](size_t block) {
+        size_t* offsets = &histograms[block * RADIX];
+        auto [begin, end] = blockRange(block);
+        for (size_t i = begin; i < end; ++i) {
+            const K key = keys[i];
+            scratch[offsets[digitOf(key, TOP)]++] = key;
+        }
+    });
+    pool.parallelFor(RADIX, [&](size_t d) {
+        sortBucket(scratch.get() + bounds[d], keys + bounds[d], bounds[d + 1] - bounds[d], TOP - 1, keys + bounds[d]);
+    });
+}
+
+} // namespace
+
+void sortKeys(uint8_t* keys, size_t count) { radixSort(keys, count); }
+void sortKeys(uint16_t* keys, size_t count) { radixSort(keys, count); }
+void sortKeys(uint32_t* keys, size_t count) { radixSort(keys, count); }
+void sortKeys(uint64_t* keys, size_t count) { radixSort(keys, count); }
+
+void parallelSortKeys(uint32_t* keys, size_t count, WorkStealingPool& pool) { parallelRadixSort(keys, count, pool); }
+void parallelSortKeys(uint64_t* keys, size_t count, WorkStealingPool& pool) { parallelRadixSort(keys, count, pool); }
+
+} // namespace sorting
+} // namespace holycpp
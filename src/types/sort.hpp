@@ -0,0 +1,159 @@
+#pragma once
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <vector>
+#include "unsigned_int.hpp"
+#include "signed_int.hpp"
+#include "float.hpp"
+
+namespace holycpp {
+
+class WorkStealingPool;
+
+namespace sorting {
+
+// ==================== Sort Keys ====================
+// Each sortable type maps its storage bits to an unsigned key of the same
+// width whose unsigned order is the type's order, and back:
+//   UInt  the bits themselves
+//   SInt  the bits with the sign bit flipped
+//   FInt  positive: sign bit set; negative: all bits inverted. So
+//         -inf < ... < -0.0 < +0.0 < ... < +inf
+// FInt NaNs have no place in that order. sort() moves them after +inf,
+// keeping their bits and their relative order.
+template<typename T>
+struct KeyTraits;
+
+template<size_t Bits, typename Policy>
+struct KeyTraits<UInt<Bits, Policy>> {
+    using Key = typename UInt<Bits, Policy>::storage_type;
+    static Key encode(Key bits) { return bits; }
+    static Key decode(Key key) { return key; }
+};
+
+template<size_t Bits, typename Policy>
+struct KeyTraits<SInt<Bits, Policy>> {
+    using Key = std::make_unsigned_t<typename SInt<Bits, Policy>::storage_type>;
+    static constexpr Key SIGN = Key(1) << (Bits - 1);
+    static Key encode(Key bits) { return static_cast<Key>(bits ^ SIGN); }
+    static Key decode(Key key) { return static_cast<Key>(key ^ SIGN); }
+};
+
+template<size_t Bits>
+struct KeyTraits<FInt<Bits>> {
+    using Key = std::conditional_t<Bits == 32, uint32_t, uint64_t>;
+    static constexpr Key SIGN = Key(1) << (sizeof(Key) * 8 - 1);
+    static Key encode(Key bits) { return (bits & SIGN) ? static_cast<Key>(~bits) : static_cast<Key>(bits | SIGN); }
+    static Key decode(Key key) { return (key & SIGN) ? static_cast<Key>(key ^ SIGN) : static_cast<Key>(~key); }
+};
+
+// ==================== Key Sorts ====================
+// LSD radix sort over 8-bit digits: one pass builds every digit's
+// histogram, then one stable scatter per digit, skipping digits that all
+// keys share. From MSD_CUTOFF keys on, the top digit goes first and each
+// of its 256 buckets is then sorted on its own, so the LSD scatters stay
+// in cache. Inputs and buckets under RADIX_CUTOFF go to std::sort, which
+// wins there because the histograms cost more than the comparisons they
+// save.
+constexpr size_t RADIX_CUTOFF = 1024;
+constexpr size_t MSD_CUTOFF = 1 << 18;
+
+void sortKeys(uint8_t* keys, size_t count);
+void sortKeys(uint16_t* keys, size_t count);
+void sortKeys(uint32_t* keys, size_t count);
+void sortKeys(uint64_t* keys, size_t count);
+
+// The same on a pool: the top-digit split runs in blocks and the buckets
+// as separate tasks. Falls back to sortKeys() for a one-thread pool or an
+// input under PARALLEL_CUTOFF.
+constexpr size_t PARALLEL_CUTOFF = 1 << 18;
+
+void parallelSortKeys(uint32_t* keys, size_t count, WorkStealingPool& pool);
+void parallelSortKeys(uint64_t* keys, size_t count, WorkStealingPool& pool);
+
+// Moves NaNs behind everything else, both groups keeping their order, and
+// returns how many values are left in front
+template<typename T>
+size_t partitionNaNs(T* data, size_t count) {
+    size_t kept = 0;
+    std::vector<T> nans;
+    for (size_t i = 0; i < count; ++i) {
+        if (std::isnan(data[i].raw())) {
+            nans.push_back(data[i]);
+        } else {
+            data[kept++] = data[i];
+        }
+    }
+    for (size_t i = 0; i < nans.size(); ++i) {
+        data[kept + i] = nans[i];
+    }
+    return kept;
+}
+
+template<typename T, typename SortKeys>
+void sortWith(T* data, size_t count, SortKeys sortKeys) {
+    using Traits = KeyTraits<T>;
+    using Key = typename Traits::Key;
+    static_assert(sizeof(T) == sizeof(Key) && std::is_standard_layout_v<T> && std::is_trivially_copyable_v<T>,
+                  "Sorting works on the storage of single-member types");
+
+    if constexpr (is_float_holyc_v<T>) {
+        // A Key* may not alias float storage, so the keys go through a
+        // scratch buffer and memcpy
+        count = partitionNaNs(data, count);
+        std::unique_ptr<Key[]> keys(new Key[count]);
+        std::memcpy(keys.get(), data, count * sizeof(Key));
+        for (size_t i = 0; i < count; ++i) {
+            keys[i] = Traits::encode(keys[i]);
+        }
+        sortKeys(keys.get(), count);
+        for (size_t i = 0; i < count; ++i) {
+            keys[i] = Traits::decode(keys[i]);
+        }
+        std::memcpy(static_cast<void*>(data), keys.get(), count * sizeof(Key));
+    } else {
+        // Integer keys are sorted in place over the values' storage; the
+        // unsigned variant of the storage type may alias it
+        Key* keys = reinterpret_cast<Key*>(data);
+        for (size_t i = 0; i < count; ++i) {
+            keys[i] = Traits::encode(keys[i]);
+        }
+        sortKeys(keys, count);
+        for (size_t i = 0; i < count; ++i) {
+            keys[i] = Traits::decode(keys[i]);
+        }
+    }
+}
+
+} // namespace sorting
+
+// ==================== Sorting ====================
+// Sorts UInt, SInt and FInt arrays ascending, by radix on their storage.
+// The result equals std::sort with operator< except for FInt NaNs, which
+// end up last (see KeyTraits), and -0.0, which goes before +0.0.
+template<typename T>
+void sort(T* data, size_t count) {
+    sorting::sortWith(data, count, [](auto* keys, size_t n) { sorting::sortKeys(keys, n); });
+}
+
+template<typename T>
+void sort(std::vector<T>& values) {
+    sort(values.data(), values.size());
+}
+
+// The same on a thread pool, for 32- and 64-bit types
+template<typename T>
+void parallelSort(T* data, size_t count, WorkStealingPool& pool) {
+    sorting::sortWith(data, count, [&pool](auto* keys, size_t n) { sorting::parallelSortKeys(keys, n, pool); });
+}
+
+template<typename T>
+void parallelSort(std::vector<T>& values, WorkStealingPool& pool) {
+    parallelSort(values.data(), values.size(), pool);
+}
+
+} // namespace holycpp
@@ -0,0 +1,354 @@
+#include "type_table.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+namespace holycpp {
+
+const char* conversionName(Conversion conversion) {
+    switch (conversion) {
+        case Conversion::NONE: return "none";
+        case Conversion::IDENTITY: return "identity";
+        case Conversion::WIDEN: return "widen";
+        case Conversion::CHECKED: return "checked";
+        case Conversion::INEXACT: return "inexact";
+        case Conversion::REINTERPRET: return "reinterpret";
+        default: return "?";
+    }
+}
+
+namespace {
+
+// Significand bits of FInt<32> (float) and every other FInt (double)
+uint32_t mantissaBits(uint32_t floatBits) {
+    return floatBits == 32 ? 24 : 53;
+}
+
+} // namespace
+
+// ==================== Construction ====================
+TypeTable::TypeTable() {
+    struct Builtin { TypeKind kind; uint32_t bits; };
+    const Builtin builtins[BuiltinTypes::COUNT] = {
+        {TypeKind::VOID, 0},
+        {TypeKind::UNSIGNED, 8}, {TypeKind::UNSIGNED, 16}, {TypeKind::UNSIGNED, 32}, {TypeKind::UNSIGNED, 64},
+        {TypeKind::SIGNED, 8}, {TypeKind::SIGNED, 16}, {TypeKind::SIGNED, 32}, {TypeKind::SIGNED, 64},
+        {TypeKind::FLOAT, 32}, {TypeKind::FLOAT, 64}
+    };
+    for (const Builtin& builtin : builtins) {
+        Entry entry;
+        entry.kind = builtin.kind;
+        entry.bits = builtin.bits;
+        entry.size = builtin.bits / 8;
+        entry.align = std::max<size_t>(entry.size, 1);
+        add(entry);
+    }
+
+    // The conversion matrix encodes what each converting constructor does
+    for (TypeId from = 0; from < BuiltinTypes::COUNT; ++from) {
+        for (TypeId to = 0; to < BuiltinTypes::COUNT; ++to) {
+            const Entry& f = entries[from];
+            const Entry& t = entries[to];
+            Conversion& c = scalarMatrix[from][to];
+
+            if (from == to) {
+                c = Conversion::IDENTITY;
+            } else if (f.kind == TypeKind::VOID || t.kind == TypeKind::VOID) {
+                c = Conversion::NONE;
+            } else if (t.kind == TypeKind::FLOAT) {
+                // FInt(UInt/SInt/FInt) is an unchecked static_cast
+                uint32_t valueBits = f.kind == TypeKind::FLOAT ? mantissaBits(f.bits)
+                                   : f.kind == TypeKind::SIGNED ? f.bits - 1 : f.bits;
+                c = valueBits <= mantissaBits(t.bits) ? Conversion::WIDEN : Conversion::INEXACT;
+            } else if (f.kind == TypeKind::FLOAT) {
+                // Truncates toward zero with a range check
+                c = Conversion::CHECKED;
+            } else if (f.kind == t.kind) {
+                // check_bounds only runs when narrowing
+                c = t.bits >= f.bits ? Conversion::WIDEN : Conversion::CHECKED;
+            } else if (f.kind == TypeKind::UNSIGNED) {
+                // SInt(UInt) throws when the value exceeds MAX
+                c = f.bits < t.bits ? Conversion::WIDEN : Conversion::CHECKED;
+            } else {
+                // UInt(SInt) always rejects negative values
+                c = Conversion::CHECKED;
+            }
+        }
+    }
+}
+
+TypeId TypeTable::add(const Entry& entry) {
+    if (entries.size() >= INVALID_TYPE) {
+        throw std::length_error("Type table is full");
+    }
+    entries.push_back(entry);
+    return static_cast<TypeId>(entries.size() - 1);
+}
+
+// ==================== Interning ====================
+TypeId TypeTable::pointerTo(TypeId element) {
+    if (element >= entries.size()) {
+        throw std::out_of_range("Unknown type id " + std::to_string(element));
+    }
+    DerivedKey key{TypeKind::POINTER, element, 0};
+    auto it = derived.find(key);
+    if (it != derived.end()) {
+        return it->second;
+    }
+
+    Entry entry;
+    entry.kind = TypeKind::POINTER;
+    entry.bits = 64;
+    entry.size = 8;
+    entry.align = 8;
+    entry.element = element;
+    TypeId id = add(entry);
+    derived.emplace(key, id);
+    return id;
+}
+
+TypeId TypeTable::arrayOf(TypeId element, uint64_t count) {
+    const Entry& elem = entries.at(element);
+    if (!elem.complete || elem.kind == TypeKind::VOID) {
+        throw std::invalid_argument("Array of incomplete type " + name(element));
+    }
+
+    DerivedKey key{TypeKind::ARRAY, element, count};
+    auto it = derived.find(key);
+    if (it != derived.end()) {
+        return it->second;
+    }
+
+    if (elem.size != 0 && count > SIZE_MAX / elem.size) {
+        throw std::invalid_argument("Array size overflows the address space");
+    }
+
+    Entry entry;
+    entry.kind = TypeKind::ARRAY;
+    entry.size = static_cast<size_t>(count) * elem.size;
+    entry.align = elem.align;
+    entry.element = element;
+    entry.count = count;
+    TypeId id = add(entry);
+    derived.emplace(key, id);
+    return id;
+}
+
+TypeId TypeTable::unionOf(const std::vector<TypeId>& members) {
+    if (members.empty()) {
+        throw std::invalid_argument("Union needs at least one member");
+    }
+    auto it = unions.find(members);
+    if (it != unions.end()) {
+        return it->second;
+    }
+
+    // Same layout as Union<Types...>: largest member, strictest alignment
+    Entry entry;
+    entry.kind = TypeKind::UNION;
+    LayoutBuilder builder(LayoutMode::UNION);
+    for (TypeId member : members) {
+        const Entry& m = entries.at(member);
+        if (!m.complete) {
+            throw std::invalid_argument("Union member of incomplete type " + name(member));
+        }
+        builder.member(m.size, m.align);
+    }
+    entry.size = builder.size();
+    entry.align = builder.align();
+    entry.aux = static_cast<uint32_t>(memberLists.size());
+    memberLists.push_back(members);
+
+    TypeId id = add(entry);
+    unions.emplace(members, id);
+    return id;
+}
+
+TypeId TypeTable::declareClass(const std::string& name) {
+    auto it = classes.find(name);
+    if (it != classes.end()) {
+        return it->second;
+    }
+
+    Entry entry;
+    entry.kind = TypeKind::CLASS;
+    entry.complete = false;
+    entry.aux = static_cast<uint32_t>(classNames.size());
+    classNames.push_back(name);
+    fieldLists.emplace_back();
+
+    TypeId id = add(entry);
+    classes.emplace(name, id);
+    return id;
+}
+
+void TypeTable::defineClass(TypeId cls, const std::vector<std::pair<std::string, TypeId>>& fields) {
+    std::vector<ClassFieldSpec> specs;
+    specs.reserve(fields.size());
+    for (const auto& field : fields) {
+        specs.push_back({field.first, field.second});
+    }
+    defineClass(cls, specs, LayoutMode::NATURAL);
+}
+
+void TypeTable::defineClass(TypeId cls, const std::vector<ClassFieldSpec>& fields, LayoutMode mode) {
+    Entry& entry = entries.at(cls);
+    if (entry.kind != TypeKind::CLASS) {
+        throw std::invalid_argument(name(cls) + " is not a class");
+    }
+    if (entry.complete) {
+        throw std::invalid_argument("Redefinition of class " + name(cls));
+    }
+
+    std::vector<ClassField> laidOut;
+    LayoutBuilder builder(mode);
+    for (const ClassFieldSpec& field : fields) {
+        const Entry& type = entries.at(field.type);
+        if (!type.complete || type.kind == TypeKind::VOID) {
+            throw std::invalid_argument("Field '" + field.name + "' has incomplete type " + name(field.type));
+        }
+        for (const ClassField& existing : laidOut) {
+            if (existing.name == field.name) {
+                throw std::invalid_argument("Duplicate field '" + field.name + "' in class " + name(cls));
+            }
+        }
+        if (field.bits != 0 && !isInteger(field.type)) {
+            throw std::invalid_argument("Bit-field '" + field.name + "' has non-integer type " + name(field.type));
+        }
+        const FieldSlot slot = field.bits == 0 ? builder.member(type.size, type.align, field.align)
+                                               : builder.bitField(type.size, field.bits, field.align);
+        laidOut.push_back({field.name, field.type, slot.offset, slot.size, slot.bitOffset, slot.bitWidth});
+    }
+
+    entry.size = builder.size();
+    entry.align = builder.align();
+    entry.complete = true;
+    fieldLists[entry.aux] = std::move(laidOut);
+}
+
+TypeId TypeTable::findClass(const std::string& name) const {
+    auto it = classes.find(name);
+    return it == classes.end() ? INVALID_TYPE : it->second;
+}
+
+// ==================== Queries ====================
+Conversion TypeTable::conversion(TypeId from, TypeId to) const {
+    if (from == to) {
+        return from < entries.size() ? Conversion::IDENTITY : Conversion::NONE;
+    }
+    if (from < BuiltinTypes::COUNT && to < BuiltinTypes::COUNT) {
+        return scalarMatrix[from][to];
+    }
+    if (from >= entries.size() || to >= entries.size()) {
+        return Conversion::NONE;
+    }
+
+    const Entry& f = entries[from];
+    const Entry& t = entries[to];
+
+    if (t.kind == TypeKind::POINTER) {
+        if (f.kind == TypeKind::POINTER) {
+            // U0* converts to and from every object pointer
+            return (f.element == BuiltinTypes::U0 || t.element == BuiltinTypes::U0)
+                ? Conversion::REINTERPRET : Conversion::NONE;
+        }
+        if (f.kind == TypeKind::ARRAY) {
+            return (f.element == t.element || t.element == BuiltinTypes::U0)
+                ? Conversion::REINTERPRET : Conversion::NONE;
+        }
+        if (from == BuiltinTypes::U64 || from == BuiltinTypes::I64) {
+            return Conversion::REINTERPRET;
+        }
+        return Conversion::NONE;
+    }
+
+    if (f.kind == TypeKind::POINTER &&
+        (t.kind == TypeKind::UNSIGNED || t.kind == TypeKind::SIGNED)) {
+        // UInt(void*)/SInt(void*) truncate below 64 bits
+        return t.bits == 64 ? Conversion::REINTERPRET : Conversion::INEXACT;
+    }
+
+    return Conversion::NONE;
+}
+
+bool TypeTable::isImplicit(TypeId from, TypeId to) const {
+    Conversion c = conversion(from, to);
+    return c == Conversion::IDENTITY || c == Conversion::WIDEN;
+}
+
+TypeId TypeTable::arithmeticResult(TypeId lhs, TypeId rhs) const {
+    if (!isArithmetic(lhs) || !isArithmetic(rhs)) {
+        return INVALID_TYPE;
+    }
+    // HolyC evaluates in 64 bits: F64 if either side is floating, U64 if
+    // either side is U64, I64 otherwise
+    if (entries[lhs].kind == TypeKind::FLOAT || entries[rhs].kind == TypeKind::FLOAT) {
+        return BuiltinTypes::F64;
+    }
+    if (lhs == BuiltinTypes::U64 || rhs == BuiltinTypes::U64) {
+        return BuiltinTypes::U64;
+    }
+    return BuiltinTypes::I64;
+}
+
+const std::vector<TypeId>& TypeTable::members(TypeId id) const {
+    const Entry& entry = entries.at(id);
+    if (entry.kind != TypeKind::UNION) {
+        throw std::invalid_argument(name(id) + " is not a union");
+    }
+    return memberLists[entry.aux];
+}
+
+const std::vector<ClassField>& TypeTable::fields(TypeId id) const {
+    const Entry& entry = entries.at(id);
+    if (entry.kind != TypeKind::CLASS) {
+        throw std::invalid_argument(name(id) + " is not a class");
+    }
+    return fieldLists[entry.aux];
+}
+
+bool TypeTable::isInteger(TypeId id) const {
+    TypeKind k = kind(id);
+    return k == TypeKind::UNSIGNED || k == TypeKind::SIGNED;
+}
+
+bool TypeTable::isArithmetic(TypeId id) const {
+    return id < entries.size() && (isInteger(id) || entries[id].kind == TypeKind::FLOAT);
+}
+
+bool TypeTable::isScalar(TypeId id) const {
+    return isArithmetic(id) || (id < entries.size() && entries[id].kind == TypeKind::POINTER);
+}
+
+std::string TypeTable::name(TypeId id) const {
+    static const char* const builtinNames[BuiltinTypes::COUNT] = {
+        "U0", "U8", "U16", "U32", "U64", "I8", "I16", "I32", "I64", "F32", "F64"
+    };
+    if (id < BuiltinTypes::COUNT) {
+        return builtinNames[id];
+    }
+    if (id >= entries.size()) {
+        return "<invalid type>";
+    }
+
+    const Entry& entry = entries[id];
+    switch (entry.kind) {
+        case TypeKind::POINTER:
+            return name(entry.element) + "*";
+        case TypeKind::ARRAY:
+            return name(entry.element) + "[" + std::to_string(entry.count) + "]";
+        case TypeKind::CLASS:
+            return classNames[entry.aux];
+        case TypeKind::UNION: {
+            std::string result = "union {";
+            const auto& list = memberLists[entry.aux];
+            for (size_t i = 0; i < list.size(); ++i) {
+                result += (i ? ", " : "") + name(list[i]);
+            }
+            return result + "}";
+        }
+        default:
+            return "<invalid type>";
+    }
+}
+
+} // namespace holycpp
@@ -0,0 +1,179 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "layout.hpp"
+
+namespace holycpp {
+
+// ==================== Type Ids ====================
+// Every distinct HolyC type is interned once and named by a 32-bit id, so
+// type equality is an integer compare and a type is four bytes wherever the
+// checker stores it.
+using TypeId = uint32_t;
+
+constexpr TypeId INVALID_TYPE = UINT32_MAX;
+
+// Builtin scalars have fixed ids in every TypeTable
+namespace BuiltinTypes {
+    constexpr TypeId U0 = 0;
+    constexpr TypeId U8 = 1;
+    constexpr TypeId U16 = 2;
+    constexpr TypeId U32 = 3;
+    constexpr TypeId U64 = 4;
+    constexpr TypeId I8 = 5;
+    constexpr TypeId I16 = 6;
+    constexpr TypeId I32 = 7;
+    constexpr TypeId I64 = 8;
+    constexpr TypeId F32 = 9;
+    constexpr TypeId F64 = 10;
+
+    constexpr TypeId COUNT = 11;
+}
+
+enum class TypeKind : uint8_t {
+    VOID,       // U0
+    UNSIGNED,   // UInt<N>
+    SIGNED,     // SInt<N>
+    FLOAT,      // FInt<N>
+    POINTER,
+    ARRAY,
+    CLASS,      // Nominal: one id per declared name
+    UNION       // Structural: one id per member list, like Union<Types...>
+};
+
+// ==================== Conversions ====================
+// Mirrors the converting constructors of UInt/SInt/FInt:
+//   IDENTITY     same type
+//   WIDEN        value-preserving, the constructor never throws
+//   CHECKED      the constructor bounds-checks and may throw out_of_range;
+//                a constant outside the range is T004 at compile time
+//   INEXACT      always succeeds but may round (I64 -> F64, F64 -> F32)
+//   REINTERPRET  pointer <-> pointer through U0*, pointer <-> U64/I64,
+//                array -> pointer decay
+//   NONE         not convertible (T004)
+enum class Conversion : uint8_t {
+    NONE,
+    IDENTITY,
+    WIDEN,
+    CHECKED,
+    INEXACT,
+    REINTERPRET
+};
+
+const char* conversionName(Conversion conversion);
+
+// A laid-out field: one load of loadSize bytes at offset, then for a
+// bit-field a shift by bitOffset and a mask of bitWidth bits
+struct ClassField {
+    std::string name;
+    TypeId type;
+    size_t offset;
+    size_t loadSize = 0;
+    uint8_t bitOffset = 0;
+    uint8_t bitWidth = 0;   // 0 for a plain field
+};
+
+// A field as declared: bits > 0 makes it a bit-field over an integer type,
+// align > 0 raises its alignment
+struct ClassFieldSpec {
+    std::string name;
+    TypeId type;
+    unsigned bits = 0;
+    size_t align = 0;
+};
+
+// ==================== Type Table ====================
+class TypeTable {
+public:
+    TypeTable();
+
+    // Interning: the same structure always yields the same id
+    TypeId pointerTo(TypeId element);
+    TypeId arrayOf(TypeId element, uint64_t count);
+    TypeId unionOf(const std::vector<TypeId>& members);
+
+    // Classes are nominal. declareClass returns the existing id for a known
+    // name; defineClass lays out the fields in declaration order and throws
+    // std::invalid_argument on redefinition or an incomplete field type.
+    // The second form adds bit-fields, explicit alignment and packed or
+    // union layout (see LayoutBuilder); it also throws on a bit-field over
+    // a non-integer or wider than its type.
+    TypeId declareClass(const std::string& name);
+    void defineClass(TypeId cls, const std::vector<std::pair<std::string, TypeId>>& fields);
+    void defineClass(TypeId cls, const std::vector<ClassFieldSpec>& fields, LayoutMode mode);
+
+    TypeId findClass(const std::string& name) const;
+
+    // O(1): a matrix load for scalars, id compares for derived types
+    Conversion conversion(TypeId from, TypeId to) const;
+    bool isImplicit(TypeId from, TypeId to) const;   // IDENTITY or WIDEN
+
+    // Result type of a binary arithmetic operator, or INVALID_TYPE (T005)
+    TypeId arithmeticResult(TypeId lhs, TypeId rhs) const;
+
+    // Accessors
+    TypeKind kind(TypeId id) const { return entries.at(id).kind; }
+    uint32_t bits(TypeId id) const { return entries.at(id).bits; }
+    size_t size(TypeId id) const { return entries.at(id).size; }
+    size_t align(TypeId id) const { return entries.at(id).align; }
+    TypeId element(TypeId id) const { return entries.at(id).element; }
+    uint64_t count(TypeId id) const { return entries.at(id).count; }
+    bool isComplete(TypeId id) const { return entries.at(id).complete; }
+    const std::vector<TypeId>& members(TypeId id) const;
+    const std::vector<ClassField>& fields(TypeId id) const;
+
+    bool isInteger(TypeId id) const;
+    bool isArithmetic(TypeId id) const;
+    bool isScalar(TypeId id) const;   // Arithmetic or pointer
+
+    std::string name(TypeId id) const;
+    size_t typeCount() const { return entries.size(); }
+
+private:
+    struct Entry {
+        TypeKind kind;
+        uint32_t bits = 0;
+        size_t size = 0;
+        size_t align = 1;
+        TypeId element = INVALID_TYPE;   // Pointee or array element
+        uint64_t count = 0;              // Array length
+        uint32_t aux = 0;                // Index into names / memberLists / fieldLists
+        bool complete = true;
+    };
+
+    // Pointers and arrays are keyed by (kind, element, count)
+    struct DerivedKey {
+        TypeKind kind;
+        TypeId element;
+        uint64_t count;
+        bool operator==(const DerivedKey& other) const {
+            return kind == other.kind && element == other.element && count == other.count;
+        }
+    };
+    struct DerivedKeyHash {
+        size_t operator()(const DerivedKey& key) const {
+            uint64_t h = (static_cast<uint64_t>(key.element) << 8) ^ static_cast<uint64_t>(key.kind);
+            h ^= key.count * 0x9E3779B97F4A7C15ULL;
+            return static_cast<size_t>(h ^ (h >> 29));
+        }
+    };
+
+    std::vector<Entry> entries;
+    std::unordered_map<DerivedKey, TypeId, DerivedKeyHash> derived;
+    std::map<std::vector<TypeId>, TypeId> unions;
+    std::unordered_map<std::string, TypeId> classes;
+
+    std::vector<std::string> classNames;
+    std::vector<std::vector<TypeId>> memberLists;
+    std::vector<std::vector<ClassField>> fieldLists;
+
+    Conversion scalarMatrix[BuiltinTypes::COUNT][BuiltinTypes::COUNT];
+
+    TypeId add(const Entry& entry);
+};
+
+} // namespace holycpp
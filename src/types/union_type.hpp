@@ -332,6 +332,8 @@ public:
 constexpr int FLOAT_TYPE = 0;
 constexpr int CHAR_TYPE = 1;
 constexpr int VALUE_TYPE = 2;
+constexpr int INT_TYPE = 3;
+constexpr int UINT_TYPE = 4;
 
 class Value {
 public:
@@ -349,8 +351,8 @@ public:
     Value(F64 value) : type(FLOAT_TYPE), f(value) {}
     Value(U8 value) : type(CHAR_TYPE), ch(value) {}
     Value(Value* value) : type(VALUE_TYPE), val(value) {}
-    Value(I32 value) : type(3), i(value) {}
-    Value(U32 value) : type(4), u(value) {}
+    Value(I32 value) : type(INT_TYPE), i(value) {}
+    Value(U32 value) : type(UINT_TYPE), u(value) {}
     
     F64 as_float() const {
         if (type != FLOAT_TYPE) {
@@ -395,10 +397,10 @@ public:
             case VALUE_TYPE:
                 std::cout << "Value pointer: " << val << std::endl;
                 break;
-            case 3:
+            case INT_TYPE:
                 std::cout << "Int: " << i << std::endl;
                 break;
-            case 4:
+            case UINT_TYPE:
                 std::cout << "UInt: " << u << std::endl;
                 break;
             default:
@@ -410,14 +412,14 @@ public:
     bool is_float() const { return type == FLOAT_TYPE; }
     bool is_char() const { return type == CHAR_TYPE; }
     bool is_value_ptr() const { return type == VALUE_TYPE; }
-    bool is_int() const { return type == 3; }
-    bool is_uint() const { return type == 4; }
+    bool is_int() const { return type == INT_TYPE; }
+    bool is_uint() const { return type == UINT_TYPE; }
     
     void set_float(F64 value) { type = FLOAT_TYPE; f = value; }
     void set_char(U8 value) { type = CHAR_TYPE; ch = value; }
     void set_value_ptr(Value* value) { type = VALUE_TYPE; val = value; }
-    void set_int(I32 value) { type = 3; i = value; }
-    void set_uint(U32 value) { type = 4; u = value; }
+    void set_int(I32 value) { type = INT_TYPE; i = value; }
+    void set_uint(U32 value) { type = UINT_TYPE; u = value; }
 };
 
 // ==================== Memory Allocation Helpers ====================
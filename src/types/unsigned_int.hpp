@@ -4,15 +4,17 @@
 #include <type_traits>
 #include <stdexcept>
 #include <limits>
+#include "checking.hpp"
+#include "bits.hpp"
 
 namespace holycpp {
 
 // Forward declarations
-template<size_t> class SInt;  // Forward declare SInt template
 class HBool; class HStr; class U0;
 
-// Base unsigned integer type
-template<size_t Bits>
+// Base unsigned integer type. Policy (see checking.hpp) decides what the
+// arithmetic operators do on overflow, division by zero and bad shifts.
+template<size_t Bits, typename Policy>
 class UInt {
 public:
     using storage_type = 
@@ -43,6 +45,7 @@ protected:
 public:
     // Constants
     static constexpr size_t BITS = Bits;
+    using policy_type = Policy;
     static constexpr storage_type MIN = 0;
     static constexpr storage_type MAX = 
         Bits == 8 ? UINT8_MAX :
@@ -56,8 +59,8 @@ public:
     UInt(storage_type val) : value(val) {}
     
     // Implicit conversions from other unsigned types with bounds checking
-    template<size_t OtherBits>
-    UInt(const UInt<OtherBits>& other) {
+    template<size_t OtherBits, typename OtherPolicy>
+    UInt(const UInt<OtherBits, OtherPolicy>& other) {
         if constexpr (OtherBits > Bits) {
             check_bounds(other.raw());
         }
@@ -66,8 +69,8 @@ public:
     
     // From signed HolyC++ types (with bounds checking)
     // Implemented in signed_int.hpp after SInt is defined
-    template<size_t OtherBits>
-    UInt(const SInt<OtherBits>& other);
+    template<size_t OtherBits, typename OtherPolicy>
+    UInt(const SInt<OtherBits, OtherPolicy>& other);
     
     // From signed with bounds checking
     template<typename T, typename = std::enable_if_t<
@@ -136,60 +139,30 @@ public:
         return UInt(value * other.value);
     }
     
-    // Arithmetic operators (unchecked for performance, HolyC-style)
-    UInt operator+(const UInt& other) const { return UInt(static_cast<storage_type>(value + other.value)); }
-    UInt operator-(const UInt& other) const { return UInt(static_cast<storage_type>(value - other.value)); }
-    UInt operator*(const UInt& other) const { return UInt(static_cast<storage_type>(value * other.value)); }
-    UInt operator/(const UInt& other) const { 
-        if (other.value == 0) {
-            throw std::domain_error("Division by zero");
-        }
-        return UInt(static_cast<storage_type>(value / other.value)); 
-    }
-    UInt operator%(const UInt& other) const { 
-        if (other.value == 0) {
-            throw std::domain_error("Modulo by zero");
-        }
-        return UInt(static_cast<storage_type>(value % other.value)); 
-    }
+    // Arithmetic operators (checked as Policy says; the default wraps, HolyC-style)
+    UInt operator+(const UInt& other) const { return UInt(Policy::add(value, other.value)); }
+    UInt operator-(const UInt& other) const { return UInt(Policy::sub(value, other.value)); }
+    UInt operator*(const UInt& other) const { return UInt(Policy::mul(value, other.value)); }
+    UInt operator/(const UInt& other) const { return UInt(Policy::div(value, other.value)); }
+    UInt operator%(const UInt& other) const { return UInt(Policy::mod(value, other.value)); }
     
     // Bitwise operators
     UInt operator&(const UInt& other) const { return UInt(static_cast<storage_type>(value & other.value)); }
     UInt operator|(const UInt& other) const { return UInt(static_cast<storage_type>(value | other.value)); }
     UInt operator^(const UInt& other) const { return UInt(static_cast<storage_type>(value ^ other.value)); }
     UInt operator~() const { return UInt(static_cast<storage_type>(~value)); }
-    UInt operator<<(const UInt& other) const { 
-        if (other.value >= BITS) {
-            throw std::out_of_range("Shift amount exceeds bit width");
-        }
-        return UInt(static_cast<storage_type>(value << other.value)); 
-    }
-    UInt operator>>(const UInt& other) const { 
-        if (other.value >= BITS) {
-            throw std::out_of_range("Shift amount exceeds bit width");
-        }
-        return UInt(static_cast<storage_type>(value >> other.value)); 
-    }
+    UInt operator<<(const UInt& other) const { return UInt(Policy::template shl<Bits>(value, other.value)); }
+    UInt operator>>(const UInt& other) const { return UInt(Policy::template shr<Bits>(value, other.value)); }
     
     // Bitwise operators with built-in types
     template<typename T, typename = std::enable_if_t<std::is_integral_v<T>>>
-    UInt operator<<(T shift) const {
-        if (shift >= static_cast<T>(BITS)) {
-            throw std::out_of_range("Shift amount exceeds bit width");
-        }
-        return UInt(static_cast<storage_type>(value << shift));
-    }
+    UInt operator<<(T shift) const { return UInt(Policy::template shl<Bits>(value, shift)); }
     template<typename T, typename = std::enable_if_t<std::is_integral_v<T>>>
-    UInt operator>>(T shift) const {
-        if (shift >= static_cast<T>(BITS)) {
-            throw std::out_of_range("Shift amount exceeds bit width");
-        }
-        return UInt(static_cast<storage_type>(value >> shift));
-    }
+    UInt operator>>(T shift) const { return UInt(Policy::template shr<Bits>(value, shift)); }
     template<typename T, typename = std::enable_if_t<std::is_integral_v<T>>>
     UInt operator%(T other) const {
         if (other == 0) {
-            throw std::domain_error("Modulo by zero");
+            return UInt(Policy::mod(value, storage_type(0)));
         }
         return UInt(static_cast<storage_type>(value % other));
     }
@@ -229,46 +202,32 @@ public:
     }
     
     // Compound assignment
-    UInt& operator+=(const UInt& other) { value += other.value; return *this; }
-    UInt& operator-=(const UInt& other) { value -= other.value; return *this; }
-    UInt& operator*=(const UInt& other) { value *= other.value; return *this; }
-    UInt& operator/=(const UInt& other) { 
-        if (other.value == 0) {
-            throw std::domain_error("Division by zero");
-        }
-        value /= other.value; 
-        return *this; 
-    }
-    UInt& operator%=(const UInt& other) { 
-        if (other.value == 0) {
-            throw std::domain_error("Modulo by zero");
-        }
-        value %= other.value; 
-        return *this; 
-    }
+    UInt& operator+=(const UInt& other) { value = Policy::add(value, other.value); return *this; }
+    UInt& operator-=(const UInt& other) { value = Policy::sub(value, other.value); return *this; }
+    UInt& operator*=(const UInt& other) { value = Policy::mul(value, other.value); return *this; }
+    UInt& operator/=(const UInt& other) { value = Policy::div(value, other.value); return *this; }
+    UInt& operator%=(const UInt& other) { value = Policy::mod(value, other.value); return *this; }
     UInt& operator&=(const UInt& other) { value &= other.value; return *this; }
     UInt& operator|=(const UInt& other) { value |= other.value; return *this; }
     UInt& operator^=(const UInt& other) { value ^= other.value; return *this; }
-    UInt& operator<<=(const UInt& other) { 
-        if (other.value >= BITS) {
-            throw std::out_of_range("Shift amount exceeds bit width");
-        }
-        value <<= other.value; 
-        return *this; 
-    }
-    UInt& operator>>=(const UInt& other) { 
-        if (other.value >= BITS) {
-            throw std::out_of_range("Shift amount exceeds bit width");
-        }
-        value >>= other.value; 
-        return *this; 
-    }
+    UInt& operator<<=(const UInt& other) { value = Policy::template shl<Bits>(value, other.value); return *this; }
+    UInt& operator>>=(const UInt& other) { value = Policy::template shr<Bits>(value, other.value); return *this; }
     
     // Increment/Decrement
-    UInt& operator++() { ++value; return *this; }
-    UInt operator++(int) { UInt temp = *this; ++value; return temp; }
-    UInt& operator--() { --value; return *this; }
-    UInt operator--(int) { UInt temp = *this; --value; return temp; }
+    UInt& operator++() { value = Policy::add(value, storage_type(1)); return *this; }
+    UInt operator++(int) { UInt temp = *this; ++*this; return temp; }
+    UInt& operator--() { value = Policy::sub(value, storage_type(1)); return *this; }
+    UInt operator--(int) { UInt temp = *this; --*this; return temp; }
+    
+    // Bit intrinsics (see bits.hpp)
+    int popcount() const { return bits::popcount(value); }
+    int leading_zeros() const { return bits::countLeadingZeros(value); }
+    int trailing_zeros() const { return bits::countTrailingZeros(value); }
+    UInt byte_swap() const { return UInt(bits::byteSwap(value)); }
+    UInt rotate_left(unsigned count) const { return UInt(bits::rotateLeft(value, count)); }
+    UInt rotate_right(unsigned count) const { return UInt(bits::rotateRight(value, count)); }
+    UInt extract_bits(const UInt& mask) const { return UInt(bits::extractBits(value, mask.value)); }
+    UInt deposit_bits(const UInt& mask) const { return UInt(bits::depositBits(value, mask.value)); }
     
     // HolyC-style methods
     const char* to_hex() const {
@@ -310,7 +269,7 @@ using U64 = UInt<64>;
 template<typename T>
 struct is_unsigned_holyc : std::false_type {};
 
-template<size_t B> struct is_unsigned_holyc<UInt<B>> : std::true_type {};
+template<size_t B, typename P> struct is_unsigned_holyc<UInt<B, P>> : std::true_type {};
 
 template<typename T>
 inline constexpr bool is_unsigned_holyc_v = is_unsigned_holyc<T>::value;